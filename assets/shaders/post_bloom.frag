@@ -0,0 +1,55 @@
+// Bloom Post-Process Fragment Shader
+//
+// Used with Raylib's default vertex shader at the internal resolution.
+// Bright pixels (neon frames, highlighted text) bleed into their
+// neighbours. Quality sets how many rings of 8 taps are gathered.
+#version 330 core
+
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+out vec4 finalColor;
+
+uniform sampler2D texture0;
+uniform vec2 resolution;  // Internal resolution in pixels
+uniform int quality;      // 0 low, 1 medium, 2 high
+
+const float THRESHOLD = 0.6;   // Brightness where glow starts
+const float STRENGTH  = 0.8;
+const float RING_STEP = 2.0;   // Pixels between rings
+const int TAPS        = 8;
+
+vec3
+brightPart(vec2 uv)
+{
+    vec3 color = texture(texture0, uv).rgb;
+    float peak = max(color.r, max(color.g, color.b));
+    return color * smoothstep(THRESHOLD, 1.0, peak);
+}
+
+void
+main()
+{
+    vec3 base   = texture(texture0, fragTexCoord).rgb;
+    vec2 texel  = 1.0 / resolution;
+    int rings   = quality + 1;
+    vec3 glow   = vec3(0.0);
+    float total = 0.0;
+
+    for (int ring = 1; ring <= rings; ++ring)
+    {
+        float radius = float(ring) * RING_STEP;
+        float weight = 1.0 / float(ring);
+
+        // Rotate each ring half a step so the taps do not line up
+        for (int tap = 0; tap < TAPS; ++tap)
+        {
+            float angle = (float(tap) + 0.5 * float(ring)) * (6.2831853 / float(TAPS));
+            vec2 offset = vec2(cos(angle), sin(angle)) * radius * texel;
+            glow += brightPart(fragTexCoord + offset) * weight;
+            total += weight;
+        }
+    }
+
+    finalColor = vec4(base + glow / total * STRENGTH, 1.0);
+}
@@ -0,0 +1,37 @@
+// Chromatic Aberration Post-Process Fragment Shader
+//
+// Used with Raylib's default vertex shader at the internal resolution.
+// Red and blue drift apart toward the screen edges like a cheap CRT lens.
+// Quality smears each channel over more taps instead of a hard double edge.
+#version 330 core
+
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+out vec4 finalColor;
+
+uniform sampler2D texture0;
+uniform vec2 resolution;  // Internal resolution in pixels
+uniform int quality;      // 0 low, 1 medium, 2 high
+
+const float STRENGTH = 2.0;  // Channel offset at the screen edge, in pixels
+
+void
+main()
+{
+    vec2 fromCenter = fragTexCoord - 0.5;
+    vec2 offset     = fromCenter * 2.0 * STRENGTH / resolution;
+
+    int taps   = 1 + quality * 2;
+    float red  = 0.0;
+    float blue = 0.0;
+    for (int tap = 1; tap <= taps; ++tap)
+    {
+        float t = float(tap) / float(taps);
+        red += texture(texture0, fragTexCoord + offset * t).r;
+        blue += texture(texture0, fragTexCoord - offset * t).b;
+    }
+
+    float green = texture(texture0, fragTexCoord).g;
+    finalColor  = vec4(red / float(taps), green, blue / float(taps), 1.0);
+}
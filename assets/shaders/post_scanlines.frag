@@ -0,0 +1,43 @@
+// Scanlines Post-Process Fragment Shader
+//
+// Used with Raylib's default vertex shader at the internal resolution, so
+// one scanline is one internal row. Quality adds a slow rolling band
+// (medium) and a vignette (high).
+#version 330 core
+
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+out vec4 finalColor;
+
+uniform sampler2D texture0;
+uniform vec2 resolution;  // Internal resolution in pixels
+uniform float time;       // Seconds
+uniform int quality;      // 0 low, 1 medium, 2 high
+
+const float LINE_DARKEN   = 0.3;
+const float BAND_STRENGTH = 0.04;
+const float VIGNETTE      = 0.45;
+
+void
+main()
+{
+    vec3 color = texture(texture0, fragTexCoord).rgb;
+
+    // Every other row is darker
+    float row = floor(fragTexCoord.y * resolution.y);
+    color *= 1.0 - LINE_DARKEN * mod(row, 2.0);
+
+    if (quality >= 1)
+    {
+        color *= 1.0 + BAND_STRENGTH * sin(fragTexCoord.y * 6.0 - time * 1.5);
+    }
+
+    if (quality >= 2)
+    {
+        vec2 fromCenter = fragTexCoord - 0.5;
+        color *= 1.0 - VIGNETTE * dot(fromCenter, fromCenter);
+    }
+
+    finalColor = vec4(color, 1.0);
+}
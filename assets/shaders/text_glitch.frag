@@ -0,0 +1,46 @@
+// Glitch Text Fragment Shader
+//
+// Pairs with text_glitch.vert. Samples the atlas three times, shifting red
+// and blue apart horizontally, so glyph edges fringe like a misaligned
+// CRT. Handles bitmap and signed distance field atlases.
+//
+// Plain GLSL 3.30, no extensions (runs on Mesa's llvmpipe).
+#version 330 core
+
+in vec2 fragTexCoord;
+in vec4 fragColor;
+in float fragSplit;
+flat in int fragSdf;  // 1 when the atlas stores distance fields
+
+out vec4 finalColor;
+
+uniform sampler2D texture0;
+
+float
+coverage(vec2 uv, float edgeWidth)
+{
+    float value = texture(texture0, uv).a;
+    if (fragSdf == 0)
+        return value;
+
+    return smoothstep(-edgeWidth, edgeWidth, value - 0.5);
+}
+
+void
+main()
+{
+    // Derivatives are taken outside any branch, as GLSL requires
+    float center    = texture(texture0, fragTexCoord).a - 0.5;
+    float edgeWidth = length(vec2(dFdx(center), dFdy(center)));
+
+    vec2 split   = vec2(fragSplit / float(textureSize(texture0, 0).x), 0.0);
+    vec3 channel = vec3(coverage(fragTexCoord - split, edgeWidth),
+                        coverage(fragTexCoord, edgeWidth),
+                        coverage(fragTexCoord + split, edgeWidth));
+
+    // Straight alpha: the widest channel sets alpha, the others are scaled to match
+    float alpha = max(channel.r, max(channel.g, channel.b));
+    vec3 color  = fragColor.rgb * channel / max(alpha, 0.0001);
+
+    finalColor = vec4(color, fragColor.a * alpha);
+}
@@ -0,0 +1,147 @@
+// Glitch Text Vertex Shader
+//
+// GPU version of GlitchEffect::getCharacterState(). The four corners of a
+// glyph carry the same glyph attributes, so whole glyphs move and keep
+// their shape. Glyphs that are hidden, and ghost copies that are not
+// shown this frame, collapse outside the clip volume. The effect settings
+// are vertex attributes too, so strings with different settings can share
+// a draw.
+//
+// Plain GLSL 3.30, no extensions (runs on Mesa's llvmpipe).
+#version 330 core
+
+layout(location = 0) in vec2 vertexPosition;
+layout(location = 1) in vec2 vertexTexCoord;
+layout(location = 3) in vec4 vertexColor;
+layout(location = 6) in vec4 glyphParams;  // glyph index, slice position, block id, intensity
+layout(location = 7) in vec4 glyphTime;    // time, seed, copy flag, unused
+layout(location = 8) in vec4 glyphMotion;  // max jitter (pixels), slice zone half-height, offset
+layout(location = 9) in vec4 glyphGhost;   // duplication chance, max ghost offset, block offset
+layout(location = 10) in vec4 glyphColor;  // glitch color, corruption chance
+layout(location = 11) in vec4 glyphTint;   // aberration, RGB separation, channel split, sdf
+
+out vec2 fragTexCoord;
+out vec4 fragColor;
+out float fragSplit;
+flat out int fragSdf;
+
+uniform mat4 mvp;
+
+// Same hash as GlitchEffect::generateNoise(), 0-1
+float
+noise(uint index, uint seed)
+{
+    uint n = index * 374761393u + seed * 668265263u;
+    n      = (n ^ (n >> 13u)) * 1274126177u;
+    return float((n ^ (n >> 16u)) & 0xFFFFFFu) / 16777216.0;
+}
+
+// Per-channel color multiplier, cycling red/green/blue along the string
+vec3
+channelTint(uint index, float boost, float cut, float deepCut)
+{
+    uint channel = index % 3u;
+    if (channel == 0u)
+        return vec3(1.0 + boost, 1.0 - cut, 1.0 - deepCut);
+    if (channel == 1u)
+        return vec3(1.0 - cut, 1.0 + boost, 1.0 - cut);
+    return vec3(1.0 - deepCut, 1.0 - cut, 1.0 + boost);
+}
+
+void
+main()
+{
+    uint index      = uint(glyphParams.x);
+    float position  = glyphParams.y;
+    uint block      = uint(glyphParams.z);
+    float intensity = glyphParams.w;
+    float time      = glyphTime.x;
+    uint seed       = uint(glyphTime.y);
+    bool ghost      = glyphTime.z > 0.5;
+
+    vec2 jitter            = glyphMotion.xy;
+    vec2 slice             = glyphMotion.zw;
+    vec3 duplicate         = glyphGhost.xyz;
+    float blockOffset      = glyphGhost.w;
+    vec3 glitchColor       = glyphColor.rgb;
+    float corruptionChance = glyphColor.a;
+    vec2 tint              = glyphTint.xy;
+
+    vec2 offset   = vec2(0.0);
+    vec3 colorMod = vec3(1.0);
+    bool visible  = !ghost;
+
+    // Horizontal slices: glyphs near a moving zone center shift together
+    if (slice.y > 0.0 && intensity > 0.15)
+    {
+        float center   = noise(uint(time * 10.0), seed);
+        float distance = abs(position - center);
+        if (distance < slice.x)
+        {
+            float direction = noise(uint(center * 1000.0), seed) > 0.5 ? 1.0 : -1.0;
+            offset.x += direction * slice.y * (1.0 - distance / slice.x) * intensity;
+        }
+    }
+
+    // Blocks: about 40% of the blocks jump as a unit
+    if (blockOffset > 0.0 && intensity > 0.2)
+    {
+        float blockX = noise(block, seed + 500u);
+        float blockY = noise(block, seed + 600u);
+        if (blockX >= 0.6)
+        {
+            offset += vec2((blockX - 0.5) * 2.0, blockY - 0.5) * blockOffset * intensity;
+        }
+    }
+
+    // Jitter: layered waves along the string plus a random kick re-rolled 60 times a second
+    if (jitter != vec2(0.0) && intensity > 0.1)
+    {
+        vec2 wave = vec2(sin(time * 10.0 + position * 20.0) * 0.5 +
+                             sin(time * 7.3 + position * 15.0 + 1.5) * 0.3,
+                         cos(time * 13.7 - position * 10.0) * 0.2) *
+                    jitter;
+
+        uint frame  = uint(time * 60.0);
+        vec2 random = (vec2(noise(index, seed + frame), noise(index, seed + frame + 7919u)) - 0.5) *
+                      2.0 * jitter;
+
+        offset += (wave * 0.7 + random * 0.3) * intensity * noise(index, seed);
+    }
+
+    if (tint.x > 0.0 && intensity > 0.2)
+    {
+        float amount = intensity * tint.x;
+        colorMod     = channelTint(index, amount * 0.8, amount * 0.5, amount * 0.7);
+        colorMod += glitchColor * amount * 0.4;
+    }
+    else if (tint.y > 0.0 && intensity > 0.2)
+    {
+        colorMod = channelTint(index, intensity * 0.5, intensity * 0.3, intensity * 0.3);
+        colorMod += glitchColor * intensity * 0.3;
+    }
+
+    if (ghost)
+    {
+        // Dimmer copy of the glyph next to the original
+        if (intensity > 0.3 && noise(index, seed + 700u) <= duplicate.x)
+        {
+            visible = true;
+            offset += vec2(noise(index, seed + 800u) - 0.5, noise(index, seed + 900u) - 0.5) *
+                      2.0 * duplicate.yz * intensity;
+            colorMod *= 0.6;
+        }
+    }
+    else if (noise(index, seed + 1000u) < corruptionChance * intensity)
+    {
+        visible = false;
+    }
+
+    fragTexCoord = vertexTexCoord;
+    fragColor    = vec4(clamp(vertexColor.rgb * colorMod, 0.0, 1.0), vertexColor.a);
+    fragSplit    = glyphTint.z * intensity;
+    fragSdf      = glyphTint.w > 0.5 ? 1 : 0;
+
+    gl_Position = visible ? mvp * vec4(vertexPosition + offset, 0.0, 1.0)
+                          : vec4(2.0, 2.0, 2.0, 1.0);
+}
@@ -0,0 +1,25 @@
+// Signed Distance Field Text Fragment Shader
+//
+// Used with Raylib's default vertex shader. The atlas alpha channel holds
+// the distance to the glyph outline, 0.5 being exactly on the edge.
+#version 330 core
+
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+out vec4 finalColor;
+
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+
+void
+main()
+{
+    float distanceFromEdge = texture(texture0, fragTexCoord).a - 0.5;
+
+    // Screen-space rate of change keeps the edge about one pixel wide at any scale
+    float edgeWidth = length(vec2(dFdx(distanceFromEdge), dFdy(distanceFromEdge)));
+    float alpha     = smoothstep(-edgeWidth, edgeWidth, distanceFromEdge);
+
+    finalColor = vec4(fragColor.rgb, fragColor.a * alpha) * colDiffuse;
+}
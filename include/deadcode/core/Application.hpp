@@ -14,6 +14,7 @@
 #include "deadcode/core/Types.hpp"
 #include "deadcode/game/GameState.hpp"
 
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -191,22 +192,69 @@ private:
      */
     void processInput(float deltaTime);
 
+    struct SimulationInput;
+    struct FrameSnapshot;
+
     /**
-     * @brief Update game state
-     * @param deltaTime Time since last frame in seconds
+     * @brief Update game state by one simulation step (simulation thread)
+     * @param deltaTime Fixed simulation step in seconds
      */
     void update(float deltaTime);
 
+    /**
+     * @brief Start stepping the simulation, on a worker thread if configured
+     * @return true if successful
+     */
+    bool startSimulation();
+
+    /**
+     * @brief Hand the main thread state the simulation depends on over to it
+     * @return true if it changed since the last frame or keys were handled
+     */
+    bool handOverInput();
+
+    /**
+     * @brief Publish the animation state for drawing (simulation thread)
+     *
+     * @param tick Steps simulated so far
+     * @param stateTime When the state was current
+     * @return Seconds until the state changes on its own, negative if never
+     */
+    float publishFrame(uint64 tick, std::chrono::steady_clock::time_point stateTime);
+
     /**
      * @brief Render the current frame
-     * @param deltaTime Time since last frame in seconds
+     * @param frame Newest published animation state
+     * @param alpha Interpolation alpha between the frame's step and the next
+     */
+    void render(const FrameSnapshot& frame, float alpha);
+
+    /**
+     * @brief Choose between vsync and the frame pacer for the target frame rate
      */
-    void render(float deltaTime);
+    void configureFramePacing();
 
     /**
-     * @brief Calculate and enforce frame timing
+     * @brief Feed the last frame to the quality governor and apply its decision
+     *
+     * @param frameTime Interval since the previous frame (seconds)
+     */
+    void updateQualityGovernor(float frameTime);
+
+    /**
+     * @brief Apply the governor's render scale and effect tier
+     */
+    void applyQualityLevel();
+
+    /**
+     * @brief Get how long the screen stays unchanged if no input arrives
+     *
+     * Only the main menu idles; everything else animates every frame.
+     *
+     * @param frame Newest published animation state
+     * @return Seconds from now, 0 to keep rendering
      */
-    void syncFrameRate();
+    [[nodiscard]] float getIdleTimeout(const FrameSnapshot& frame) const;
 
     /**
      * @brief Setup main menu items
@@ -0,0 +1,144 @@
+/**
+ * @file FramePacer.hpp
+ * @brief High-precision frame pacing
+ *
+ * Holds a target frame rate on its own, without Raylib's SetTargetFPS
+ * (which overshoots by a millisecond or more on Linux). The pacer sleeps
+ * for the bulk of the remaining frame time and spins for the last part,
+ * sized from the sleep overshoot it observes. Deadlines follow a fixed
+ * schedule so errors do not accumulate.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-26
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+#include <array>
+#include <chrono>
+
+namespace deadcode
+{
+
+/**
+ * @brief Pacing counters since the last resetStats()
+ */
+struct FramePacerStats
+{
+    /// Deviation bucket edges in microseconds; bucket i holds values below edge i
+    static constexpr std::array<int32, 10> BUCKET_EDGES = {-2000, -1000, -500, -250, -100,
+                                                           100,   250,   500,  1000, 2000};
+    static constexpr size_t BUCKET_COUNT = BUCKET_EDGES.size() + 1;
+
+    uint64 frames{0};
+    uint64 waits{0};              ///< Frames the pacer waited for
+    uint64 missedDeadlines{0};    ///< Frames whose work ran past the deadline
+    float64 totalWakeError{0.0};  ///< Sum of wake time - deadline over waits (seconds)
+    float64 maxWakeError{0.0};
+    float64 totalDeviation{0.0};         ///< Sum of frame time - target (seconds)
+    float64 totalDeviationSquared{0.0};  ///< For the RMS jitter
+
+    /// Frame time - target, bucketed by BUCKET_EDGES
+    std::array<uint64, BUCKET_COUNT> deviationHistogram{};
+
+    /**
+     * @brief Get the mean wake error in seconds
+     */
+    [[nodiscard]] float64 getMeanWakeError() const;
+
+    /**
+     * @brief Get the RMS frame time deviation from the target in seconds
+     */
+    [[nodiscard]] float64 getJitter() const;
+};
+
+/**
+ * @brief Frame pacer
+ *
+ * Call waitForNextFrame() once per frame after presenting. With vsync
+ * holding the rate the pacer does not wait and only measures.
+ */
+class FramePacer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Constructor
+     */
+    FramePacer();
+
+    /**
+     * @brief Set the target frame rate
+     *
+     * @param fps Frames per second (0 or less for unlimited)
+     */
+    void setTargetFPS(int32 fps);
+
+    /**
+     * @brief Get the target frame rate (0 for unlimited)
+     */
+    [[nodiscard]] int32 getTargetFPS() const;
+
+    /**
+     * @brief Tell the pacer that vsync already holds the target rate
+     *
+     * The pacer then only measures; waiting on top of vsync would beat
+     * against the display and drop frames.
+     */
+    void setVSyncPaced(bool vsyncPaced);
+
+    /**
+     * @brief Wait until the next frame is due and record the frame
+     */
+    void waitForNextFrame();
+
+    /**
+     * @brief Start a new schedule from now
+     *
+     * Call after a frame that waited elsewhere (idle sleep, loading), so
+     * it is neither measured nor caught up on.
+     */
+    void resync();
+
+    /**
+     * @brief Get pacing counters
+     */
+    [[nodiscard]] const FramePacerStats& getStats() const;
+
+    /**
+     * @brief Clear pacing counters
+     */
+    void resetStats();
+
+    /**
+     * @brief Log the counters and the deviation histogram
+     */
+    void logStats() const;
+
+private:
+    /**
+     * @brief Sleep most of the way to a deadline, then spin
+     */
+    void waitUntil(Clock::time_point deadline);
+
+    /**
+     * @brief Add a frame to the counters
+     *
+     * @param frameTime Interval since the previous frame
+     */
+    void recordFrame(Clock::duration frameTime);
+
+    Clock::duration m_period;  ///< Zero when unlimited
+    Clock::time_point m_deadline;
+    Clock::time_point m_lastFrame;
+    Clock::duration m_sleepOvershoot;  ///< Smoothed oversleep, sizes the spin window
+    int32 m_targetFPS;
+    bool m_vsyncPaced;
+    bool m_scheduled;  ///< m_deadline and m_lastFrame are valid
+    FramePacerStats m_stats;
+};
+
+}  // namespace deadcode
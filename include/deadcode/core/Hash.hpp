@@ -0,0 +1,85 @@
+/**
+ * @file Hash.hpp
+ * @brief Non-cryptographic hashing helpers
+ *
+ * FNV-1a, used for cache keys (text layouts, baked font atlases, shader
+ * programs) and compile-time uniform name hashes.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-17
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+#include <cstddef>
+
+namespace deadcode
+{
+namespace Hash
+{
+
+constexpr uint64 FNV_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64 FNV_PRIME        = 1099511628211ull;
+
+/**
+ * @brief FNV-1a over a byte range
+ *
+ * @param data Bytes to hash
+ * @param size Number of bytes
+ * @param hash Running hash (pass a previous result to chain ranges)
+ * @return Updated hash
+ */
+inline uint64
+fnv1a(const void* data, size_t size, uint64 hash = FNV_OFFSET_BASIS)
+{
+    const auto* bytes = static_cast<const uint8*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief Mix a 64-bit value into a running FNV-1a hash, byte by byte
+ *
+ * @param hash Running hash
+ * @param value Value to mix in (little-endian byte order)
+ * @return Updated hash
+ */
+inline uint64
+fnv1aMix(uint64 hash, uint64 value)
+{
+    for (int32 i = 0; i < 8; ++i)
+    {
+        hash ^= (value >> (i * 8)) & 0xFFu;
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief FNV-1a over the characters of a string, usable at compile time
+ *
+ * Gives the same result as fnv1a(text.data(), text.size()).
+ *
+ * @param text Characters to hash
+ * @param hash Running hash
+ * @return Updated hash
+ */
+constexpr uint64
+fnv1aText(StringView text, uint64 hash = FNV_OFFSET_BASIS)
+{
+    for (char c : text)
+    {
+        hash ^= static_cast<uint8>(c);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+}  // namespace Hash
+}  // namespace deadcode
@@ -0,0 +1,78 @@
+/**
+ * @file MappedFile.hpp
+ * @brief Read-only memory-mapped file
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-17
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+#include <cstddef>
+
+namespace deadcode
+{
+
+/**
+ * @brief Read-only view of a whole file mapped into memory
+ *
+ * Lets large binary assets (fonts, baked atlases) be read without copying
+ * them into a heap buffer first. The mapping is released on close() or
+ * destruction.
+ */
+class MappedFile
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    MappedFile();
+
+    /**
+     * @brief Destructor, unmaps the file
+     */
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Map a file
+     *
+     * @param path Path to the file
+     * @return true if the file exists, is not empty and could be mapped
+     */
+    bool open(const String& path);
+
+    /**
+     * @brief Unmap the file
+     */
+    void close();
+
+    /**
+     * @brief Check if a file is mapped
+     */
+    [[nodiscard]] bool isOpen() const;
+
+    /**
+     * @brief Get the mapped bytes
+     */
+    [[nodiscard]] const uint8* getData() const;
+
+    /**
+     * @brief Get the file size in bytes
+     */
+    [[nodiscard]] size_t getSize() const;
+
+    // Delete copy constructor and assignment
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+private:
+    const uint8* m_data;
+    size_t m_size;
+};
+
+}  // namespace deadcode
@@ -0,0 +1,147 @@
+/**
+ * @file SimulationThread.hpp
+ * @brief Fixed-step simulation on a worker thread
+ *
+ * Runs the simulation in fixed steps away from the render thread, and
+ * publishes the result after every batch of steps. The render thread only
+ * reads published snapshots, so a slow simulation no longer delays frames.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-27
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace deadcode
+{
+
+/**
+ * @brief Simulation settings (game.simulation in game.json)
+ */
+struct SimulationSettings
+{
+    float32 step{1.0f / 120.0f};  ///< Fixed step (seconds)
+    uint32 maxCatchUpSteps{5};    ///< Most steps a late batch may run
+    bool threaded{true};          ///< Run on a worker thread instead of in advance()
+};
+
+/**
+ * @brief Fixed-step simulation driver
+ *
+ * The step function advances the simulation by one step. The publish
+ * function runs after every batch of steps. It hands a snapshot to the
+ * render thread and returns how long the simulation stays unchanged on its
+ * own, so the worker can sleep through static stretches (idle menus)
+ * instead of ticking. wake() ends such a sleep early, e.g. after input.
+ *
+ * Without a worker thread the caller drives the same steps with advance().
+ */
+class SimulationThread
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Advance the simulation by one step of the given length (seconds)
+    using StepFunction = std::function<void(float32 step)>;
+
+    /**
+     * Publish a snapshot. stateTime is when the simulated state was
+     * current. Returns seconds until the state changes again without
+     * input, 0 if it changes every step, or negative if nothing is
+     * scheduled.
+     */
+    using PublishFunction = std::function<float32(uint64 tick, Clock::time_point stateTime)>;
+
+    /**
+     * @brief Constructor
+     */
+    SimulationThread();
+
+    /**
+     * @brief Destructor, stops the worker
+     */
+    ~SimulationThread();
+
+    /**
+     * @brief Publish the initial state and start stepping
+     *
+     * @param settings Step settings
+     * @param step Called for every step (on the worker when threaded)
+     * @param publish Called after every batch of steps (same thread)
+     * @return true if successful
+     */
+    bool start(const SimulationSettings& settings, StepFunction step, PublishFunction publish);
+
+    /**
+     * @brief Stop stepping and join the worker
+     */
+    void stop();
+
+    /**
+     * @brief Run the steps that fit in the elapsed time (unthreaded only)
+     *
+     * @param elapsed Time since the previous call (seconds)
+     * @param resumed The caller slept on purpose since the previous call
+     */
+    void advance(float32 elapsed, bool resumed);
+
+    /**
+     * @brief End an idle sleep of the worker, e.g. because input changed state
+     */
+    void wake();
+
+    /**
+     * @brief Check if the simulation runs on a worker thread
+     */
+    [[nodiscard]] bool isThreaded() const;
+
+    /**
+     * @brief Get the fixed step in seconds
+     */
+    [[nodiscard]] float32 getStep() const;
+
+    // Delete copy constructor and assignment
+    SimulationThread(const SimulationThread&)            = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+private:
+    /**
+     * @brief Worker loop
+     */
+    void run();
+
+    /**
+     * @brief Run the steps that fit in the accumulated time, then publish
+     *
+     * @param elapsed Time since the previous batch (seconds)
+     * @param resumed Simulate the whole time instead of capping catch-up
+     * @param now When the batch started
+     * @return The publish function's time until the next change
+     */
+    float32 runSteps(float32 elapsed, bool resumed, Clock::time_point now);
+
+    SimulationSettings m_settings;
+    StepFunction m_step;
+    PublishFunction m_publish;
+    float32 m_accumulator;  ///< Time not simulated yet (seconds)
+    uint64 m_tick;
+
+    std::thread m_worker;
+    std::atomic<bool> m_running;
+
+    // Only used to sleep through idle stretches, never on the stepping path
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCondition;
+    bool m_wakeRequested;
+};
+
+}  // namespace deadcode
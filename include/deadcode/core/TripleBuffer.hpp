@@ -0,0 +1,121 @@
+/**
+ * @file TripleBuffer.hpp
+ * @brief Lock-free triple buffer for handing values between two threads
+ *
+ * One thread writes complete values, another reads the newest one. The
+ * writer never waits for the reader and the reader never sees a value
+ * that is still being written: the two threads only swap slot indices
+ * through one atomic.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-27
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+#include <array>
+#include <atomic>
+
+namespace deadcode
+{
+
+/**
+ * @brief Single-producer, single-consumer triple buffer
+ *
+ * The producer fills getBackBuffer() and calls publish(); the consumer
+ * calls acquire() and reads getFrontBuffer(). Values the consumer did not
+ * get to are overwritten, it always sees the latest published one.
+ *
+ * The back buffer still holds the value published two rounds earlier, so
+ * the producer has to write every field it wants the consumer to see.
+ *
+ * @tparam T Value type, copied by the producer only
+ */
+template <typename T>
+class TripleBuffer
+{
+public:
+    /**
+     * @brief Constructor, every slot starts as a copy of the initial value
+     */
+    explicit TripleBuffer(const T& initial = T{})
+        : m_backIndex(0),
+          m_middle(1),
+          m_frontIndex(2)
+    {
+        for (Slot& slot : m_slots)
+        {
+            slot.value = initial;
+        }
+    }
+
+    /**
+     * @brief Get the slot to write the next value into (producer only)
+     */
+    T&
+    getBackBuffer()
+    {
+        return m_slots[m_backIndex].value;
+    }
+
+    /**
+     * @brief Hand the back buffer to the consumer (producer only)
+     */
+    void
+    publish()
+    {
+        uint8 previous = m_middle.exchange(static_cast<uint8>(m_backIndex | FRESH_BIT),
+                                           std::memory_order_acq_rel);
+        m_backIndex    = static_cast<uint8>(previous & INDEX_MASK);
+    }
+
+    /**
+     * @brief Take the newest published value, if there is one (consumer only)
+     *
+     * @return true if the front buffer changed
+     */
+    bool
+    acquire()
+    {
+        if ((m_middle.load(std::memory_order_relaxed) & FRESH_BIT) == 0)
+            return false;
+
+        uint8 previous = m_middle.exchange(m_frontIndex, std::memory_order_acq_rel);
+        m_frontIndex   = static_cast<uint8>(previous & INDEX_MASK);
+        return true;
+    }
+
+    /**
+     * @brief Get the value taken by the last acquire() (consumer only)
+     */
+    const T&
+    getFrontBuffer() const
+    {
+        return m_slots[m_frontIndex].value;
+    }
+
+    // Delete copy constructor and assignment
+    TripleBuffer(const TripleBuffer&)            = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+private:
+    static constexpr uint8 INDEX_MASK = 0x3;
+    static constexpr uint8 FRESH_BIT  = 0x4;  ///< Middle slot holds a value not acquired yet
+
+    /**
+     * @brief Slot on its own cache line, so the threads do not share lines
+     */
+    struct alignas(64) Slot
+    {
+        T value;
+    };
+
+    std::array<Slot, 3> m_slots;
+    alignas(64) uint8 m_backIndex;            ///< Producer's slot
+    alignas(64) std::atomic<uint8> m_middle;  ///< Slot in flight, plus FRESH_BIT
+    alignas(64) uint8 m_frontIndex;           ///< Consumer's slot
+};
+
+}  // namespace deadcode
@@ -0,0 +1,162 @@
+/**
+ * @file Utf8.hpp
+ * @brief UTF-8 decoding and encoding helpers
+ *
+ * Small, allocation-free helpers used by the text pipeline to walk
+ * strings codepoint by codepoint.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-16
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+#include <cstddef>
+
+namespace deadcode
+{
+namespace Utf8
+{
+
+/// Codepoint returned for malformed or truncated sequences
+constexpr int32 REPLACEMENT_CODEPOINT = 0xFFFD;
+
+/**
+ * @brief Decode the codepoint starting at @p pos and advance @p pos past it
+ *
+ * Malformed, overlong, surrogate and truncated sequences decode to
+ * REPLACEMENT_CODEPOINT and consume a single byte, so decoding always
+ * makes progress.
+ *
+ * @param data String bytes
+ * @param length Number of bytes in @p data
+ * @param pos Byte position, advanced by the sequence length
+ * @return Decoded codepoint
+ */
+inline int32
+decodeNext(const char* data, size_t length, size_t& pos)
+{
+    auto byteAt = [data](size_t i) { return static_cast<uint32>(static_cast<uint8>(data[i])); };
+
+    uint32 lead = byteAt(pos);
+    if (lead < 0x80u)
+    {
+        pos += 1;
+        return static_cast<int32>(lead);
+    }
+
+    size_t extra;
+    uint32 codepoint;
+    uint32 minimum;
+    if ((lead & 0xE0u) == 0xC0u)
+    {
+        extra     = 1;
+        codepoint = lead & 0x1Fu;
+        minimum   = 0x80u;
+    }
+    else if ((lead & 0xF0u) == 0xE0u)
+    {
+        extra     = 2;
+        codepoint = lead & 0x0Fu;
+        minimum   = 0x800u;
+    }
+    else if ((lead & 0xF8u) == 0xF0u)
+    {
+        extra     = 3;
+        codepoint = lead & 0x07u;
+        minimum   = 0x10000u;
+    }
+    else
+    {
+        pos += 1;
+        return REPLACEMENT_CODEPOINT;
+    }
+
+    if (pos + extra >= length)
+    {
+        pos += 1;
+        return REPLACEMENT_CODEPOINT;
+    }
+
+    for (size_t i = 1; i <= extra; ++i)
+    {
+        uint32 next = byteAt(pos + i);
+        if ((next & 0xC0u) != 0x80u)
+        {
+            pos += 1;
+            return REPLACEMENT_CODEPOINT;
+        }
+        codepoint = (codepoint << 6) | (next & 0x3Fu);
+    }
+
+    if (codepoint < minimum || codepoint > 0x10FFFFu ||
+        (codepoint >= 0xD800u && codepoint <= 0xDFFFu))
+    {
+        pos += 1;
+        return REPLACEMENT_CODEPOINT;
+    }
+
+    pos += extra + 1;
+    return static_cast<int32>(codepoint);
+}
+
+/**
+ * @brief Count the codepoints in a string
+ *
+ * @param text UTF-8 string
+ * @return Number of codepoints (malformed bytes count as one each)
+ */
+inline uint32
+countCodepoints(StringView text)
+{
+    uint32 count = 0;
+    for (size_t pos = 0; pos < text.size(); ++count)
+    {
+        decodeNext(text.data(), text.size(), pos);
+    }
+    return count;
+}
+
+/**
+ * @brief Append the UTF-8 encoding of a codepoint to a string
+ *
+ * @param codepoint Codepoint to encode (invalid values encode U+FFFD)
+ * @param out String to append to
+ */
+inline void
+appendCodepoint(int32 codepoint, String& out)
+{
+    uint32 cp = static_cast<uint32>(codepoint);
+    if (codepoint < 0 || cp > 0x10FFFFu || (cp >= 0xD800u && cp <= 0xDFFFu))
+    {
+        cp = static_cast<uint32>(REPLACEMENT_CODEPOINT);
+    }
+
+    if (cp < 0x80u)
+    {
+        out.push_back(static_cast<char>(cp));
+    }
+    else if (cp < 0x800u)
+    {
+        out.push_back(static_cast<char>(0xC0u | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80u | (cp & 0x3Fu)));
+    }
+    else if (cp < 0x10000u)
+    {
+        out.push_back(static_cast<char>(0xE0u | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80u | ((cp >> 6) & 0x3Fu)));
+        out.push_back(static_cast<char>(0x80u | (cp & 0x3Fu)));
+    }
+    else
+    {
+        out.push_back(static_cast<char>(0xF0u | (cp >> 18)));
+        out.push_back(static_cast<char>(0x80u | ((cp >> 12) & 0x3Fu)));
+        out.push_back(static_cast<char>(0x80u | ((cp >> 6) & 0x3Fu)));
+        out.push_back(static_cast<char>(0x80u | (cp & 0x3Fu)));
+    }
+}
+
+}  // namespace Utf8
+}  // namespace deadcode
@@ -2,7 +2,8 @@
  * @file AnimationSystem.hpp
  * @brief Main system for animations in whole game
  *
- * Beautiful animations with full control using tweeny library
+ * Beautiful animations with full control, tweens and keyframe tracks kept
+ * in typed pools
  *
  * @author 0xDEADC0DE Team
  * @date 2026-01-29
@@ -11,71 +12,19 @@
 #pragma once
 
 #include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/Easing.hpp"
+#include "deadcode/graphics/KeyframePool.hpp"
+#include "deadcode/graphics/KeyframeTrack.hpp"
+#include "deadcode/graphics/TweenPool.hpp"
 
 #include <glm/glm.hpp>
 
 #include <functional>
 #include <map>
-#include <memory>
 #include <vector>
 
 namespace deadcode
 {
-namespace Easing
-{
-float32 linear(float32 t);
-
-// Quadratic easing
-float32 easeInQuad(float32 t);
-float32 easeOutQuad(float32 t);
-float32 easeInOutQuad(float32 t);
-
-// Cubic easing
-float32 easeInCubic(float32 t);
-float32 easeOutCubic(float32 t);
-float32 easeInOutCubic(float32 t);
-
-// Quartic easing
-float32 easeInQuart(float32 t);
-float32 easeOutQuart(float32 t);
-float32 easeInOutQuart(float32 t);
-
-// Quintic easing
-float32 easeInQuint(float32 t);
-float32 easeOutQuint(float32 t);
-float32 easeInOutQuint(float32 t);
-
-// Sinusoidal easing
-float32 easeInSine(float32 t);
-float32 easeOutSine(float32 t);
-float32 easeInOutSine(float32 t);
-
-// Exponential easing
-float32 easeInExpo(float32 t);
-float32 easeOutExpo(float32 t);
-float32 easeInOutExpo(float32 t);
-
-// Circular easing
-float32 easeInCirc(float32 t);
-float32 easeOutCirc(float32 t);
-float32 easeInOutCirc(float32 t);
-
-// Elastic easing
-float32 easeInElastic(float32 t);
-float32 easeOutElastic(float32 t);
-float32 easeInOutElastic(float32 t);
-
-// Back easing
-float32 easeInBack(float32 t);
-float32 easeOutBack(float32 t);
-float32 easeInOutBack(float32 t);
-
-// Bounce easing
-float32 easeOutBounce(float32 t);
-float32 easeInBounce(float32 t);
-float32 easeInOutBounce(float32 t);
-}  // namespace Easing
-
 // ============================================================================
 // INTERPOLATION TEMPLATE
 // ============================================================================
@@ -86,7 +35,7 @@ class Interpolator
 public:
     /// Interpolate between start and end values with easing
     static T interpolate(const T& start, const T& end, float32 t,
-                         std::function<float32(float32)> easingFunc = Easing::linear);
+                         EasingType easing = EasingType::Linear);
 };
 
 // Specializations for common types
@@ -95,7 +44,7 @@ class Interpolator<float32>
 {
 public:
     static float32 interpolate(float32 start, float32 end, float32 t,
-                               std::function<float32(float32)> easingFunc = Easing::linear);
+                               EasingType easing = EasingType::Linear);
 };
 
 template <>
@@ -103,7 +52,7 @@ class Interpolator<glm::vec2>
 {
 public:
     static glm::vec2 interpolate(const glm::vec2& start, const glm::vec2& end, float32 t,
-                                 std::function<float32(float32)> easingFunc = Easing::linear);
+                                 EasingType easing = EasingType::Linear);
 };
 
 template <>
@@ -111,7 +60,7 @@ class Interpolator<glm::vec3>
 {
 public:
     static glm::vec3 interpolate(const glm::vec3& start, const glm::vec3& end, float32 t,
-                                 std::function<float32(float32)> easingFunc = Easing::linear);
+                                 EasingType easing = EasingType::Linear);
 };
 
 template <>
@@ -119,7 +68,7 @@ class Interpolator<glm::vec4>
 {
 public:
     static glm::vec4 interpolate(const glm::vec4& start, const glm::vec4& end, float32 t,
-                                 std::function<float32(float32)> easingFunc = Easing::linear);
+                                 EasingType easing = EasingType::Linear);
 };
 
 // ============================================================================
@@ -153,37 +102,50 @@ enum class AnimationProperty
 };
 
 // ============================================================================
-// BASE ANIMATION INTERFACE
+// HANDLES
 // ============================================================================
 
-class IAnimation
-{
-public:
-    virtual ~IAnimation() = default;
-
-    /// Update animation by deltaTime, return true if still active
-    virtual bool update(float32 deltaTime) = 0;
-
-    /// Check if animation is complete
-    virtual bool isComplete() const = 0;
-
-    /// Reset animation to start
-    virtual void reset() = 0;
+/**
+ * @brief Handle of a running animation
+ *
+ * The low bits index a slot, the high bits hold the slot's generation.
+ * A slot's generation changes whenever its animation ends, so a handle
+ * kept past that point is recognized as stale instead of addressing
+ * whatever animation reuses the slot.
+ */
+using AnimationHandle = uint32;
 
-    /// Get animation unique ID
-    virtual uint32 getID() const = 0;
+/**
+ * @brief Handle of a value animations write to (same layout as AnimationHandle)
+ */
+using AnimationTarget = uint32;
 
-    /// Get animation property type
-    virtual AnimationProperty getProperty() const = 0;
-};
+constexpr AnimationHandle INVALID_ANIMATION = 0;
+constexpr AnimationTarget INVALID_TARGET    = 0;
 
 // ============================================================================
 // ANIMATION SYSTEM (SINGLETON)
 // ============================================================================
 
+/**
+ * @brief Tween and keyframe animations over float, vec2, vec3 and vec4 values
+ *
+ * Tweens live in one TweenPool per value type and keyframe animations in
+ * one KeyframePool per value type; both are addressed through the same
+ * generational handles, so stopping and querying are O(1) and stale
+ * handles are harmless. Animations write to targets bound with
+ * bindTarget(); the owner of a value unbinds it before the value goes
+ * away, and animations on an unbound target keep running without writing
+ * anywhere.
+ */
 class AnimationSystem
 {
 public:
+    static constexpr uint32 DEFAULT_CAPACITY = 1024;  ///< Tweens per value type before growing
+
+    /// Keyframe animations per value type before growing
+    static constexpr uint32 DEFAULT_KEYFRAME_CAPACITY = 64;
+
     /// Get singleton instance
     static AnimationSystem& getInstance();
 
@@ -196,31 +158,80 @@ public:
     /// Update all active animations
     void update(float32 deltaTime);
 
+    /// Reserve room for this many tweens per value type
+    void reserve(uint32 tweensPerType);
+
+    /// Reserve room for this many keyframe animations per value type
+    void reserveKeyframes(uint32 animationsPerType);
+
+    /// Bind a value animations may write to
+    AnimationTarget bindTarget(float32& value);
+    AnimationTarget bindTarget(glm::vec2& value);
+    AnimationTarget bindTarget(glm::vec3& value);
+    AnimationTarget bindTarget(glm::vec4& value);
+
+    /// Stop writing to a target, call before the bound value goes away
+    void unbindTarget(AnimationTarget target);
+
+    /// Check if a target is still bound
+    bool isTargetBound(AnimationTarget target) const;
+
+    /// Write a bound target directly, false if it is unbound or of another type
+    bool setTargetValue(AnimationTarget target, float32 value);
+    bool setTargetValue(AnimationTarget target, const glm::vec2& value);
+    bool setTargetValue(AnimationTarget target, const glm::vec3& value);
+    bool setTargetValue(AnimationTarget target, const glm::vec4& value);
+
     /// Create a new tween animation for float
-    uint32 createTween(float32& target, float32 startValue, float32 endValue, float32 duration,
-                       std::function<float32(float32)> easingFunc = Easing::linear,
-                       std::function<void()> onComplete           = nullptr);
+    AnimationHandle createTween(AnimationTarget target, float32 startValue, float32 endValue,
+                                float32 duration, EasingType easing = EasingType::Linear,
+                                std::function<void()> onComplete = nullptr);
 
     /// Create a new tween animation for vec2
-    uint32 createTween(glm::vec2& target, glm::vec2 startValue, glm::vec2 endValue,
-                       float32 duration,
-                       std::function<float32(float32)> easingFunc = Easing::linear,
-                       std::function<void()> onComplete           = nullptr);
+    AnimationHandle createTween(AnimationTarget target, glm::vec2 startValue, glm::vec2 endValue,
+                                float32 duration, EasingType easing = EasingType::Linear,
+                                std::function<void()> onComplete = nullptr);
 
     /// Create a new tween animation for vec3
-    uint32 createTween(glm::vec3& target, glm::vec3 startValue, glm::vec3 endValue,
-                       float32 duration,
-                       std::function<float32(float32)> easingFunc = Easing::linear,
-                       std::function<void()> onComplete           = nullptr);
+    AnimationHandle createTween(AnimationTarget target, glm::vec3 startValue, glm::vec3 endValue,
+                                float32 duration, EasingType easing = EasingType::Linear,
+                                std::function<void()> onComplete = nullptr);
 
     /// Create a new tween animation for vec4
-    uint32 createTween(glm::vec4& target, glm::vec4 startValue, glm::vec4 endValue,
-                       float32 duration,
-                       std::function<float32(float32)> easingFunc = Easing::linear,
-                       std::function<void()> onComplete           = nullptr);
-
-    /// Stop animation by ID
-    void stopAnimation(uint32 animationID);
+    AnimationHandle createTween(AnimationTarget target, glm::vec4 startValue, glm::vec4 endValue,
+                                float32 duration, EasingType easing = EasingType::Linear,
+                                std::function<void()> onComplete = nullptr);
+
+    /**
+     * @brief Play a keyframe track on a target
+     *
+     * The animation runs until the track's last key, or starts over there
+     * when looping (a looping track needs keys at two different times).
+     *
+     * @param target Bound target, or INVALID_TARGET for none
+     * @param track Keys to play, times in seconds from the animation start
+     * @param loop Start over at the last key instead of finishing
+     * @param onComplete Called once the last key is reached, never when looping
+     */
+    AnimationHandle createKeyframes(AnimationTarget target, KeyframeTrack<float32> track,
+                                    bool loop = false, std::function<void()> onComplete = nullptr);
+    AnimationHandle createKeyframes(AnimationTarget target, KeyframeTrack<glm::vec2> track,
+                                    bool loop = false, std::function<void()> onComplete = nullptr);
+    AnimationHandle createKeyframes(AnimationTarget target, KeyframeTrack<glm::vec3> track,
+                                    bool loop = false, std::function<void()> onComplete = nullptr);
+    AnimationHandle createKeyframes(AnimationTarget target, KeyframeTrack<glm::vec4> track,
+                                    bool loop = false, std::function<void()> onComplete = nullptr);
+
+    /**
+     * @brief Move a running animation to a time from its start
+     *
+     * The target is written right away. Reaching the end this way finishes
+     * the animation on the next update().
+     */
+    void seekAnimation(AnimationHandle animation, float32 seconds);
+
+    /// Stop animation by handle, without calling its completion callback
+    void stopAnimation(AnimationHandle animation);
 
     /// Stop all animations
     void stopAll();
@@ -229,7 +240,10 @@ public:
     uint32 getActiveAnimationCount() const;
 
     /// Check if animation is still running
-    bool isRunning(uint32 animationID) const;
+    bool isRunning(AnimationHandle animation) const;
+
+    /// Get the progress (0-1) of a running animation, or a negative value for a stale handle
+    float32 getProgress(AnimationHandle animation) const;
 
 private:
     AnimationSystem();
@@ -239,8 +253,98 @@ private:
     AnimationSystem(const AnimationSystem&)            = delete;
     AnimationSystem& operator=(const AnimationSystem&) = delete;
 
-    std::vector<std::unique_ptr<IAnimation>> m_animations;
-    uint32 m_nextAnimationID;
+    /// Pool a tween lives in, also the value type of a target
+    enum class ValueType : uint8
+    {
+        Float,
+        Vec2,
+        Vec3,
+        Vec4
+    };
+
+    /// Handle table entry; free slots keep their generation for the next user
+    struct Slot
+    {
+        uint32 generation{1};
+        uint32 row{0};  ///< Row in the pool, or next free slot while free
+        ValueType type{ValueType::Float};
+        bool keyframed{false};  ///< Row lives in a KeyframePool, not a TweenPool
+        bool live{false};
+    };
+
+    /// Bound target entry
+    struct TargetSlot
+    {
+        void* address{nullptr};
+        uint32 generation{1};
+        ValueType type{ValueType::Float};
+    };
+
+    template <typename T>
+    static ValueType getValueType();
+
+    template <typename T>
+    TweenPool<T>& getPool();
+
+    template <typename T>
+    KeyframePool<T>& getKeyframePool();
+
+    template <typename T>
+    AnimationHandle addTween(AnimationTarget target, const T& startValue, const T& endValue,
+                             float32 duration, EasingType easing, std::function<void()> onComplete);
+
+    template <typename T>
+    AnimationHandle addKeyframes(AnimationTarget target, KeyframeTrack<T> track, bool loop,
+                                 std::function<void()> onComplete);
+
+    /// Take a free slot for a new animation, NO_FREE_SLOT if there is none
+    uint32 acquireSlot();
+
+    template <typename T>
+    AnimationTarget addTarget(T& value);
+
+    template <typename T>
+    T* resolveTarget(AnimationTarget target) const;
+
+    template <typename T>
+    bool writeTarget(AnimationTarget target, const T& value);
+
+    /// Advance one pool, write its targets and collect finished animations
+    template <typename Pool>
+    void updatePool(Pool& pool, float32 deltaTime);
+
+    /// Per-row operations for a slot of value type T, tween or keyframe
+    template <typename T>
+    std::function<void()> takeOnComplete(const Slot& slot);
+    template <typename T>
+    static float32 getRowProgress(const TweenPool<T>& tweens, const KeyframePool<T>& keyframes,
+                                  const Slot& slot);
+    template <typename T>
+    void seekRow(const Slot& slot, float32 seconds);
+    template <typename T>
+    uint32 removeRow(const Slot& slot);
+
+    /// Get the live slot a handle refers to, or nullptr if it is stale
+    const Slot* findSlot(AnimationHandle animation) const;
+
+    /// Remove the tween of a live slot and free the slot
+    void removeAnimation(uint32 slotIndex);
+
+    TweenPool<float32> m_floatTweens;
+    TweenPool<glm::vec2> m_vec2Tweens;
+    TweenPool<glm::vec3> m_vec3Tweens;
+    TweenPool<glm::vec4> m_vec4Tweens;
+
+    KeyframePool<float32> m_floatKeyframes;
+    KeyframePool<glm::vec2> m_vec2Keyframes;
+    KeyframePool<glm::vec3> m_vec3Keyframes;
+    KeyframePool<glm::vec4> m_vec4Keyframes;
+
+    std::vector<Slot> m_slots;
+    uint32 m_freeSlot;  ///< Head of the free slot list
+    std::vector<TargetSlot> m_targets;
+    std::vector<uint32> m_freeTargets;
+    std::vector<AnimationHandle> m_finished;  ///< Tweens that finished during update()
     bool m_initialized;
 };
 
@@ -0,0 +1,209 @@
+/**
+ * @file CellGrid.hpp
+ * @brief Terminal-style character grid render target
+ *
+ * Most of the UI is a character grid (frames, menus, console). CellGrid
+ * stores it as columns x rows cells and keeps the rendered result in a
+ * render texture, redrawing only the rows that changed since the last
+ * frame. An unchanged grid costs a single textured quad per frame.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-19
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+#include <raylib.h>
+
+#include <vector>
+
+namespace deadcode
+{
+
+class RenderBackend;
+class TextRenderer;
+
+/**
+ * @brief Cell attribute flags
+ */
+namespace CellAttr
+{
+constexpr uint8 NONE      = 0;
+constexpr uint8 UNDERLINE = 1 << 0;  ///< Line under the glyph in the foreground color
+constexpr uint8 REVERSE   = 1 << 1;  ///< Swap foreground and background
+constexpr uint8 DIM       = 1 << 2;  ///< Half-intensity foreground
+}  // namespace CellAttr
+
+/**
+ * @brief One character cell
+ */
+struct Cell
+{
+    int32 codepoint{' '};
+    Color foreground{255, 255, 255, 255};
+    Color background{0, 0, 0, 0};
+    uint8 attributes{CellAttr::NONE};
+
+    bool operator==(const Cell& other) const;
+    bool operator!=(const Cell& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Counters for the last render() call
+ */
+struct CellGridStats
+{
+    uint32 rowsRebuilt{0};   ///< Dirty rows redrawn into the render texture
+    uint32 cellsRebuilt{0};  ///< Cells in those rows
+    uint32 glyphs{0};        ///< Glyphs drawn for those rows
+};
+
+/**
+ * @brief Fixed-size character grid with per-row dirty tracking
+ *
+ * Writes only mark a row dirty when a cell actually changes. render()
+ * redraws the dirty rows into a persistent render texture, then draws the
+ * texture. Grid coordinates are (column, row) with row 0 at the top.
+ */
+class CellGrid
+{
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param columns Number of columns
+     * @param rows Number of rows
+     */
+    CellGrid(int32 columns, int32 rows);
+
+    /**
+     * @brief Destructor, releases the render texture
+     *
+     * The texture goes back to the backend that created it, so the grid
+     * must not outlive the renderer it was drawn with.
+     */
+    ~CellGrid();
+
+    /**
+     * @brief Change the grid size, clearing every cell
+     */
+    void resize(int32 columns, int32 rows);
+
+    /**
+     * @brief Set a cell (out-of-range writes are ignored)
+     */
+    void setCell(int32 column, int32 row, const Cell& cell);
+
+    /**
+     * @brief Get a cell
+     *
+     * @return The cell, or a blank cell when out of range
+     */
+    [[nodiscard]] Cell getCell(int32 column, int32 row) const;
+
+    /**
+     * @brief Write UTF-8 text starting at a cell, one codepoint per cell
+     *
+     * Text is clipped at the right edge, no wrapping.
+     *
+     * @return Number of cells written
+     */
+    int32 putText(int32 column, int32 row, StringView text, Color foreground,
+                  Color background = Color{0, 0, 0, 0}, uint8 attributes = CellAttr::NONE);
+
+    /**
+     * @brief Fill a rectangle of cells
+     */
+    void fill(int32 column, int32 row, int32 width, int32 height, const Cell& cell);
+
+    /**
+     * @brief Reset every cell to blank
+     */
+    void clear();
+
+    /**
+     * @brief Force every row to be redrawn on the next render()
+     */
+    void invalidate();
+
+    /**
+     * @brief Redraw dirty rows and draw the grid
+     *
+     * The grid is queued on the text renderer's backend like a cached
+     * layer: above the rectangles and below the glyphs of the current
+     * draw layer.
+     *
+     * @param textRenderer Text renderer providing the font
+     * @param x Screen X of the top-left corner
+     * @param y Screen Y of the top-left corner
+     * @param scale Text scale (cell size follows the font metrics)
+     */
+    void render(TextRenderer* textRenderer, float32 x, float32 y, float32 scale);
+
+    [[nodiscard]] int32 getColumns() const;
+    [[nodiscard]] int32 getRows() const;
+
+    /**
+     * @brief Check if a row will be redrawn on the next render()
+     */
+    [[nodiscard]] bool isRowDirty(int32 row) const;
+
+    /**
+     * @brief Get counters for the last render() call
+     */
+    [[nodiscard]] const CellGridStats& getStats() const;
+
+    // Delete copy constructor and assignment
+    CellGrid(const CellGrid&)            = delete;
+    CellGrid& operator=(const CellGrid&) = delete;
+
+private:
+    /**
+     * @brief Mark a row dirty
+     */
+    void markDirty(int32 row);
+
+    /**
+     * @brief Make sure the render texture matches the grid and cell size
+     *
+     * @return true if it was (re)created, so every row needs drawing
+     */
+    bool ensureTarget(RenderBackend& backend, int32 cellWidth, int32 cellHeight);
+
+    /**
+     * @brief Draw the dirty rows into the render texture
+     */
+    void rebuildDirtyRows(TextRenderer* textRenderer, float32 scale);
+
+    /**
+     * @brief Draw cell backgrounds
+     *
+     * @param dirtyOnly Only dirty rows, premultiplied and including
+     *        transparent cells (render target), or every visible background
+     */
+    void drawBackgrounds(RenderBackend& backend, float32 originX, float32 originY,
+                         bool dirtyOnly);
+
+    /**
+     * @brief Draw cell glyphs and underlines
+     */
+    void drawForegrounds(TextRenderer* textRenderer, float32 originX, float32 originY,
+                         float32 scale, bool dirtyOnly);
+
+    int32 m_columns;
+    int32 m_rows;
+    std::vector<Cell> m_cells;       ///< Row-major
+    std::vector<uint64> m_dirtyRows;  ///< One bit per row
+
+    RenderTexture2D m_target;
+    RenderBackend* m_backend;  ///< Backend the target was loaded from
+    int32 m_cellWidth;
+    int32 m_cellHeight;
+    float32 m_scale;
+    uint32 m_fontGeneration;  ///< Font the target was drawn with
+    CellGridStats m_stats;
+};
+
+}  // namespace deadcode
@@ -0,0 +1,195 @@
+/**
+ * @file DigitalRain.hpp
+ * @brief Falling glyph columns drawn as an animated background
+ *
+ * The Deep Net look: columns of glyphs that fall and flicker behind the
+ * menus. Column state lives in flat arrays and every glyph of a frame goes
+ * out in one TextRenderer::renderGlyphs() call. The effect holds a CPU
+ * time budget per frame and thins out its columns when it runs over, so
+ * the background is never what drops frames on slow machines.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-01
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/QualityGovernor.hpp"
+
+#include <glm/glm.hpp>
+#include <raylib.h>
+
+#include <vector>
+
+namespace deadcode
+{
+
+class TextRenderer;
+
+/**
+ * @brief Rain settings (graphics.background.digital_rain in game.json)
+ */
+struct DigitalRainSettings
+{
+    bool enabled{true};
+    float32 budgetMs{0.5f};        ///< CPU time per frame the rain may take
+    float32 stepRate{20.0f};       ///< Steps per second; the rain only changes on a step
+    float32 scale{1.0f};           ///< Text scale of the glyphs
+    float32 minDensity{0.1f};      ///< Share of columns kept however tight the budget
+    float32 minSpeed{6.0f};        ///< Slowest column (rows per second)
+    float32 maxSpeed{24.0f};       ///< Fastest column (rows per second)
+    uint32 minTrail{6};            ///< Shortest trail (rows)
+    uint32 maxTrail{24};           ///< Longest trail (rows)
+    float32 mutationPeriod{0.6f};  ///< Mean time a trail glyph keeps its shape (seconds)
+    float32 brightness{0.35f};     ///< Alpha of the brightest glyph, keeps the menu readable
+    glm::vec3 headColor{0.75f, 1.0f, 0.85f};
+    glm::vec3 trailColor{0.0f, 0.85f, 0.35f};
+    String glyphs{"0123456789ABCDEF#$%&*+<=>?@[]{}|"};  ///< Glyph set, UTF-8
+};
+
+/**
+ * @brief Rain counters for the last render() call
+ */
+struct DigitalRainStats
+{
+    uint32 columns{0};        ///< Columns that fit on the screen
+    uint32 activeColumns{0};  ///< Columns the budget allows
+    uint32 glyphs{0};         ///< Glyphs drawn
+    float32 costMs{0.0f};     ///< Smoothed CPU time per frame
+};
+
+/**
+ * @brief Budgeted digital rain background
+ *
+ * The rain is a pure function of its step counter: column speed, phase,
+ * trail length and glyph changes all come from GlitchEffect::generateNoise()
+ * over the column and cell index. Whoever owns the clock only has to
+ * publish the step (see getStepInterval()), so the rain fits the split
+ * between the simulation and the render thread without copying columns.
+ *
+ * Columns are switched off in a fixed shuffled order, so a lower density
+ * thins the rain evenly instead of clearing one side of the screen.
+ */
+class DigitalRain
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    DigitalRain();
+
+    /**
+     * @brief Apply settings and drop the current layout
+     *
+     * @param settings Rain settings
+     */
+    void configure(const DigitalRainSettings& settings);
+
+    /**
+     * @brief Get the current settings
+     */
+    [[nodiscard]] const DigitalRainSettings& getSettings() const;
+
+    /**
+     * @brief Get the time between steps in seconds (0 when disabled)
+     */
+    [[nodiscard]] float32 getStepInterval() const;
+
+    /**
+     * @brief Set the screen size the columns cover
+     *
+     * @param width Screen width in pixels
+     * @param height Screen height in pixels
+     */
+    void setScreenSize(int32 width, int32 height);
+
+    /**
+     * @brief Limit the density to an effect tier
+     *
+     * Minimal turns the rain off, low caps it at half the columns.
+     *
+     * @param quality Effect tier
+     */
+    void setQuality(EffectQuality quality);
+
+    /**
+     * @brief Draw the rain as of a step
+     *
+     * Measures its own CPU time and adjusts the column count to the
+     * budget every few frames.
+     *
+     * @param textRenderer Renderer the glyphs are queued on
+     * @param step Step counter published by the clock owner
+     */
+    void render(TextRenderer* textRenderer, uint32 step);
+
+    /**
+     * @brief Get counters for the last render() call
+     */
+    [[nodiscard]] const DigitalRainStats& getStats() const;
+
+    // Delete copy constructor and assignment
+    DigitalRain(const DigitalRain&)            = delete;
+    DigitalRain& operator=(const DigitalRain&) = delete;
+
+private:
+    /**
+     * @brief Rebuild the column arrays for the screen size and font metrics
+     */
+    void buildColumns(const TextRenderer& textRenderer);
+
+    /**
+     * @brief Compute every column's head row for a step
+     */
+    void advanceColumns(uint32 step);
+
+    /**
+     * @brief Fill the glyph arrays from the active columns
+     */
+    void emitGlyphs(uint32 step);
+
+    /**
+     * @brief Move the active column count toward the budget
+     */
+    void adjustDensity();
+
+    /**
+     * @brief Get the most columns the effect tier allows
+     */
+    uint32 getMaxColumns() const;
+
+    DigitalRainSettings m_settings;
+    EffectQuality m_quality;
+    int32 m_screenWidth;
+    int32 m_screenHeight;
+    uint32 m_fontGeneration;
+    bool m_layoutValid;
+
+    float32 m_cellWidth;
+    float32 m_cellHeight;
+    int32 m_rows;
+    std::vector<int32> m_glyphSet;
+
+    // Per column, indexed by column; heads are in rows and run past the screen
+    std::vector<float32> m_speed;  ///< Rows per step
+    std::vector<float32> m_phase;  ///< Head row at step 0
+    std::vector<float32> m_cycle;  ///< Rows before the column starts over
+    std::vector<float32> m_trail;  ///< Trail length in rows
+    std::vector<float32> m_head;   ///< Head row at the drawn step
+    std::vector<uint32> m_order;   ///< Columns in the order they are switched on
+    uint32 m_activeColumns;
+
+    // Glyphs of the current frame, handed to the TextRenderer in one call
+    std::vector<int32> m_codepoints;
+    std::vector<float32> m_glyphX;
+    std::vector<float32> m_glyphY;
+    std::vector<float32> m_glyphScales;
+    std::vector<Color> m_glyphColors;
+
+    float32 m_costSum;  ///< CPU time of the frames since the last adjustment (ms)
+    uint32 m_costFrames;
+    DigitalRainStats m_stats;
+};
+
+}  // namespace deadcode
@@ -0,0 +1,229 @@
+/**
+ * @file DrawCommandBuffer.hpp
+ * @brief Sorted draw command buffer in front of a render backend
+ *
+ * UI code no longer draws immediately: glyphs, rectangles and textured
+ * quads are recorded as commands, sorted by draw layer, then texture, then
+ * shader, and handed to the real backend in one pass when the buffer is
+ * flushed (at the latest, at the end of the frame). Sorting keeps texture
+ * and shader switches to one per distinct state per layer.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-22
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/RenderBackend.hpp"
+
+#include <vector>
+
+namespace deadcode
+{
+
+/**
+ * @brief Well-known draw layers (higher is drawn later, on top)
+ */
+namespace DrawLayer
+{
+constexpr int32 BACKGROUND = -100;
+constexpr int32 DEFAULT    = 0;
+constexpr int32 OVERLAY    = 100;  ///< Dialogs and popups
+}  // namespace DrawLayer
+
+/**
+ * @brief Counters for one frame of executed commands
+ */
+struct DrawCommandStats
+{
+    uint32 commands{0};      ///< Commands executed
+    uint32 stateChanges{0};  ///< Texture/shader switches between consecutive commands
+    uint32 drawCalls{0};     ///< Draw calls issued by the backend
+    uint32 vertices{0};      ///< Vertices submitted
+};
+
+/**
+ * @brief Command-recording RenderBackend decorator
+ *
+ * Resource calls (textures, shaders) go straight to the wrapped backend.
+ * Within a layer, untextured rectangles sort first, then composited
+ * textures (drawTexture()), then glyphs, so backgrounds end up under
+ * cached layers and text on top of both; commands of one kind with the
+ * same texture and shader keep their submission order. Anything that must
+ * cover text drawn earlier in the same layer goes in a higher layer.
+ *
+ * Commands wait per render target: binding a target mid-frame does not
+ * execute what was queued for the previous one, which stays queued until
+ * that target is flushed, so redrawing a cached layer cannot reorder the
+ * screen.
+ */
+class DrawCommandBuffer : public RenderBackend
+{
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param backend Backend commands are executed on (not owned)
+     */
+    explicit DrawCommandBuffer(RenderBackend* backend);
+
+    [[nodiscard]] RenderBackendType getType() const override;
+    [[nodiscard]] bool supportsRenderTargets() const override;
+
+    Texture2D loadTexture(const Image& image, bool bilinear) override;
+    void updateTexture(const Texture2D& texture, const Rectangle& region,
+                       const void* pixels) override;
+    void unloadTexture(const Texture2D& texture) override;
+    RenderTexture2D loadRenderTarget(int32 width, int32 height, bool bilinear) override;
+    void unloadRenderTarget(const RenderTexture2D& target) override;
+    ::Shader loadShader(const char* vertexPath, const char* fragmentPath) override;
+    void unloadShader(const ::Shader& shader) override;
+
+    /**
+     * @brief Start a frame, resetting the frame counters
+     */
+    void beginFrame(Color clearColor) override;
+
+    /**
+     * @brief Execute remaining commands and finish the frame
+     */
+    void endFrame() override;
+
+    /**
+     * @brief Switch targets; commands for the previous target stay queued
+     *
+     * Sorting never moves a command across a target switch.
+     */
+    void beginRenderTarget(const RenderTexture2D& target, float32 viewWidth,
+                           float32 viewHeight) override;
+
+    /**
+     * @brief Execute the target's commands and return to the previous target
+     */
+    void endRenderTarget() override;
+
+    /**
+     * @brief Execute the commands recorded so far, then clear
+     */
+    void clearRenderTarget(Color color) override;
+
+    /**
+     * @brief Execute the commands recorded so far, then switch blend modes
+     */
+    void setBlendMode(RenderBlend blend) override;
+
+    void drawGlyph(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                   Color color, const ::Shader& shader, int32 codepoint) override;
+    void drawEffectGlyph(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                         Color color, const ::Shader& shader,
+                         const GlyphEffectAttributes& attributes, int32 codepoint) override;
+    void drawTexture(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                     Color color, RenderBlend blend) override;
+    void drawShadedTexture(const Texture2D& texture, const Rectangle& dest,
+                           const Rectangle& source, const ::Shader& shader) override;
+    int32 getShaderLocation(const ::Shader& shader, const char* uniformName) override;
+    void setShaderValue(const ::Shader& shader, int32 location, const void* value,
+                        int32 uniformType, int32 count) override;
+    void drawRectangle(const Rectangle& rect, Color color) override;
+
+    /**
+     * @brief Sort and execute the commands recorded for the bound target
+     *
+     * @return Draw calls issued
+     */
+    uint32 flush() override;
+
+    /**
+     * @brief Execute the commands of every bound target, outer ones included
+     *
+     * Ends the bound targets one by one, executing each target's commands
+     * under the blend mode it was recorded with, then binds them again.
+     * Used before an atlas page that outer targets still sample is reused.
+     *
+     * @return Draw calls issued
+     */
+    uint32 flushAll() override;
+
+    /**
+     * @brief Set the layer new commands are recorded in
+     */
+    void setDrawLayer(int32 layer);
+
+    /**
+     * @brief Get the layer new commands are recorded in
+     */
+    [[nodiscard]] int32 getDrawLayer() const;
+
+    /**
+     * @brief Get the number of queued commands, outer targets' included
+     */
+    [[nodiscard]] uint32 getPendingCount() const;
+
+    /**
+     * @brief Get counters of the frame in progress
+     */
+    [[nodiscard]] const DrawCommandStats& getFrameStats() const;
+
+    /**
+     * @brief Get counters of the last completed frame
+     */
+    [[nodiscard]] const DrawCommandStats& getLastFrameStats() const;
+
+    // Delete copy constructor and assignment
+    DrawCommandBuffer(const DrawCommandBuffer&)            = delete;
+    DrawCommandBuffer& operator=(const DrawCommandBuffer&) = delete;
+
+private:
+    /**
+     * @brief Kind of a recorded draw, in the order kinds are drawn within a layer
+     */
+    enum class CommandKind : uint8
+    {
+        Rectangle,
+        Texture,
+        Glyph
+    };
+
+    /**
+     * @brief One recorded draw
+     */
+    struct Command
+    {
+        int32 layer;
+        CommandKind kind;
+        RenderBlend blend;  ///< Texture commands only
+        Texture2D texture;  ///< id 0 for untextured rectangles
+        ::Shader shader;  ///< Glyphs, or a shaded texture when non-zero
+        Rectangle dest;
+        Rectangle source;
+        Color color;
+        int32 codepoint;
+        uint32 effect;  ///< 1-based index into m_effects, 0 for plain quads
+    };
+
+    /**
+     * @brief Where the commands of a bound render target start
+     */
+    struct TargetLevel
+    {
+        size_t firstCommand;
+        size_t firstEffect;
+        RenderTexture2D target;
+        float32 viewWidth;
+        float32 viewHeight;
+        RenderBlend outerBlend;  ///< Blend mode of the enclosing target when this one was bound
+    };
+
+    RenderBackend* m_backend;
+    std::vector<Command> m_commands;  ///< Outer targets' commands first
+    std::vector<GlyphEffectAttributes> m_effects;
+    std::vector<TargetLevel> m_levels;  ///< Innermost last, empty for the screen
+    std::vector<uint32> m_order;  ///< Sorted indices (ties keep submission order)
+    int32 m_layer;
+    RenderBlend m_blend;  ///< Last blend mode forwarded to the backend
+    DrawCommandStats m_frameStats;
+    DrawCommandStats m_lastFrameStats;
+};
+
+}  // namespace deadcode
@@ -0,0 +1,148 @@
+/**
+ * @file Easing.hpp
+ * @brief Easing curves, selected by enum
+ *
+ * Tweens store an EasingType instead of a std::function, so evaluating a
+ * curve is a switch over a handful of arithmetic instructions. Back and
+ * bounce are plain polynomials; expo and elastic, which need exp2 and sin,
+ * can also be read from precomputed tables.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-03
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+namespace deadcode
+{
+
+/**
+ * @brief Easing curve of a tween
+ *
+ * Same order as the functions in the Easing namespace.
+ */
+enum class EasingType : uint8
+{
+    Linear,
+    InQuad,
+    OutQuad,
+    InOutQuad,
+    InCubic,
+    OutCubic,
+    InOutCubic,
+    InQuart,
+    OutQuart,
+    InOutQuart,
+    InQuint,
+    OutQuint,
+    InOutQuint,
+    InSine,
+    OutSine,
+    InOutSine,
+    InExpo,
+    OutExpo,
+    InOutExpo,
+    InCirc,
+    OutCirc,
+    InOutCirc,
+    InElastic,
+    OutElastic,
+    InOutElastic,
+    InBack,
+    OutBack,
+    InOutBack,
+    OutBounce,
+    InBounce,
+    InOutBounce,
+    Count
+};
+
+namespace Easing
+{
+float32 linear(float32 t);
+
+// Quadratic easing
+float32 easeInQuad(float32 t);
+float32 easeOutQuad(float32 t);
+float32 easeInOutQuad(float32 t);
+
+// Cubic easing
+float32 easeInCubic(float32 t);
+float32 easeOutCubic(float32 t);
+float32 easeInOutCubic(float32 t);
+
+// Quartic easing
+float32 easeInQuart(float32 t);
+float32 easeOutQuart(float32 t);
+float32 easeInOutQuart(float32 t);
+
+// Quintic easing
+float32 easeInQuint(float32 t);
+float32 easeOutQuint(float32 t);
+float32 easeInOutQuint(float32 t);
+
+// Sinusoidal easing
+float32 easeInSine(float32 t);
+float32 easeOutSine(float32 t);
+float32 easeInOutSine(float32 t);
+
+// Exponential easing
+float32 easeInExpo(float32 t);
+float32 easeOutExpo(float32 t);
+float32 easeInOutExpo(float32 t);
+
+// Circular easing
+float32 easeInCirc(float32 t);
+float32 easeOutCirc(float32 t);
+float32 easeInOutCirc(float32 t);
+
+// Elastic easing
+float32 easeInElastic(float32 t);
+float32 easeOutElastic(float32 t);
+float32 easeInOutElastic(float32 t);
+
+// Back easing
+float32 easeInBack(float32 t);
+float32 easeOutBack(float32 t);
+float32 easeInOutBack(float32 t);
+
+// Bounce easing
+float32 easeOutBounce(float32 t);
+float32 easeInBounce(float32 t);
+float32 easeInOutBounce(float32 t);
+
+/// Intervals per table; 257 samples per curve, about 6 KB for all tables
+constexpr uint32 TABLE_SIZE = 256;
+
+/**
+ * @brief Evaluate a curve exactly
+ *
+ * @param type Easing curve
+ * @param t Progress (0-1)
+ * @return Eased progress; back and elastic overshoot 0-1
+ */
+float32 evaluate(EasingType type, float32 t);
+
+/**
+ * @brief Evaluate a curve, from its table if it has one
+ *
+ * Interpolates linearly between table samples of the expo and elastic
+ * curves; t is clamped to 0-1 and both ends are exact. The error against
+ * evaluate() stays below 1e-3, the worst case being the first interval of
+ * the expo curves, which jump at t = 0. Other curves are evaluated exactly.
+ *
+ * @param type Easing curve
+ * @param t Progress (0-1)
+ * @return Eased progress
+ */
+float32 sample(EasingType type, float32 t);
+
+/**
+ * @brief Check if sample() reads a curve from a table
+ */
+bool hasTable(EasingType type);
+}  // namespace Easing
+
+}  // namespace deadcode
@@ -0,0 +1,163 @@
+/**
+ * @file FontAtlasCache.hpp
+ * @brief Baked font atlas files
+ *
+ * Rasterizing a TTF (stb_truetype) is the slowest part of startup. A baked
+ * atlas stores the glyph metrics and the atlas image in one binary file
+ * next to the font, so later launches only map the file and upload the
+ * texture.
+ *
+ * File layout (native byte order, it is a local build artifact):
+ * - FileHeader
+ * - glyphCount GlyphRecord entries
+ * - atlas pixel data
+ *
+ * A cache file is only used when its header matches the FNV-1a hash of the
+ * font file, the font size, the atlas mode and the codepoint set.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-17
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+#include <raylib.h>
+
+#include <vector>
+
+namespace deadcode
+{
+
+class RenderBackend;
+
+/**
+ * @brief How the font atlas is rasterized
+ */
+enum class FontAtlasMode
+{
+    Bitmap,  ///< Plain coverage bitmap, crisp only near the load size
+    SDF      ///< Signed distance field, crisp at any scale (needs the SDF shader)
+};
+
+/**
+ * @brief Everything a baked atlas is versioned by
+ */
+struct FontAtlasKey
+{
+    uint64 fontHash{0};       ///< FNV-1a of the font file bytes
+    uint64 codepointHash{0};  ///< FNV-1a of the codepoint list
+    uint32 fontSize{0};
+    uint32 glyphCount{0};
+    FontAtlasMode mode{FontAtlasMode::Bitmap};
+};
+
+namespace FontAtlasCache
+{
+
+/// Bump whenever the file layout or the rasterization parameters change
+constexpr uint32 FORMAT_VERSION = 1;
+
+/// File extension of baked atlases
+constexpr const char* FILE_EXTENSION = ".fontatlas";
+
+/**
+ * @brief Codepoints rasterized by default (printable ASCII, as LoadFontEx)
+ */
+std::vector<int32> getDefaultCodepoints();
+
+/**
+ * @brief Path of the baked atlas for a font, size and mode
+ *
+ * e.g. assets/fonts/PixelOperator-Bold.52.sdf.fontatlas
+ */
+String getCachePath(const String& fontPath, uint32 fontSize, FontAtlasMode mode);
+
+/**
+ * @brief Build the cache key for a font
+ *
+ * @param fontData Font file bytes
+ * @param fontDataSize Number of bytes
+ * @param fontSize Font size in pixels
+ * @param mode Atlas mode
+ * @param codepoints Codepoints to rasterize
+ */
+FontAtlasKey makeKey(const uint8* fontData, size_t fontDataSize, uint32 fontSize,
+                     FontAtlasMode mode, const std::vector<int32>& codepoints);
+
+/**
+ * @brief Rasterize glyphs and pack them into an atlas image (CPU only)
+ *
+ * On success @p font has glyphs, recs and metrics but no texture yet.
+ *
+ * @param fontData Font file bytes
+ * @param fontDataSize Number of bytes
+ * @param fontSize Font size in pixels
+ * @param mode Atlas mode
+ * @param codepoints Codepoints to rasterize
+ * @param font Output font (without texture)
+ * @param atlas Output atlas image, owned by the caller
+ * @return true if successful
+ */
+bool rasterize(const uint8* fontData, size_t fontDataSize, uint32 fontSize, FontAtlasMode mode,
+               const std::vector<int32>& codepoints, Font& font, Image& atlas);
+
+/**
+ * @brief Write a baked atlas file
+ *
+ * The file is written under a temporary name and renamed into place, so a
+ * reader never sees a half-written cache.
+ *
+ * @return true if successful
+ */
+bool write(const String& cachePath, const FontAtlasKey& key, const Font& font,
+           const Image& atlas);
+
+/**
+ * @brief Load a baked atlas and upload its texture
+ *
+ * @param cachePath Path to the baked atlas
+ * @param key Expected key, the file is rejected if it does not match
+ * @param backend Backend that creates the atlas texture
+ * @param font Output font
+ * @return true if the cache was valid and loaded
+ */
+bool read(const String& cachePath, const FontAtlasKey& key, RenderBackend& backend, Font& font);
+
+/**
+ * @brief Rasterize a font and write its baked atlas without touching the GPU
+ *
+ * Used by the offline baking tool.
+ *
+ * @return true if the atlas is up to date or was written
+ */
+bool bake(const String& fontPath, uint32 fontSize, FontAtlasMode mode);
+
+/**
+ * @brief Load a font through its baked atlas, baking it first if it is stale
+ *
+ * Falls back to plain rasterization when the cache cannot be written.
+ *
+ * @param fontPath Path to TTF font file
+ * @param fontSize Font size in pixels
+ * @param mode Atlas mode
+ * @param backend Backend that creates the atlas texture
+ * @return Loaded font (texture id 0 on failure)
+ */
+Font loadFont(const String& fontPath, uint32 fontSize, FontAtlasMode mode,
+              RenderBackend& backend);
+
+/**
+ * @brief Release a font returned by loadFont()
+ *
+ * Use this instead of UnloadFont so the texture goes back to the backend
+ * that created it.
+ *
+ * @param font Font to release, reset to empty
+ * @param backend Backend the font was loaded with
+ */
+void unloadFont(Font& font, RenderBackend& backend);
+
+}  // namespace FontAtlasCache
+}  // namespace deadcode
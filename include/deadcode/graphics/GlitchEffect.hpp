@@ -12,6 +12,7 @@
 #pragma once
 
 #include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/QualityGovernor.hpp"
 
 #include <glm/glm.hpp>
 
@@ -53,6 +54,28 @@ struct CharacterGlitchState
     bool inSliceZone;           ///< Is character in a slice zone
 };
 
+/**
+ * @brief Glitch state for the GPU path (text_glitch.vert/.frag)
+ *
+ * Amounts are in pixels and already scaled for the screen resolution.
+ * Effects that are disabled in the configuration have a zero amount.
+ */
+struct GlitchShaderParams
+{
+    float32 time{0.0f};              ///< Effect clock (seconds)
+    float32 seed{0.0f};              ///< Noise seed of the current glitch
+    float32 intensity{0.0f};         ///< Current intensity (0-1)
+    float32 blockSize{0.0f};         ///< Fraction of the string displaced as one block
+    glm::vec2 jitter{0.0f};          ///< Max horizontal and vertical jitter
+    glm::vec2 slice{0.0f};           ///< Slice zone half-height (0-1) and max slice offset
+    float32 blockOffset{0.0f};       ///< Max block offset
+    glm::vec3 duplicate{0.0f};       ///< Duplication chance and max horizontal/vertical offset
+    glm::vec2 tint{0.0f};            ///< Chromatic aberration strength and RGB separation toggle
+    float32 channelSplit{0.0f};      ///< RGB channel split in the fragment stage
+    glm::vec3 glitchColor{0.0f};     ///< Glitch tint color
+    float32 corruptionChance{0.0f};  ///< Chance per glyph to be hidden
+};
+
 /**
  * @brief Glitch effect configuration
  */
@@ -101,6 +124,23 @@ struct GlitchConfig
     float32 chromaticIntensity = 1.5f;   ///< Chromatic aberration strength
 };
 
+/**
+ * @brief Time-varying part of a glitch effect
+ *
+ * Everything update() changes. Copying it to another GlitchEffect with
+ * the same config makes that one draw the same glitch, e.g. on a thread
+ * that only renders.
+ */
+struct GlitchState
+{
+    bool glitching{false};
+    float32 glitchTimer{0.0f};
+    float32 idleTimer{0.0f};
+    float32 intensity{0.0f};
+    float32 elapsedTime{0.0f};
+    uint32 noiseSeed{0};
+};
+
 /**
  * @brief Procedural glitch effect generator
  *
@@ -133,11 +173,42 @@ public:
      */
     void update(float32 deltaTime);
 
+    /**
+     * @brief Set how far past the last update the next frame is drawn
+     *
+     * The time-driven motion (waves, scanlines, shader time) is evaluated
+     * at that point, so it stays smooth when updates run at a fixed rate
+     * that differs from the display's.
+     *
+     * @param offset Seconds since the last update
+     */
+    void setRenderTimeOffset(float32 offset);
+
+    /**
+     * @brief Get the time-varying state
+     */
+    [[nodiscard]] GlitchState getState() const;
+
+    /**
+     * @brief Replace the time-varying state, e.g. with one from a simulation
+     */
+    void setState(const GlitchState& state);
+
     /**
      * @brief Reset glitch effect to initial state
      */
     void reset();
 
+    /**
+     * @brief Reseed the random source, for reproducible glitches
+     *
+     * initialize() seeds from std::random_device; a fixed seed makes
+     * the same updates produce the same glitches, e.g. in headless runs.
+     *
+     * @param seed Random seed
+     */
+    void setRandomSeed(uint32 seed);
+
     /**
      * @brief Get glitch state for a specific character
      * @param charIndex Character index in string
@@ -146,6 +217,13 @@ public:
      */
     CharacterGlitchState getCharacterState(uint32 charIndex, uint32 characterCount) const;
 
+    /**
+     * @brief Get the current state for evaluating the glitch in shaders
+     *
+     * Constant per string: per-character work moves to the vertex stage.
+     */
+    [[nodiscard]] GlitchShaderParams getShaderParams() const;
+
     /**
      * @brief Check if glitch is currently active
      * @return true if glitching
@@ -156,6 +234,14 @@ public:
         return m_isGlitching;
     }
 
+    /**
+     * @brief Get the time until the effect next changes what is drawn
+     *
+     * @return 0 while glitching, the remaining idle time otherwise, or a
+     *         negative value if the effect is disabled
+     */
+    [[nodiscard]] float32 getTimeUntilNextChange() const;
+
     /**
      * @brief Get current glitch intensity (0-1)
      * @return Intensity value
@@ -170,20 +256,16 @@ public:
      * @brief Set glitch configuration
      * @param config New configuration
      */
-    void
-    setConfig(const GlitchConfig& config)
-    {
-        m_config = config;
-    }
+    void setConfig(const GlitchConfig& config);
 
     /**
      * @brief Get current configuration
-     * @return Current glitch config
+     * @return Glitch config as set, without the tier limits
      */
     const GlitchConfig&
     getConfig() const
     {
-        return m_config;
+        return m_requestedConfig;
     }
 
     /**
@@ -193,7 +275,29 @@ public:
     void
     setEnabled(bool enabled)
     {
-        m_config.enabled = enabled;
+        m_requestedConfig.enabled = enabled;
+        m_config.enabled          = enabled;
+    }
+
+    /**
+     * @brief Limit the sub-effects to an effect tier
+     *
+     * Medium drops duplication and scanlines, low also drops slicing,
+     * blocks and chromatic aberration, minimal keeps only the jitter.
+     * The configuration set with setConfig() is kept and comes back at
+     * higher tiers.
+     *
+     * @param quality Effect tier
+     */
+    void setQuality(EffectQuality quality);
+
+    /**
+     * @brief Get the current effect tier
+     */
+    [[nodiscard]] EffectQuality
+    getQuality() const
+    {
+        return m_quality;
     }
 
     /**
@@ -208,20 +312,24 @@ public:
      */
     void setScreenSize(int32 width, int32 height);
 
-private:
-    /**
-     * @brief Generate random offset for character
-     * @return Random 2D offset
-     */
-    glm::vec2 generateRandomOffset() const;
-
     /**
      * @brief Generate noise value for character
+     *
+     * A hash, so the same index and seed always give the same value.
+     * Other effects use it for stable per-cell randomness.
+     *
      * @param charIndex Character index
      * @param seed Noise seed
      * @return Noise value (0-1)
      */
-    float32 generateNoise(uint32 charIndex, uint32 seed) const;
+    static float32 generateNoise(uint32 charIndex, uint32 seed);
+
+private:
+    /**
+     * @brief Generate random offset for character
+     * @return Random 2D offset
+     */
+    glm::vec2 generateRandomOffset() const;
 
     /**
      * @brief Calculate wave-based displacement
@@ -255,7 +363,19 @@ private:
      */
     std::pair<bool, glm::vec2> calculateDuplication(uint32 charIndex) const;
 
-    GlitchConfig m_config;
+    /**
+     * @brief Rebuild the active config from the requested one and the tier
+     */
+    void applyQuality();
+
+    /**
+     * @brief Get the time the current frame is drawn at
+     */
+    [[nodiscard]] float32 getRenderTime() const;
+
+    GlitchConfig m_config;           ///< Active config, sub-effects limited by the tier
+    GlitchConfig m_requestedConfig;  ///< Config as set by the owner
+    EffectQuality m_quality;
     bool m_initialized;
 
     // State
@@ -264,6 +384,7 @@ private:
     float32 m_idleTimer;
     float32 m_currentIntensity;
     float32 m_elapsedTime;
+    float32 m_renderTimeOffset;  ///< Frame time past m_elapsedTime, for smooth motion
 
     // Procedural generation
     mutable std::mt19937 m_randomEngine;
@@ -0,0 +1,247 @@
+/**
+ * @file GlyphAtlas.hpp
+ * @brief On-demand glyph atlas with a font fallback chain
+ *
+ * The baked font atlas only covers printable ASCII. Any other codepoint
+ * is rasterized the first time it is drawn, from the first font in the
+ * fallback chain that has it, into fixed-size atlas pages. When every page
+ * is full the least recently used page is recycled, so memory stays
+ * bounded no matter how much of Unicode is drawn.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-18
+ */
+
+#pragma once
+
+#include "deadcode/core/MappedFile.hpp"
+#include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/FontAtlasCache.hpp"
+
+#include <raylib.h>
+
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace deadcode
+{
+
+class RenderBackend;
+
+/**
+ * @brief A glyph resident in an atlas page
+ *
+ * Metrics are in pixels at the atlas font size, like Raylib's GlyphInfo.
+ */
+struct AtlasGlyph
+{
+    uint32 page;       ///< Page holding the glyph image
+    Rectangle rec;     ///< Glyph rectangle in the page (zero size for blank glyphs)
+    float32 offsetX;   ///< Horizontal draw offset
+    float32 offsetY;   ///< Vertical draw offset
+    float32 advance;   ///< Horizontal advance
+};
+
+/**
+ * @brief Atlas counters
+ */
+struct GlyphAtlasStats
+{
+    uint32 pages{0};       ///< Pages currently allocated
+    uint32 glyphs{0};      ///< Glyphs currently resident
+    uint64 rasterized{0};  ///< Glyphs rasterized since configure()
+    uint64 evictions{0};   ///< Pages recycled since configure()
+};
+
+/**
+ * @brief Dynamic glyph atlas made of fixed-size, LRU-recycled pages
+ */
+class GlyphAtlas
+{
+public:
+    static constexpr int32 DEFAULT_PAGE_SIZE  = 512;
+    static constexpr uint32 DEFAULT_MAX_PAGES = 4;
+
+    /**
+     * @brief Constructor
+     *
+     * @param pageSize Width and height of each page in pixels
+     * @param maxPages Maximum number of pages kept alive
+     */
+    explicit GlyphAtlas(int32 pageSize = DEFAULT_PAGE_SIZE, uint32 maxPages = DEFAULT_MAX_PAGES);
+
+    /**
+     * @brief Destructor, releases the page textures
+     */
+    ~GlyphAtlas();
+
+    /**
+     * @brief Set the backend that owns the page textures
+     *
+     * Must be called before configure(). Releases pages made by a previous
+     * backend.
+     */
+    void setBackend(RenderBackend* backend);
+
+    /**
+     * @brief Set the primary font and rasterization parameters
+     *
+     * Drops every resident glyph. Fallback fonts are kept.
+     *
+     * @param fontPath Primary font, first in the fallback chain
+     * @param fontSize Rasterization size (the primary atlas base size)
+     * @param glyphPadding Transparent border kept around each glyph
+     * @param mode Bitmap or SDF glyphs, matching the primary atlas
+     * @return true if the primary font could be opened
+     */
+    bool configure(const String& fontPath, uint32 fontSize, int32 glyphPadding,
+                   FontAtlasMode mode);
+
+    /**
+     * @brief Append a font to the fallback chain
+     *
+     * @param fontPath Path to TTF/OTF font file
+     * @return true if the font could be opened
+     */
+    bool addFallbackFont(const String& fontPath);
+
+    /**
+     * @brief Start a new frame (pages used this frame are recycled last)
+     */
+    void beginFrame();
+
+    /**
+     * @brief Get a glyph, rasterizing it into a page on first use
+     *
+     * The returned pointer is only valid until the next call.
+     *
+     * @param codepoint Unicode codepoint
+     * @return Glyph or nullptr if no font in the chain has it
+     */
+    const AtlasGlyph* acquire(int32 codepoint);
+
+    /**
+     * @brief Check whether a font in the chain has a codepoint
+     *
+     * Reads the fonts' character maps only: nothing is rasterized and no
+     * page is touched, so it is safe to call while quads are queued.
+     *
+     * @param codepoint Unicode codepoint
+     * @return true if a font in the chain maps the codepoint to a glyph
+     */
+    [[nodiscard]] bool covers(int32 codepoint) const;
+
+    /**
+     * @brief Get the advance of a codepoint without rasterizing it
+     *
+     * Resident glyphs answer from the atlas, others from the horizontal
+     * metrics of the first font in the chain that has them. Like covers(),
+     * no page is touched.
+     *
+     * @param codepoint Unicode codepoint
+     * @param outAdvance Receives the unscaled advance in pixels
+     * @return true if a font in the chain has the codepoint
+     */
+    bool measure(int32 codepoint, float32& outAdvance) const;
+
+    /**
+     * @brief Get the texture of a page
+     */
+    [[nodiscard]] const Texture2D& getPageTexture(uint32 page) const;
+
+    /**
+     * @brief Set the function called before a page drawn this frame is recycled
+     *
+     * The renderer flushes its queued quads here, so they are drawn before
+     * the page is overwritten.
+     */
+    void setEvictionCallback(std::function<void()> callback);
+
+    /**
+     * @brief Release all pages and fonts
+     */
+    void release();
+
+    /**
+     * @brief Get atlas counters
+     */
+    [[nodiscard]] GlyphAtlasStats getStats() const;
+
+    // Delete copy constructor and assignment
+    GlyphAtlas(const GlyphAtlas&)            = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+private:
+    /**
+     * @brief Atlas page with a simple shelf packer
+     */
+    struct Page
+    {
+        Texture2D texture{};
+        int32 cursorX{0};
+        int32 shelfY{0};
+        int32 shelfHeight{0};
+        uint64 lastUsedFrame{0};
+        std::vector<int32> codepoints;  ///< Resident glyphs, dropped when the page is recycled
+    };
+
+    /**
+     * @brief Rasterize a codepoint from the first font that has it
+     *
+     * @return true if a font in the chain has the codepoint
+     */
+    bool rasterize(int32 codepoint);
+
+    /**
+     * @brief Find room for a rectangle, recycling the LRU page if needed
+     *
+     * @return true if room was found
+     */
+    bool allocate(int32 width, int32 height, uint32& outPage, int32& outX, int32& outY);
+
+    /**
+     * @brief Try to place a rectangle on one page
+     */
+    bool placeOnPage(Page& page, int32 width, int32 height, int32& outX, int32& outY) const;
+
+    /**
+     * @brief Create a new blank page
+     */
+    void addPage();
+
+    /**
+     * @brief Drop all glyphs of a page and clear it
+     */
+    void recyclePage(uint32 page);
+
+    /**
+     * @brief Unload every page texture and forget all resident glyphs
+     */
+    void releasePages();
+
+    RenderBackend* m_backend;
+    int32 m_pageSize;
+    uint32 m_maxPages;
+    uint32 m_fontSize;
+    int32 m_glyphPadding;
+    FontAtlasMode m_mode;
+
+    std::vector<MappedFile> m_fonts;  ///< Fallback chain, primary font first
+    std::vector<Page> m_pages;
+    std::unordered_map<int32, AtlasGlyph> m_glyphs;
+    std::unordered_set<int32> m_missing;  ///< Codepoints no font in the chain has
+    std::vector<int32> m_blankGlyphs;     ///< Resident glyphs without an image, in no page
+
+    /// Answers of covers(), bounded like m_missing
+    mutable std::unordered_map<int32, bool> m_coverage;
+    /// Answers of measure() for glyphs not resident yet, bounded like m_missing
+    mutable std::unordered_map<int32, float32> m_advances;
+
+    uint64 m_frame;
+    GlyphAtlasStats m_stats;
+    std::function<void()> m_evictionCallback;
+};
+
+}  // namespace deadcode
@@ -0,0 +1,138 @@
+/**
+ * @file GlyphBatch.hpp
+ * @brief Deferred glyph quad batching
+ *
+ * Collects glyph quads for a whole frame, grouped by atlas texture and
+ * shader, and submits them in a single draw call per atlas.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-14
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+#include <raylib.h>
+
+#include <vector>
+
+namespace deadcode
+{
+
+/**
+ * @brief Single glyph vertex (position, texture coordinate, color)
+ */
+struct GlyphVertex
+{
+    float32 x;
+    float32 y;
+    float32 u;
+    float32 v;
+    Color color;
+};
+
+/**
+ * @brief Counters for one flush of the glyph batch
+ */
+struct GlyphBatchStats
+{
+    uint32 quads{0};      ///< Glyph quads submitted
+    uint32 drawCalls{0};  ///< GPU draw calls issued (one per atlas texture and shader)
+};
+
+/**
+ * @brief Per-frame glyph quad accumulator
+ *
+ * Text renderers push glyph quads into per-texture vertex streams during
+ * the frame. flush() uploads every stream through a dedicated rlgl render
+ * batch sized to hold the whole frame, so the number of draw calls depends
+ * only on how many atlases were used, not on how much text was drawn.
+ * Streams that need a custom shader (e.g. SDF atlases) are submitted in
+ * one batch per shader.
+ */
+class GlyphBatch
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    GlyphBatch();
+
+    /**
+     * @brief Destructor, releases the render batch
+     */
+    ~GlyphBatch();
+
+    /**
+     * @brief Queue a textured quad
+     *
+     * @param texture Atlas texture the quad samples from
+     * @param dest Destination rectangle in screen coordinates
+     * @param source Source rectangle in atlas pixels
+     * @param color Vertex color
+     * @param shader Shader to draw with (id 0 uses raylib's default shader)
+     */
+    void addQuad(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                 Color color, const ::Shader& shader = ::Shader{});
+
+    /**
+     * @brief Submit all queued quads and clear the streams
+     *
+     * @return Counters for this flush
+     */
+    GlyphBatchStats flush();
+
+    /**
+     * @brief Drop all queued quads without drawing them
+     */
+    void clear();
+
+    /**
+     * @brief Release GPU resources
+     */
+    void release();
+
+    /**
+     * @brief Check if there is nothing to draw
+     */
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * @brief Get number of queued quads
+     */
+    [[nodiscard]] uint32 getQuadCount() const;
+
+    // Delete copy constructor and assignment
+    GlyphBatch(const GlyphBatch&)            = delete;
+    GlyphBatch& operator=(const GlyphBatch&) = delete;
+
+private:
+    /**
+     * @brief Vertex stream for one atlas texture and shader
+     */
+    struct Stream
+    {
+        uint32 textureId{0};
+        ::Shader shader{};
+        std::vector<GlyphVertex> vertices;
+    };
+
+    /**
+     * @brief Find or create the stream for a texture and shader
+     */
+    Stream& getStream(uint32 textureId, const ::Shader& shader);
+
+    /**
+     * @brief Make sure the render batch can hold the given number of quads
+     */
+    void reserveBatch(uint32 quadCount);
+
+    std::vector<Stream> m_streams;
+    uint32 m_quadCount;
+
+    struct BatchStorage;
+    UniquePtr<BatchStorage> m_storage;
+};
+
+}  // namespace deadcode
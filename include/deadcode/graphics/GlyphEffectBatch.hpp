@@ -0,0 +1,144 @@
+/**
+ * @file GlyphEffectBatch.hpp
+ * @brief Glyph quad batching for effect shaders
+ *
+ * Like GlyphBatch, but every vertex also carries GlyphEffectAttributes.
+ * rlgl's render batch only has position, texture coordinate, normal and
+ * color streams, so effect glyphs live in a vertex array of their own.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-23
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/GlyphBatch.hpp"
+#include "deadcode/graphics/RenderBackend.hpp"
+
+#include <raylib.h>
+
+#include <vector>
+
+namespace deadcode
+{
+
+/**
+ * @brief Effect glyph vertex (position, texture coordinate, color, effect attributes)
+ */
+struct GlyphEffectVertex
+{
+    float32 x;
+    float32 y;
+    float32 u;
+    float32 v;
+    Color color;
+    GlyphEffectAttributes attributes;
+};
+
+/**
+ * @brief Per-frame accumulator for effect glyph quads
+ *
+ * Quads are grouped by atlas texture and shader. flush() uploads all of
+ * them into one vertex buffer and issues one draw per group. The shader
+ * gets its matrix and atlas sampler from the standard "mvp" and
+ * "texture0" uniforms and reads the vertex streams at these locations:
+ *
+ * - 0: vec2 position
+ * - 1: vec2 texture coordinate
+ * - 3: vec4 color
+ * - 6: vec4 glyph index, slice, block id, intensity
+ * - 7: vec4 time, seed, copy flag, reserved
+ * - 8: vec4 jitter x/y, slice zone, slice offset
+ * - 9: vec4 duplicate chance, ghost offset x/y, block offset
+ * - 10: vec4 glitch color, corruption chance
+ * - 11: vec4 aberration, separation, channel split, sdf flag
+ */
+class GlyphEffectBatch
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    GlyphEffectBatch();
+
+    /**
+     * @brief Destructor, releases the vertex buffer
+     */
+    ~GlyphEffectBatch();
+
+    /**
+     * @brief Queue a textured quad
+     *
+     * @param texture Atlas texture the quad samples from
+     * @param dest Destination rectangle in screen coordinates
+     * @param source Source rectangle in atlas pixels
+     * @param color Vertex color
+     * @param shader Effect shader
+     * @param attributes Effect attributes shared by the four corners
+     */
+    void addQuad(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                 Color color, const ::Shader& shader, const GlyphEffectAttributes& attributes);
+
+    /**
+     * @brief Submit all queued quads and clear the streams
+     *
+     * @return Counters for this flush
+     */
+    GlyphBatchStats flush();
+
+    /**
+     * @brief Drop all queued quads without drawing them
+     */
+    void clear();
+
+    /**
+     * @brief Release GPU resources
+     */
+    void release();
+
+    /**
+     * @brief Check if there is nothing to draw
+     */
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * @brief Get number of queued quads
+     */
+    [[nodiscard]] uint32 getQuadCount() const;
+
+    // Delete copy constructor and assignment
+    GlyphEffectBatch(const GlyphEffectBatch&)            = delete;
+    GlyphEffectBatch& operator=(const GlyphEffectBatch&) = delete;
+
+private:
+    /**
+     * @brief Vertex stream for one atlas texture and shader
+     */
+    struct Stream
+    {
+        uint32 textureId{0};
+        ::Shader shader{};
+        std::vector<GlyphEffectVertex> vertices;
+    };
+
+    /**
+     * @brief Find or create the stream for a texture and shader
+     */
+    Stream& getStream(uint32 textureId, const ::Shader& shader);
+
+    /**
+     * @brief Make sure the vertex buffer can hold the given number of vertices
+     */
+    void reserveBuffer(uint32 vertexCount);
+
+    std::vector<Stream> m_streams;
+    std::vector<GlyphEffectVertex> m_upload;  ///< All streams back to back, reused every flush
+    uint32 m_quadCount;
+
+    uint32 m_vertexArray;
+    uint32 m_vertexBuffer;
+    uint32 m_capacity;  ///< Vertices the buffer holds
+};
+
+}  // namespace deadcode
@@ -0,0 +1,204 @@
+/**
+ * @file GlyphParticleSystem.hpp
+ * @brief Data-oriented particle system for glyphs
+ *
+ * Characters that shatter, drift and reassemble (combat hits, corrupted
+ * text, the logo reveal) are glyph particles. They live in parallel arrays
+ * rather than one object per particle, so the update is a few tight loops
+ * the compiler vectorizes and rendering hands whole arrays to the
+ * TextRenderer.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-28
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+#include <glm/glm.hpp>
+#include <raylib.h>
+
+#include <random>
+#include <vector>
+
+namespace deadcode
+{
+
+class TextRenderer;
+
+/**
+ * @brief How particles of one emit call start and move
+ *
+ * With homePull at 0 the particles fly off and fade (shatter). With a
+ * positive homePull they are pulled back to where their glyph sits in the
+ * text, so a scattered string reassembles; combine it with scatter to
+ * start them away from home.
+ */
+struct GlyphBurst
+{
+    glm::vec2 velocity{0.0f, 0.0f};  ///< Launch velocity shared by all particles (px/s)
+    float32 speed{150.0f};           ///< Random extra speed in a random direction (px/s)
+    float32 scatter{0.0f};           ///< Random start offset from the glyph position (px)
+    float32 homePull{0.0f};          ///< Spring rate toward the glyph position (1/s^2)
+    float32 lifetime{1.5f};          ///< Seconds a particle lives
+    float32 lifetimeJitter{0.5f};    ///< Random extra lifetime (seconds)
+    float32 fadeOut{1.0f};           ///< Alpha fades to 0 over the last seconds of life
+};
+
+/**
+ * @brief Particle counters
+ */
+struct GlyphParticleStats
+{
+    uint32 alive{0};
+    uint64 spawned{0};
+    uint64 dropped{0};           ///< Emits refused because the system was full
+    float32 lastUpdateMs{0.0f};  ///< Duration of the last update()
+};
+
+/**
+ * @brief Fixed-capacity glyph particle system
+ *
+ * Storage is allocated once; a full system drops new particles instead of
+ * growing. Dead particles are swap-removed after each update, so the live
+ * particles are always the first getCount() elements of every array.
+ *
+ * Not thread-safe: emit, update and render from the same thread.
+ */
+class GlyphParticleSystem
+{
+public:
+    static constexpr uint32 DEFAULT_CAPACITY = 50000;
+
+    /**
+     * @brief Constructor
+     *
+     * @param capacity Maximum number of live particles
+     */
+    explicit GlyphParticleSystem(uint32 capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Spawn a single glyph particle
+     *
+     * @param codepoint Unicode codepoint
+     * @param x Pen X position the glyph belongs at
+     * @param y Pen Y position the glyph belongs at
+     * @param scale Text scale factor
+     * @param color Glyph color (alpha is honored)
+     * @param burst Launch parameters
+     * @return true if the particle was spawned
+     */
+    bool emit(int32 codepoint, float32 x, float32 y, float32 scale, Color color,
+              const GlyphBurst& burst);
+
+    /**
+     * @brief Spawn one particle per visible glyph of a string
+     *
+     * The particles start at the glyph positions the string has when drawn
+     * with TextRenderer::renderText() at the same arguments.
+     *
+     * @param textRenderer Renderer that shapes the string
+     * @param text Text string
+     * @param x X position in screen coordinates
+     * @param y Y position in screen coordinates
+     * @param scale Text scale factor
+     * @param color Text color (RGB, each 0-1)
+     * @param burst Launch parameters
+     * @return Number of particles spawned
+     */
+    uint32 emitText(const TextRenderer& textRenderer, const String& text, float32 x, float32 y,
+                    float32 scale, const glm::vec3& color, const GlyphBurst& burst);
+
+    /**
+     * @brief Advance all particles and remove the dead ones
+     *
+     * @param deltaTime Time since last update (seconds)
+     */
+    void update(float32 deltaTime);
+
+    /**
+     * @brief Draw all live particles
+     *
+     * @param textRenderer Renderer the glyphs are queued on
+     */
+    void render(TextRenderer* textRenderer);
+
+    /**
+     * @brief Remove all particles
+     */
+    void clear();
+
+    /**
+     * @brief Set the acceleration applied to every particle
+     *
+     * @param gravity Acceleration (px/s^2)
+     */
+    void setGravity(const glm::vec2& gravity);
+
+    /**
+     * @brief Set the velocity damping
+     *
+     * @param drag Fraction of velocity lost per second, as a rate (1/s)
+     */
+    void setDrag(float32 drag);
+
+    /**
+     * @brief Get the number of live particles
+     */
+    [[nodiscard]] uint32 getCount() const;
+
+    /**
+     * @brief Get the maximum number of live particles
+     */
+    [[nodiscard]] uint32 getCapacity() const;
+
+    /**
+     * @brief Get particle counters
+     */
+    [[nodiscard]] const GlyphParticleStats& getStats() const;
+
+    // Delete copy constructor and assignment
+    GlyphParticleSystem(const GlyphParticleSystem&)            = delete;
+    GlyphParticleSystem& operator=(const GlyphParticleSystem&) = delete;
+
+private:
+    /**
+     * @brief Swap-remove particles whose life ran out
+     */
+    void removeDead();
+
+    /**
+     * @brief Move the particle at from into slot to
+     */
+    void moveParticle(uint32 from, uint32 to);
+
+    uint32 m_capacity;
+    uint32 m_count;
+
+    // One array per attribute, indexed by particle
+    std::vector<float32> m_x;
+    std::vector<float32> m_y;
+    std::vector<float32> m_velocityX;
+    std::vector<float32> m_velocityY;
+    std::vector<float32> m_homeX;  ///< Where the glyph sits in its text
+    std::vector<float32> m_homeY;
+    std::vector<float32> m_homePull;
+    std::vector<float32> m_life;      ///< Seconds left
+    std::vector<float32> m_fadeRate;  ///< 1 / fade-out time
+    std::vector<float32> m_scale;
+    std::vector<int32> m_codepoint;
+    std::vector<Color> m_color;
+
+    std::vector<Color> m_drawColors;  ///< m_color with the fade applied, rebuilt by render()
+
+    glm::vec2 m_gravity;
+    float32 m_drag;
+
+    std::mt19937 m_randomEngine;
+    std::uniform_real_distribution<float32> m_distribution;
+
+    GlyphParticleStats m_stats;
+};
+
+}  // namespace deadcode
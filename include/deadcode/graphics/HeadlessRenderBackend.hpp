@@ -0,0 +1,175 @@
+/**
+ * @file HeadlessRenderBackend.hpp
+ * @brief Render backend that records draw commands instead of drawing
+ *
+ * Needs no window, GL context or GPU. Textures and shaders are handed out
+ * as ids only. Every glyph and rectangle is appended to a compact command
+ * buffer, split into frames, which can be dumped as text for golden file
+ * comparison or reduced to a checksum.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-21
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/RenderBackend.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace deadcode
+{
+
+/**
+ * @brief Recorded command kinds
+ */
+enum class RenderCommandType : uint8
+{
+    Glyph,
+    Rectangle,
+    Texture  ///< Textured quad, e.g. a composited render texture
+};
+
+/**
+ * @brief One recorded draw command
+ */
+struct RenderCommand
+{
+    RenderCommandType type;
+    Color color;
+    int32 codepoint;   ///< Glyph codepoint (0 otherwise)
+    uint32 textureId;  ///< Texture sampled (0 for rectangles)
+    uint32 shaderId;   ///< Shader (0 for the default)
+    float32 x;         ///< Destination rectangle in screen coordinates
+    float32 y;
+    float32 width;
+    float32 height;
+};
+
+/**
+ * @brief Headless command-recording render backend
+ */
+class HeadlessRenderBackend : public RenderBackend
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    HeadlessRenderBackend();
+
+    [[nodiscard]] RenderBackendType getType() const override;
+    [[nodiscard]] bool supportsRenderTargets() const override;
+
+    Texture2D loadTexture(const Image& image, bool bilinear) override;
+    void updateTexture(const Texture2D& texture, const Rectangle& region,
+                       const void* pixels) override;
+    void unloadTexture(const Texture2D& texture) override;
+    RenderTexture2D loadRenderTarget(int32 width, int32 height, bool bilinear) override;
+    void unloadRenderTarget(const RenderTexture2D& target) override;
+    ::Shader loadShader(const char* vertexPath, const char* fragmentPath) override;
+    void unloadShader(const ::Shader& shader) override;
+
+    void beginFrame(Color clearColor) override;
+    void endFrame() override;
+
+    void beginRenderTarget(const RenderTexture2D& target, float32 viewWidth,
+                           float32 viewHeight) override;
+    void endRenderTarget() override;
+    void clearRenderTarget(Color color) override;
+    void setBlendMode(RenderBlend blend) override;
+
+    void drawGlyph(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                   Color color, const ::Shader& shader, int32 codepoint) override;
+    void drawEffectGlyph(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                         Color color, const ::Shader& shader,
+                         const GlyphEffectAttributes& attributes, int32 codepoint) override;
+    void drawTexture(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                     Color color, RenderBlend blend) override;
+    void drawShadedTexture(const Texture2D& texture, const Rectangle& dest,
+                           const Rectangle& source, const ::Shader& shader) override;
+    int32 getShaderLocation(const ::Shader& shader, const char* uniformName) override;
+    void setShaderValue(const ::Shader& shader, int32 location, const void* value,
+                        int32 uniformType, int32 count) override;
+    void drawRectangle(const Rectangle& rect, Color color) override;
+
+    /**
+     * @brief Count the draw calls a GPU backend would have issued
+     *
+     * @return One per distinct texture and shader queued since the last flush
+     */
+    uint32 flush() override;
+    uint32 flushAll() override;
+
+    /**
+     * @brief Enable or disable storing commands
+     *
+     * With recording off only the counters advance, which is what
+     * benchmarks running thousands of frames want.
+     */
+    void setRecording(bool recording);
+
+    /**
+     * @brief Drop all recorded commands and frames
+     */
+    void clear();
+
+    /**
+     * @brief Get all recorded commands, in draw order
+     */
+    [[nodiscard]] const std::vector<RenderCommand>& getCommands() const;
+
+    /**
+     * @brief Get the number of completed frames recorded
+     */
+    [[nodiscard]] uint32 getFrameCount() const;
+
+    /**
+     * @brief Get the commands of one recorded frame
+     *
+     * @param frame Frame index
+     * @param outCount Number of commands in the frame
+     * @return First command of the frame, or nullptr if out of range
+     */
+    const RenderCommand* getFrame(uint32 frame, size_t& outCount) const;
+
+    /**
+     * @brief Get the total number of commands seen, recorded or not
+     */
+    [[nodiscard]] uint64 getCommandCount() const;
+
+    /**
+     * @brief Hash the recorded commands
+     *
+     * Positions are quantized to 1/64 pixel so float noise does not change
+     * the result.
+     */
+    [[nodiscard]] uint64 getChecksum() const;
+
+    /**
+     * @brief Write the recorded frames as text, one command per line
+     *
+     * @param path Output file
+     * @return true if written
+     */
+    bool dump(const String& path) const;
+
+private:
+    /**
+     * @brief Append a command if recording
+     */
+    void record(const RenderCommand& command);
+
+    std::vector<RenderCommand> m_commands;
+    std::vector<size_t> m_frameEnds;  ///< Command count at the end of each frame
+    std::vector<std::pair<uint32, uint32>> m_pendingStreams;  ///< Texture/shader since flush
+
+    uint32 m_nextTextureId;
+    uint32 m_nextShaderId;
+    uint64 m_commandCount;
+    bool m_recording;
+    bool m_inFrame;
+};
+
+}  // namespace deadcode
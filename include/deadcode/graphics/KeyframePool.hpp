@@ -0,0 +1,194 @@
+/**
+ * @file KeyframePool.hpp
+ * @brief Structure-of-arrays storage for keyframe animations of one value type
+ *
+ * The keyframe counterpart of TweenPool: the AnimationSystem keeps one pool
+ * per value type, rows are kept dense by swap-removal, and advance()
+ * samples every track at its new time in a single loop.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-06
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/KeyframeTrack.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace deadcode
+{
+
+/**
+ * @brief Dense pool of keyframe animations of value type T
+ *
+ * Same row and slot rules as TweenPool, so the AnimationSystem drives
+ * both through one handle table.
+ *
+ * @tparam T float32, glm::vec2, glm::vec3 or glm::vec4
+ */
+template <typename T>
+struct KeyframePool
+{
+    std::vector<KeyframeTrack<T>> track;
+    std::vector<T> value;           ///< Value as of the last advance()
+    std::vector<float32> elapsed;   ///< Seconds into the track, wrapped when looping
+    std::vector<float32> duration;  ///< Time of the track's last key
+    std::vector<float32> progress;  ///< 0-1, 1 once finished
+    std::vector<uint32> cursor;     ///< Segment of the last sample
+    std::vector<uint8> loop;        ///< Nonzero to start over at the end
+    std::vector<uint32> target;     ///< Bound target handle, 0 for none
+    std::vector<uint32> slot;       ///< Owning slot in the system's handle table
+    std::vector<std::function<void()>> onComplete;
+
+    /**
+     * @brief Reserve rows so that many animations run without allocating
+     */
+    void
+    reserve(size_t capacity)
+    {
+        track.reserve(capacity);
+        value.reserve(capacity);
+        elapsed.reserve(capacity);
+        duration.reserve(capacity);
+        progress.reserve(capacity);
+        cursor.reserve(capacity);
+        loop.reserve(capacity);
+        target.reserve(capacity);
+        slot.reserve(capacity);
+        onComplete.reserve(capacity);
+    }
+
+    /**
+     * @brief Append an animation
+     *
+     * @return Row of the new animation
+     */
+    uint32
+    add(uint32 owner, KeyframeTrack<T> keys, bool looping, uint32 boundTarget,
+        std::function<void()> callback)
+    {
+        uint32 first = 0;
+        value.push_back(keys.sample(0.0f, first));
+        duration.push_back(keys.getDuration());
+        track.push_back(std::move(keys));
+        elapsed.push_back(0.0f);
+        progress.push_back(0.0f);
+        cursor.push_back(first);
+        loop.push_back(looping ? 1 : 0);
+        target.push_back(boundTarget);
+        slot.push_back(owner);
+        onComplete.push_back(std::move(callback));
+        return size() - 1;
+    }
+
+    /**
+     * @brief Remove a row by moving the last row into it
+     *
+     * @param row Row to remove
+     * @return Slot of the row that moved into it, or row's own slot if none moved
+     */
+    uint32
+    remove(uint32 row)
+    {
+        uint32 last  = size() - 1;
+        uint32 moved = slot[last];
+        if (row != last)
+        {
+            track[row]      = std::move(track[last]);
+            value[row]      = value[last];
+            elapsed[row]    = elapsed[last];
+            duration[row]   = duration[last];
+            progress[row]   = progress[last];
+            cursor[row]     = cursor[last];
+            loop[row]       = loop[last];
+            target[row]     = target[last];
+            slot[row]       = slot[last];
+            onComplete[row] = std::move(onComplete[last]);
+        }
+
+        track.pop_back();
+        value.pop_back();
+        elapsed.pop_back();
+        duration.pop_back();
+        progress.pop_back();
+        cursor.pop_back();
+        loop.pop_back();
+        target.pop_back();
+        slot.pop_back();
+        onComplete.pop_back();
+        return moved;
+    }
+
+    /**
+     * @brief Advance every animation and sample its track
+     *
+     * @param deltaTime Time since last update (seconds)
+     */
+    void
+    advance(float32 deltaTime)
+    {
+        uint32 count = size();
+        for (uint32 i = 0; i < count; ++i)
+        {
+            setTime(i, elapsed[i] + deltaTime);
+        }
+    }
+
+    /**
+     * @brief Move one animation to a time and sample its track there
+     *
+     * @param row Row of the animation
+     * @param time Seconds from the animation start
+     */
+    void
+    setTime(uint32 row, float32 time)
+    {
+        float32 length = duration[row];
+        if (loop[row] && length > 0.0f)
+        {
+            // Wrapped, so a long-running loop keeps full float precision
+            elapsed[row]  = std::fmod(time, length);
+            progress[row] = elapsed[row] / length;
+        }
+        else
+        {
+            elapsed[row]  = time;
+            progress[row] = length > 0.0f ? std::clamp(time / length, 0.0f, 1.0f) : 1.0f;
+        }
+        value[row] = track[row].sample(elapsed[row], cursor[row]);
+    }
+
+    /**
+     * @brief Remove every row
+     */
+    void
+    clear()
+    {
+        track.clear();
+        value.clear();
+        elapsed.clear();
+        duration.clear();
+        progress.clear();
+        cursor.clear();
+        loop.clear();
+        target.clear();
+        slot.clear();
+        onComplete.clear();
+    }
+
+    /**
+     * @brief Get the number of animations
+     */
+    [[nodiscard]] uint32
+    size() const
+    {
+        return static_cast<uint32>(slot.size());
+    }
+};
+
+}  // namespace deadcode
@@ -0,0 +1,118 @@
+/**
+ * @file KeyframeTrack.hpp
+ * @brief Multi-key animation curves for float, vec2, vec3 and vec4 values
+ *
+ * A track is a sorted list of keys; each key says how the value travels
+ * to the next one: held (step), straight (linear), along a curve set by
+ * the keys' tangents (hermite), or straight but timed by a cubic bezier
+ * ease, the handles CSS and animation tools use.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-06
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace deadcode
+{
+
+/// How a key's value travels to the next key
+enum class KeyInterpolation : uint8
+{
+    Step,     ///< Hold the value until the next key
+    Linear,   ///< Straight line
+    Hermite,  ///< Cubic through the keys' tangents
+    Bezier    ///< Straight line, timed by the key's bezier handles
+};
+
+/**
+ * @brief One key of a track
+ *
+ * @tparam T float32, glm::vec2, glm::vec3 or glm::vec4
+ */
+template <typename T>
+struct Keyframe
+{
+    T value{};
+    T inTangent{};   ///< Hermite slope arriving at the key (units per second)
+    T outTangent{};  ///< Hermite slope leaving the key (units per second)
+
+    /// Bezier handles (x1, y1, x2, y2) in time/progress units, x clamped to 0-1
+    glm::vec4 bezier{0.0f, 0.0f, 1.0f, 1.0f};
+
+    KeyInterpolation interpolation{KeyInterpolation::Linear};
+};
+
+/**
+ * @brief Sorted keys of one value, sampled through a caller-held cursor
+ *
+ * Key times live in their own array, apart from the key data, so finding
+ * a segment only touches times. sample() starts from the segment the
+ * cursor points at: playing forward stays in it or moves to the next one
+ * in O(1), and anything else (a seek, a big step, a loop restart) falls
+ * back to a binary search.
+ *
+ * @tparam T float32, glm::vec2, glm::vec3 or glm::vec4
+ */
+template <typename T>
+class KeyframeTrack
+{
+public:
+    /**
+     * @brief Add a key
+     *
+     * Keys may be added in any order. A key added at the time of an
+     * existing one goes after it, so the value jumps there.
+     */
+    void addKey(float32 time, const T& value,
+                KeyInterpolation interpolation = KeyInterpolation::Linear);
+    void addKey(float32 time, const Keyframe<T>& key);
+
+    /**
+     * @brief Set the tangents of every key from its neighbours
+     *
+     * Catmull-Rom style: the slope through the previous and next key, one
+     * sided at the ends. Hermite segments then pass smoothly through all
+     * keys.
+     */
+    void computeTangents();
+
+    /// Remove every key
+    void clear();
+
+    /**
+     * @brief Get the value at a time, clamped to the first and last key
+     *
+     * @param time Seconds from the track start
+     * @param cursor Segment found by the previous call, updated; start at 0
+     */
+    [[nodiscard]] T sample(float32 time, uint32& cursor) const;
+
+    /**
+     * @brief Find the segment containing a time
+     *
+     * @param time Seconds from the track start
+     * @param cursor Segment to try first
+     * @return Key index i with time(i) <= time < time(i + 1), clamped to the keys
+     */
+    [[nodiscard]] uint32 findSegment(float32 time, uint32 cursor) const;
+
+    /// Get the time of the last key
+    [[nodiscard]] float32 getDuration() const;
+
+    [[nodiscard]] uint32 getKeyCount() const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+private:
+    std::vector<float32> m_times;     ///< Sorted
+    std::vector<Keyframe<T>> m_keys;  ///< Same order as m_times
+};
+
+}  // namespace deadcode
@@ -0,0 +1,212 @@
+/**
+ * @file PostProcess.hpp
+ * @brief Full-screen post-process chain at a reduced internal resolution
+ *
+ * The scene is drawn into an offscreen target sized to a fraction of the
+ * window, an ordered list of full-screen fragment passes (scanlines,
+ * chromatic aberration, bloom, ...) runs on it, and the result is scaled
+ * up to the window. Effects cost per internal pixel instead of per glyph.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-24
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/QualityGovernor.hpp"
+
+#include <raylib.h>
+
+#include <vector>
+
+namespace deadcode
+{
+
+class RenderBackend;
+
+/**
+ * @brief Pass quality, sent to the pass shader as the `quality` uniform
+ */
+enum class PostProcessQuality : int32
+{
+    Low    = 0,
+    Medium = 1,
+    High   = 2
+};
+
+/**
+ * @brief One full-screen pass
+ */
+struct PostProcessPassSettings
+{
+    String name;        ///< Pass name, for logging
+    String shaderPath;  ///< Fragment shader, used with Raylib's default vertex shader
+    bool enabled{true};
+    PostProcessQuality quality{PostProcessQuality::Medium};
+};
+
+/**
+ * @brief Post-process chain settings (graphics.post_processing in game.json)
+ */
+struct PostProcessSettings
+{
+    bool enabled{false};
+    float32 resolutionScale{1.0f};  ///< Internal resolution relative to the window
+    bool bilinearUpscale{true};     ///< Filter the upscale instead of repeating pixels
+    std::vector<PostProcessPassSettings> passes;  ///< Run in order
+};
+
+/**
+ * @brief Offscreen scene target plus ordered full-screen passes
+ *
+ * Needs a backend with render targets; on other backends isActive() is
+ * false and the renderer draws straight to the screen. Drawing between
+ * beginScene() and endScene() keeps using window coordinates, the view is
+ * stretched over the smaller target.
+ *
+ * Pass shaders receive `texture0` (the previous image), `resolution`
+ * (internal size in pixels), `time` (seconds) and `quality` (0-2).
+ */
+class PostProcessChain
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    PostProcessChain();
+
+    /**
+     * @brief Destructor, releases targets and shaders
+     */
+    ~PostProcessChain();
+
+    /**
+     * @brief Load the pass shaders
+     *
+     * A pass whose shader fails to load is skipped, the rest still run.
+     *
+     * @param backend Backend used for targets and shaders (not owned)
+     * @param settings Chain settings
+     * @return true if successful
+     */
+    bool initialize(RenderBackend* backend, const PostProcessSettings& settings);
+
+    /**
+     * @brief Release targets and shaders
+     */
+    void shutdown();
+
+    /**
+     * @brief Check if frames go through the chain
+     */
+    [[nodiscard]] bool isActive() const;
+
+    /**
+     * @brief Enable or disable the chain without reloading shaders
+     */
+    void setEnabled(bool enabled);
+
+    /**
+     * @brief Enable or disable one pass
+     *
+     * @param name Pass name (unknown names are ignored)
+     */
+    void setPassEnabled(const String& name, bool enabled);
+
+    /**
+     * @brief Limit pass quality to an effect tier
+     *
+     * Passes run at the lower of their configured quality and the tier;
+     * the minimal tier skips every pass and only scales the scene up.
+     */
+    void setEffectQuality(EffectQuality quality);
+
+    /**
+     * @brief Change the internal resolution
+     *
+     * Targets are recreated at the next beginScene().
+     *
+     * @param scale Internal resolution relative to the window (clamped to 0.25-1)
+     */
+    void setResolutionScale(float32 scale);
+
+    /**
+     * @brief Get the internal resolution relative to the window
+     */
+    [[nodiscard]] float32 getResolutionScale() const;
+
+    /**
+     * @brief Get the internal resolution in pixels
+     */
+    void getInternalSize(int32& width, int32& height) const;
+
+    /**
+     * @brief Redirect the frame into the scene target and clear it
+     *
+     * @param screenWidth Window width in pixels
+     * @param screenHeight Window height in pixels
+     * @param clearColor Scene background
+     * @return true if the scene target is bound
+     */
+    bool beginScene(int32 screenWidth, int32 screenHeight, Color clearColor);
+
+    /**
+     * @brief Run the enabled passes and draw the result over the window
+     */
+    void endScene();
+
+    // Delete copy constructor and assignment
+    PostProcessChain(const PostProcessChain&)            = delete;
+    PostProcessChain& operator=(const PostProcessChain&) = delete;
+
+private:
+    /**
+     * @brief Loaded pass
+     */
+    struct Pass
+    {
+        PostProcessPassSettings settings;
+        ::Shader shader{};
+        int32 resolutionLoc{-1};
+        int32 timeLoc{-1};
+        int32 qualityLoc{-1};
+    };
+
+    /**
+     * @brief Make sure both targets match the internal resolution
+     *
+     * @return false if a target could not be created
+     */
+    bool ensureTargets(int32 screenWidth, int32 screenHeight);
+
+    /**
+     * @brief Send a pass the quality allowed by the current tier
+     */
+    void applyQuality(const Pass& pass);
+
+    /**
+     * @brief Release both targets
+     */
+    void releaseTargets();
+
+    /**
+     * @brief Draw a render texture over the bound target, replacing its contents
+     *
+     * @param texture Source texture (stored bottom-up)
+     * @param dest Destination rectangle
+     * @param shader Pass shader, id 0 for a plain copy
+     */
+    void drawFullScreen(const Texture2D& texture, const Rectangle& dest, const ::Shader& shader);
+
+    RenderBackend* m_backend;
+    PostProcessSettings m_settings;
+    std::vector<Pass> m_passes;
+    EffectQuality m_effectQuality;
+    RenderTexture2D m_targets[2];  ///< Scene, then ping-pong between the two
+    int32 m_screenWidth;
+    int32 m_screenHeight;
+    bool m_sceneBound;
+};
+
+}  // namespace deadcode
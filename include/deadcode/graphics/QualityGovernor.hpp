@@ -0,0 +1,156 @@
+/**
+ * @file QualityGovernor.hpp
+ * @brief Dynamic resolution and effect quality governor
+ *
+ * Watches recent frame times and walks a ladder of quality levels (render
+ * scale plus effect tier) to keep frames inside a target frame time on
+ * weak machines. Missed frames push the level down; sustained headroom in
+ * the frame's own work pulls it back up.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-25
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+#include <vector>
+
+namespace deadcode
+{
+
+/**
+ * @brief Effect tier, from cheapest to full detail
+ *
+ * Each effect decides what a tier drops (glitch sub-effects, post pass
+ * quality, ...).
+ */
+enum class EffectQuality : int32
+{
+    Minimal = 0,
+    Low     = 1,
+    Medium  = 2,
+    High    = 3
+};
+
+/**
+ * @brief Get a tier name for logging
+ */
+const char* toString(EffectQuality quality);
+
+/**
+ * @brief Governor settings (graphics.rendering.dynamic_resolution in game.json)
+ */
+struct QualityGovernorSettings
+{
+    bool enabled{false};
+    float32 targetFrameTime{1.0f / 60.0f};  ///< Budget in seconds
+    float32 maxScale{1.0f};                 ///< Render scale at the top level
+    float32 minScale{0.5f};                 ///< Render scale never goes below this
+    float32 scaleStep{0.125f};              ///< Render scale change per level
+    EffectQuality maxQuality{EffectQuality::High};
+    uint32 sampleFrames{30};    ///< Frames looked at per decision
+    float32 downgradeAt{1.1f};  ///< Frame time over budget that counts as a miss
+    float32 upgradeAt{0.6f};    ///< Work time under budget needed to go up
+    uint32 cooldownFrames{60};  ///< Frames without decisions after a change
+};
+
+/**
+ * @brief One rung of the quality ladder
+ */
+struct QualityLevel
+{
+    float32 resolutionScale{1.0f};
+    EffectQuality effects{EffectQuality::High};
+};
+
+/**
+ * @brief Frame time governor
+ *
+ * Two signals keep it stable under vsync and frame limiting, where the
+ * frame interval never drops below the budget:
+ * - the frame interval, to detect missed frames and go down a level;
+ * - the frame's work time (interval minus presentation waits), to detect
+ *   headroom and go up a level.
+ *
+ * Hysteresis comes from the gap between the two thresholds, a cooldown
+ * after every change, and an upgrade backoff that doubles each time an
+ * upgrade has to be taken back soon after, so a level that cannot hold
+ * is not retried every second.
+ */
+class QualityGovernor
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    QualityGovernor();
+
+    /**
+     * @brief Build the quality ladder and start at the top level
+     *
+     * @param settings Governor settings
+     */
+    void initialize(const QualityGovernorSettings& settings);
+
+    /**
+     * @brief Record a frame
+     *
+     * @param frameTime Interval since the previous frame (seconds)
+     * @param workTime Time the frame was busy, waits excluded (seconds)
+     * @return true if the level changed
+     */
+    bool addFrame(float32 frameTime, float32 workTime);
+
+    /**
+     * @brief Forget recorded frames, e.g. after a pause or a resize
+     */
+    void resetSamples();
+
+    /**
+     * @brief Get the current level
+     */
+    [[nodiscard]] const QualityLevel& getLevel() const;
+
+    /**
+     * @brief Get the current level index (0 is the best)
+     */
+    [[nodiscard]] uint32 getLevelIndex() const;
+
+    /**
+     * @brief Get the number of levels in the ladder
+     */
+    [[nodiscard]] uint32 getLevelCount() const;
+
+    /**
+     * @brief Check if the governor makes decisions
+     */
+    [[nodiscard]] bool isEnabled() const;
+
+private:
+    /**
+     * @brief Build the ladder, alternating effect tier and render scale steps
+     */
+    void buildLevels();
+
+    /**
+     * @brief Move to another level and log why
+     */
+    void changeLevel(uint32 level, const char* reason, float32 measured);
+
+    QualityGovernorSettings m_settings;
+    std::vector<QualityLevel> m_levels;
+    std::vector<float32> m_frameTimes;  ///< Ring buffer of sampleFrames entries
+    std::vector<float32> m_workTimes;
+    uint32 m_sampleCount;
+    uint32 m_sampleIndex;
+    uint32 m_level;
+    uint32 m_cooldown;
+    uint64 m_frame;
+    uint64 m_lastUpgradeFrame;
+    uint64 m_upgradeBlockedUntil;
+    uint32 m_upgradeBackoff;  ///< Multiplier on the cooldown before the next upgrade
+};
+
+}  // namespace deadcode
@@ -0,0 +1,112 @@
+/**
+ * @file RaylibRenderBackend.hpp
+ * @brief Render backend drawing through Raylib
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-21
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/RenderBackend.hpp"
+
+#include <vector>
+
+namespace deadcode
+{
+
+class GlyphBatch;
+class GlyphEffectBatch;
+
+/**
+ * @brief Raylib/rlgl render backend
+ *
+ * Glyphs are accumulated in a GlyphBatch and submitted on flush() with one
+ * draw call per atlas texture and shader. Effect glyphs carry extra vertex
+ * attributes rlgl's batch has no room for and go through a GlyphEffectBatch.
+ * Render targets are kept on a stack so nested targets (a CellGrid inside
+ * the post-process scene) return to the right framebuffer.
+ */
+class RaylibRenderBackend : public RenderBackend
+{
+public:
+    /**
+     * @brief Constructor
+     */
+    RaylibRenderBackend();
+
+    /**
+     * @brief Destructor, releases the glyph batches
+     */
+    ~RaylibRenderBackend() override;
+
+    [[nodiscard]] RenderBackendType getType() const override;
+    [[nodiscard]] bool supportsRenderTargets() const override;
+
+    Texture2D loadTexture(const Image& image, bool bilinear) override;
+    void updateTexture(const Texture2D& texture, const Rectangle& region,
+                       const void* pixels) override;
+    void unloadTexture(const Texture2D& texture) override;
+    RenderTexture2D loadRenderTarget(int32 width, int32 height, bool bilinear) override;
+    void unloadRenderTarget(const RenderTexture2D& target) override;
+    ::Shader loadShader(const char* vertexPath, const char* fragmentPath) override;
+    void unloadShader(const ::Shader& shader) override;
+
+    void beginFrame(Color clearColor) override;
+    void endFrame() override;
+
+    void beginRenderTarget(const RenderTexture2D& target, float32 viewWidth,
+                           float32 viewHeight) override;
+    void endRenderTarget() override;
+    void clearRenderTarget(Color color) override;
+    void setBlendMode(RenderBlend blend) override;
+
+    void drawGlyph(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                   Color color, const ::Shader& shader, int32 codepoint) override;
+    void drawEffectGlyph(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                         Color color, const ::Shader& shader,
+                         const GlyphEffectAttributes& attributes, int32 codepoint) override;
+    void drawTexture(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                     Color color, RenderBlend blend) override;
+    void drawShadedTexture(const Texture2D& texture, const Rectangle& dest,
+                           const Rectangle& source, const ::Shader& shader) override;
+    int32 getShaderLocation(const ::Shader& shader, const char* uniformName) override;
+    void setShaderValue(const ::Shader& shader, int32 location, const void* value,
+                        int32 uniformType, int32 count) override;
+    void drawRectangle(const Rectangle& rect, Color color) override;
+    uint32 flush() override;
+    uint32 flushAll() override;
+
+    // Delete copy constructor and assignment
+    RaylibRenderBackend(const RaylibRenderBackend&)            = delete;
+    RaylibRenderBackend& operator=(const RaylibRenderBackend&) = delete;
+
+private:
+    /**
+     * @brief Render target on the target stack
+     */
+    struct BoundTarget
+    {
+        RenderTexture2D target;
+        float32 viewWidth;
+        float32 viewHeight;
+    };
+
+    /**
+     * @brief Bind a target and map its view onto it
+     */
+    static void bindTarget(const BoundTarget& bound);
+
+    /**
+     * @brief Switch Raylib's blend state
+     */
+    static void applyBlendMode(RenderBlend blend);
+
+    UniquePtr<GlyphBatch> m_glyphBatch;
+    UniquePtr<GlyphEffectBatch> m_effectBatch;
+    std::vector<BoundTarget> m_targets;  ///< Innermost last, empty when drawing to the screen
+    RenderBlend m_blend;                 ///< Set with setBlendMode()
+};
+
+}  // namespace deadcode
@@ -0,0 +1,317 @@
+/**
+ * @file RenderBackend.hpp
+ * @brief Abstract render backend interface
+ *
+ * Everything the engine draws goes through a RenderBackend: textures,
+ * shaders, glyph quads and rectangles. The Raylib backend talks to the
+ * GPU; the headless backend records draw commands in memory so menus and
+ * effects can run and be compared on machines without a display.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-21
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+#include <raylib.h>
+
+namespace deadcode
+{
+
+/**
+ * @brief Available render backends
+ */
+enum class RenderBackendType
+{
+    Raylib,   ///< Draws through Raylib/rlgl, needs a window and GL context
+    Headless  ///< Records draw commands, needs nothing
+};
+
+/**
+ * @brief How drawn pixels combine with the render target
+ */
+enum class RenderBlend : uint8
+{
+    Alpha,          ///< Straight alpha over the target, the default
+    Premultiplied,  ///< Source is premultiplied, e.g. a cached layer being composited
+    Premultiply,    ///< Straight alpha into a target that is kept premultiplied
+    Replace         ///< Overwrite the target, alpha included
+};
+
+/**
+ * @brief Per-glyph attributes read by text effect shaders
+ *
+ * Sent with every corner of a glyph quad as vertex attributes, so the
+ * vertex stage can displace and tint whole glyphs without per-glyph work
+ * on the CPU. The effect settings travel with the glyph as well, so
+ * strings drawn with different effects can share a batch.
+ */
+struct GlyphEffectAttributes
+{
+    float32 glyphIndex{0.0f};  ///< Glyph position in its string
+    float32 slice{0.0f};       ///< Position across the string (0-1), tested against slice zones
+    float32 blockId{0.0f};     ///< Block of glyphs displaced together
+    float32 intensity{0.0f};   ///< Effect intensity (0-1)
+    float32 time{0.0f};        ///< Effect clock in seconds
+    float32 seed{0.0f};        ///< Noise seed of the current effect trigger
+    float32 copy{0.0f};        ///< 1 for the ghost quad shown when the glyph duplicates
+    float32 reserved{0.0f};
+
+    // Effect settings, the same for every glyph of a string
+    float32 jitterX{0.0f};           ///< Max horizontal jitter (pixels)
+    float32 jitterY{0.0f};           ///< Max vertical jitter (pixels)
+    float32 sliceZone{0.0f};         ///< Slice zone half-height (0-1)
+    float32 sliceOffset{0.0f};       ///< Max slice offset (pixels)
+    float32 duplicateChance{0.0f};   ///< Chance of a ghost copy
+    float32 duplicateX{0.0f};        ///< Max ghost offset (pixels)
+    float32 duplicateY{0.0f};
+    float32 blockOffset{0.0f};       ///< Max block offset (pixels)
+    float32 glitchR{0.0f};           ///< Glitch tint color
+    float32 glitchG{0.0f};
+    float32 glitchB{0.0f};
+    float32 corruptionChance{0.0f};  ///< Chance per glyph to be hidden
+    float32 aberration{0.0f};        ///< Chromatic aberration strength
+    float32 separation{0.0f};        ///< 1 to tint RGB channels apart
+    float32 channelSplit{0.0f};      ///< RGB channel split (atlas texels)
+    float32 sdf{0.0f};               ///< 1 when the atlas stores distance fields
+};
+
+/**
+ * @brief Render backend interface
+ *
+ * Glyphs may be queued until flush(); rectangles are drawn in call order.
+ * Render textures (cached layers, CellGrid targets, the post-process scene)
+ * are only available when supportsRenderTargets() is true, callers draw
+ * directly otherwise.
+ */
+class RenderBackend
+{
+public:
+    virtual ~RenderBackend() = default;
+
+    /**
+     * @brief Get the backend type
+     */
+    [[nodiscard]] virtual RenderBackendType getType() const = 0;
+
+    /**
+     * @brief Check if render textures can be used with this backend
+     */
+    [[nodiscard]] virtual bool supportsRenderTargets() const = 0;
+
+    /**
+     * @brief Create a texture from an image
+     *
+     * @param image Source pixels
+     * @param bilinear Sample bilinearly instead of point filtering
+     * @return Texture (id 0 on failure)
+     */
+    virtual Texture2D loadTexture(const Image& image, bool bilinear) = 0;
+
+    /**
+     * @brief Replace part of a texture
+     *
+     * @param texture Texture to update
+     * @param region Region in pixels
+     * @param pixels Tightly packed pixels in the texture format
+     */
+    virtual void updateTexture(const Texture2D& texture, const Rectangle& region,
+                               const void* pixels) = 0;
+
+    /**
+     * @brief Release a texture
+     */
+    virtual void unloadTexture(const Texture2D& texture) = 0;
+
+    /**
+     * @brief Create a render texture
+     *
+     * Only valid when supportsRenderTargets().
+     *
+     * @param width Width in pixels
+     * @param height Height in pixels
+     * @param bilinear Sample bilinearly instead of point filtering
+     * @return Render texture (id 0 on failure)
+     */
+    virtual RenderTexture2D loadRenderTarget(int32 width, int32 height, bool bilinear) = 0;
+
+    /**
+     * @brief Release a render texture
+     */
+    virtual void unloadRenderTarget(const RenderTexture2D& target) = 0;
+
+    /**
+     * @brief Load a shader program
+     *
+     * @param vertexPath Vertex shader path (nullptr for the default)
+     * @param fragmentPath Fragment shader path (nullptr for the default)
+     * @return Shader (id 0 on failure)
+     */
+    virtual ::Shader loadShader(const char* vertexPath, const char* fragmentPath) = 0;
+
+    /**
+     * @brief Release a shader program
+     */
+    virtual void unloadShader(const ::Shader& shader) = 0;
+
+    /**
+     * @brief Start a frame and clear the screen
+     */
+    virtual void beginFrame(Color clearColor) = 0;
+
+    /**
+     * @brief Finish and present the frame
+     */
+    virtual void endFrame() = 0;
+
+    /**
+     * @brief Redirect drawing into a render texture
+     *
+     * Targets nest: endRenderTarget() returns to the target that was bound
+     * before, the screen at the outermost level. Queued glyphs are flushed
+     * to the previous target first. Only valid when supportsRenderTargets().
+     *
+     * @param target Render texture
+     * @param viewWidth Width of the coordinate space stretched over the target
+     * @param viewHeight Height of the coordinate space stretched over the target
+     */
+    virtual void beginRenderTarget(const RenderTexture2D& target, float32 viewWidth,
+                                   float32 viewHeight) = 0;
+
+    /**
+     * @brief Return to the render target bound before beginRenderTarget()
+     */
+    virtual void endRenderTarget() = 0;
+
+    /**
+     * @brief Clear the bound render target, or the screen outside of one
+     */
+    virtual void clearRenderTarget(Color color) = 0;
+
+    /**
+     * @brief Set how the draws that follow blend, until set again
+     *
+     * beginFrame() and endRenderTarget() do not reset it; whoever changes
+     * it sets RenderBlend::Alpha back.
+     */
+    virtual void setBlendMode(RenderBlend blend) = 0;
+
+    /**
+     * @brief Queue a glyph quad
+     *
+     * @param texture Atlas texture the glyph samples from
+     * @param dest Destination rectangle in screen coordinates
+     * @param source Source rectangle in atlas pixels
+     * @param color Glyph color
+     * @param shader Shader to draw with (id 0 for the default)
+     * @param codepoint Codepoint the quad shows, for recording
+     */
+    virtual void drawGlyph(const Texture2D& texture, const Rectangle& dest,
+                           const Rectangle& source, Color color, const ::Shader& shader,
+                           int32 codepoint) = 0;
+
+    /**
+     * @brief Queue a glyph quad drawn by an effect shader
+     *
+     * The shader reads the attributes per vertex; it must be a shader
+     * written for effect glyphs (see text_glitch.vert), not a fragment-only
+     * shader on top of Raylib's default vertex stage.
+     *
+     * @param texture Atlas texture the glyph samples from
+     * @param dest Destination rectangle in screen coordinates
+     * @param source Source rectangle in atlas pixels
+     * @param color Glyph color
+     * @param shader Effect shader
+     * @param attributes Per-glyph effect attributes
+     * @param codepoint Codepoint the quad shows, for recording
+     */
+    virtual void drawEffectGlyph(const Texture2D& texture, const Rectangle& dest,
+                                 const Rectangle& source, Color color, const ::Shader& shader,
+                                 const GlyphEffectAttributes& attributes, int32 codepoint) = 0;
+
+    /**
+     * @brief Draw a textured quad with its own blend mode
+     *
+     * Used to composite render textures. The blend mode set with
+     * setBlendMode() is back in effect afterwards.
+     *
+     * @param texture Texture to sample
+     * @param dest Destination rectangle in screen coordinates
+     * @param source Source rectangle in texture pixels (negative height flips)
+     * @param color Tint
+     * @param blend Blend mode of this quad
+     */
+    virtual void drawTexture(const Texture2D& texture, const Rectangle& dest,
+                             const Rectangle& source, Color color, RenderBlend blend) = 0;
+
+    /**
+     * @brief Draw a textured quad through a shader, e.g. a full-screen pass
+     *
+     * Drawn under the blend mode set with setBlendMode(), with the
+     * uniforms last set on the shader.
+     *
+     * @param texture Texture to sample
+     * @param dest Destination rectangle in screen coordinates
+     * @param source Source rectangle in texture pixels (negative height flips)
+     * @param shader Shader to draw with
+     */
+    virtual void drawShadedTexture(const Texture2D& texture, const Rectangle& dest,
+                                   const Rectangle& source, const ::Shader& shader) = 0;
+
+    /**
+     * @brief Get a uniform location
+     *
+     * @return Location, or -1 if the shader has no such uniform
+     */
+    virtual int32 getShaderLocation(const ::Shader& shader, const char* uniformName) = 0;
+
+    /**
+     * @brief Set a uniform
+     *
+     * Takes effect immediately, so it also applies to draws still queued
+     * with the shader.
+     *
+     * @param shader Shader program
+     * @param location Uniform location (ignored if -1)
+     * @param value Uniform data
+     * @param uniformType ShaderUniformDataType of one element
+     * @param count Number of elements
+     */
+    virtual void setShaderValue(const ::Shader& shader, int32 location, const void* value,
+                                int32 uniformType, int32 count) = 0;
+
+    /**
+     * @brief Draw a filled rectangle
+     */
+    virtual void drawRectangle(const Rectangle& rect, Color color) = 0;
+
+    /**
+     * @brief Submit queued glyphs
+     *
+     * @return Draw calls issued
+     */
+    virtual uint32 flush() = 0;
+
+    /**
+     * @brief Submit everything queued, including work for targets outside the bound one
+     *
+     * Needed before a texture that outer targets' queued quads sample is
+     * overwritten. Backends that do not queue per target just flush().
+     *
+     * @return Draw calls issued
+     */
+    virtual uint32 flushAll() = 0;
+
+    /**
+     * @brief Draw a rectangle outline as four filled rectangles
+     *
+     * @param rect Outer bounds
+     * @param thickness Line thickness in pixels
+     * @param color Line color
+     */
+    void drawRectangleLines(const Rectangle& rect, float32 thickness, Color color);
+};
+
+}  // namespace deadcode
@@ -11,21 +11,43 @@
 #pragma once
 
 #include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/DrawCommandBuffer.hpp"
+#include "deadcode/graphics/RenderBackend.hpp"
 #include "deadcode/graphics/TextRenderer.hpp"
 
 #include <glm/glm.hpp>
+#include <raylib.h>
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace deadcode
 {
 
+class PostProcessChain;
 class Window;
+struct PostProcessSettings;
+
+/**
+ * @brief Handle to a cached render layer
+ */
+using RenderLayerId = uint32;
+
+/**
+ * @brief Id never returned by Renderer::createLayer()
+ */
+constexpr RenderLayerId INVALID_RENDER_LAYER = 0;
 
 /**
  * @brief Main rendering system coordinator
  *
  * Manages rendering state and provides high-level rendering interface.
+ * Text, rectangles and textured quads submitted during a frame are
+ * recorded in a DrawCommandBuffer and executed sorted by draw layer,
+ * texture and shader when the frame ends. With post-processing on, the
+ * frame is drawn at a reduced internal resolution, run through the
+ * configured full-screen passes and scaled up to the window.
  */
 class Renderer
 {
@@ -48,6 +70,18 @@ public:
      */
     bool initialize(Window* window);
 
+    /**
+     * @brief Initialize renderer without a window, recording draw commands
+     *
+     * Uses a HeadlessRenderBackend, reachable through getBackend(), so
+     * rendering code runs on machines with no display or GPU.
+     *
+     * @param width Virtual screen width in pixels
+     * @param height Virtual screen height in pixels
+     * @return true if successful
+     */
+    bool initializeHeadless(int32 width, int32 height);
+
     /**
      * @brief Shutdown and cleanup
      */
@@ -63,10 +97,53 @@ public:
     /**
      * @brief End the frame
      *
-     * Presents the rendered frame to screen.
+     * Executes the frame's draw commands and presents the rendered frame to screen.
      */
     void endFrame();
 
+    /**
+     * @brief Set the draw layer for subsequent submissions (text included)
+     *
+     * @param layer Layer, see DrawLayer (higher is drawn on top)
+     */
+    void setDrawLayer(int32 layer);
+
+    /**
+     * @brief Get the current draw layer
+     */
+    [[nodiscard]] int32 getDrawLayer() const;
+
+    /**
+     * @brief Submit a filled rectangle
+     */
+    void drawRectangle(const Rectangle& rect, Color color);
+
+    /**
+     * @brief Submit a textured quad, sorted with the layer composites
+     *
+     * @param texture Texture to sample
+     * @param dest Destination rectangle in screen coordinates
+     * @param source Source rectangle in texture pixels
+     * @param color Tint
+     */
+    void drawTexture(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                     Color color);
+
+    /**
+     * @brief Get draw command counters of the last completed frame
+     */
+    [[nodiscard]] const DrawCommandStats& getFrameStats() const;
+
+    /**
+     * @brief Get the time the last endFrame() spent presenting
+     *
+     * Everything is submitted by then, so this is buffer swap, vsync and
+     * frame limiter waiting, not rendering work.
+     *
+     * @return Seconds
+     */
+    [[nodiscard]] float32 getLastPresentTime() const;
+
     /**
      * @brief Set clear color
      *
@@ -74,6 +151,81 @@ public:
      */
     void setClearColor(const glm::vec3& color);
 
+    /**
+     * @brief Configure the post-process chain
+     *
+     * Loads the pass shaders. Backends without render targets keep the
+     * settings but draw frames straight to the screen.
+     *
+     * @param settings Chain settings
+     * @return true if successful
+     */
+    bool configurePostProcess(const PostProcessSettings& settings);
+
+    /**
+     * @brief Get the post-process chain
+     *
+     * @return Chain, or nullptr before configurePostProcess()
+     */
+    [[nodiscard]] PostProcessChain* getPostProcess();
+
+    /**
+     * @brief Create a cached render layer
+     *
+     * A layer holds static UI (logos, labels, frame borders) in a
+     * screen-sized render texture. It is only redrawn when invalidated, the
+     * window is resized or the font changes; otherwise drawing it is a
+     * single textured quad.
+     *
+     * @param name Layer name, for logging
+     * @return Layer id
+     */
+    RenderLayerId createLayer(const String& name);
+
+    /**
+     * @brief Destroy a layer and release its render texture
+     *
+     * @param layer Layer id (unknown ids are ignored)
+     */
+    void destroyLayer(RenderLayerId layer);
+
+    /**
+     * @brief Mark a layer for redraw on its next drawLayer() call
+     *
+     * Call this when the layer's text, layout or style changes.
+     *
+     * @param layer Layer id
+     */
+    void invalidateLayer(RenderLayerId layer);
+
+    /**
+     * @brief Mark every layer for redraw
+     */
+    void invalidateLayers();
+
+    /**
+     * @brief Draw a layer, running its draw function first if it is invalid
+     *
+     * The draw function renders in screen coordinates, exactly as it would
+     * without the layer. The layer is queued as one textured quad in the
+     * current draw layer, above its rectangles and below its text (see
+     * DrawCommandBuffer); commands queued before this call stay queued.
+     *
+     * @param layer Layer id
+     * @param draw Function that renders the layer contents
+     */
+    void drawLayer(RenderLayerId layer, const std::function<void(TextRenderer*)>& draw);
+
+    /**
+     * @brief Get the number of layer redraws since initialization
+     */
+    [[nodiscard]] uint64 getLayerRedrawCount() const;
+
+    /**
+     * @brief Get the render backend commands are executed on
+     */
+    [[nodiscard]] RenderBackend* getBackend();
+
     /**
      * @brief Get text renderer
      * @return Pointer to text renderer
@@ -85,10 +237,54 @@ public:
     Renderer& operator=(const Renderer&) = delete;
 
 private:
+    /**
+     * @brief Cached layer contents
+     */
+    struct RenderLayer
+    {
+        RenderLayerId id{INVALID_RENDER_LAYER};
+        String name;
+        RenderTexture2D target{};
+        uint32 fontGeneration{0};  ///< Font the target was drawn with
+        bool valid{false};
+    };
+
+    /**
+     * @brief Create the text renderer on top of the backend
+     */
+    bool initializeTextRenderer(int32 width, int32 height);
+
+    /**
+     * @brief Get the current screen size (window or virtual)
+     */
+    void getScreenSize(int32& width, int32& height) const;
+
+    /**
+     * @brief Find a layer by id
+     *
+     * @return Layer or nullptr
+     */
+    RenderLayer* findLayer(RenderLayerId layer);
+
+    /**
+     * @brief Redraw a layer into its render texture
+     */
+    void redrawLayer(RenderLayer& layer, const std::function<void(TextRenderer*)>& draw);
+
     Window* m_window;
+    UniquePtr<RenderBackend> m_backend;
+    UniquePtr<DrawCommandBuffer> m_commandBuffer;  ///< In front of m_backend
     UniquePtr<TextRenderer> m_textRenderer;
+    UniquePtr<PostProcessChain> m_postProcess;
+    int32 m_headlessWidth;
+    int32 m_headlessHeight;
     glm::vec3 m_clearColor;
+    float32 m_lastPresentTime;
     bool m_initialized;
+
+    std::vector<RenderLayer> m_layers;
+    RenderLayerId m_nextLayerId;
+    uint64 m_layerRedraws;
 };
 
 }  // namespace deadcode
@@ -2,7 +2,15 @@
  * @file Shader.hpp
  * @brief OpenGL shader program wrapper
  *
- * Manages shader compilation, linking, and uniform management.
+ * Manages shader compilation, linking, and uniform management on top of
+ * rlgl. Uniform locations are resolved once per name and cached by a
+ * compile-time hash of the name. Linked programs are stored as driver
+ * program binaries keyed by the source hash, so later launches skip
+ * compiling GLSL.
+ *
+ * Binary cache file layout (native byte order, it is a local artifact):
+ * - FileHeader (source hash, driver hash, binary format and length)
+ * - program binary
  *
  * @author 0xDEADC0DE Team
  * @date 2026-01-21
@@ -10,19 +18,68 @@
 
 #pragma once
 
+#include "deadcode/core/Hash.hpp"
 #include "deadcode/core/Types.hpp"
 
 #include <glm/glm.hpp>
 
 #include <string>
+#include <unordered_map>
 
 namespace deadcode
 {
 
+/**
+ * @brief Uniform name with its hash
+ *
+ * Built implicitly from a string literal and hashed at compile time, so
+ * `shader.setFloat("time", t)` does no string work at runtime. Names that
+ * are only known at runtime go through fromString().
+ */
+class UniformId
+{
+public:
+    /**
+     * @brief Hash a string literal at compile time
+     */
+    consteval UniformId(const char* name) : m_hash(Hash::fnv1aText(name)), m_name(name) {}
+
+    /**
+     * @brief Hash a name at runtime
+     *
+     * @param name Uniform name (must stay valid until its location is cached)
+     */
+    static UniformId
+    fromString(const char* name)
+    {
+        return UniformId(Hash::fnv1aText(name), name);
+    }
+
+    [[nodiscard]] constexpr uint64
+    getHash() const
+    {
+        return m_hash;
+    }
+
+    [[nodiscard]] constexpr const char*
+    getName() const
+    {
+        return m_name;
+    }
+
+private:
+    constexpr UniformId(uint64 hash, const char* name) : m_hash(hash), m_name(name) {}
+
+    uint64 m_hash;
+    const char* m_name;
+};
+
 /**
  * @brief OpenGL shader program wrapper
  *
  * Handles shader compilation, linking, and uniform variable management.
+ * Needs a current GL context (create it after the window). Uniform
+ * setters act on the bound program, call use() first.
  */
 class Shader
 {
@@ -49,6 +106,9 @@ public:
     /**
      * @brief Compile shaders from source strings
      *
+     * The cached program binary is used when one matches the sources and
+     * the driver; otherwise the sources are compiled and the binary saved.
+     *
      * @param vertexSource Vertex shader source code
      * @param fragmentSource Fragment shader source code
      * @return true if successful
@@ -72,14 +132,43 @@ public:
      */
     [[nodiscard]] bool isValid() const;
 
+    /**
+     * @brief Check if the program came from the binary cache
+     */
+    [[nodiscard]] bool isLoadedFromCache() const;
+
+    /**
+     * @brief Hand the program over to the caller
+     *
+     * Leaves the shader empty; the caller unloads the returned program.
+     *
+     * @return Program ID, 0 if none is loaded
+     */
+    [[nodiscard]] uint32 releaseProgram();
+
+    /**
+     * @brief Get a uniform location, resolving it on first use
+     *
+     * @param uniform Uniform name
+     * @return Uniform location or -1 if not found
+     */
+    int32 getUniformLocation(UniformId uniform) const;
+
     // Uniform setters
-    void setInt(const String& name, int32 value) const;
-    void setFloat(const String& name, float32 value) const;
-    void setVec2(const String& name, const glm::vec2& value) const;
-    void setVec3(const String& name, const glm::vec3& value) const;
-    void setVec4(const String& name, const glm::vec4& value) const;
-    void setMat3(const String& name, const glm::mat3& value) const;
-    void setMat4(const String& name, const glm::mat4& value) const;
+    void setInt(UniformId uniform, int32 value) const;
+    void setFloat(UniformId uniform, float32 value) const;
+    void setVec2(UniformId uniform, const glm::vec2& value) const;
+    void setVec3(UniformId uniform, const glm::vec3& value) const;
+    void setVec4(UniformId uniform, const glm::vec4& value) const;
+    void setMat3(UniformId uniform, const glm::mat3& value) const;
+    void setMat4(UniformId uniform, const glm::mat4& value) const;
+
+    /**
+     * @brief Set the directory program binaries are cached in
+     *
+     * Defaults to "cache/shaders". An empty path disables the cache.
+     */
+    static void setBinaryCacheDirectory(const String& directory);
 
     // Delete copy constructor and assignment
     Shader(const Shader&)            = delete;
@@ -91,32 +180,25 @@ public:
 
 private:
     /**
-     * @brief Compile a shader
-     *
-     * @param source Shader source code
-     * @param type Shader type (GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, etc.)
-     * @return Shader ID or 0 on failure
-     */
-    uint32 compileShader(const String& source, uint32 type);
-
-    /**
-     * @brief Link shader program
-     *
-     * @param vertexShader Compiled vertex shader ID
-     * @param fragmentShader Compiled fragment shader ID
-     * @return Program ID or 0 on failure
+     * @brief Hasher for keys that already are hashes
      */
-    uint32 linkProgram(uint32 vertexShader, uint32 fragmentShader);
+    struct PrehashedKey
+    {
+        size_t
+        operator()(uint64 hash) const
+        {
+            return hash;
+        }
+    };
 
     /**
-     * @brief Get uniform location (cached)
-     *
-     * @param name Uniform name
-     * @return Uniform location or -1 if not found
+     * @brief Release the program and forget cached uniform locations
      */
-    int32 getUniformLocation(const String& name) const;
+    void release();
 
     uint32 m_programID;
+    bool m_loadedFromCache;
+    mutable std::unordered_map<uint64, int32, PrehashedKey> m_uniformLocations;
 };
 
 }  // namespace deadcode
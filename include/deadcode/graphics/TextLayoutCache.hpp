@@ -0,0 +1,135 @@
+/**
+ * @file TextLayoutCache.hpp
+ * @brief LRU cache of shaped text runs
+ *
+ * Stores measured widths and per-glyph placement for strings that are
+ * drawn or measured repeatedly, so static UI text is shaped only once.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-15
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace deadcode
+{
+
+/**
+ * @brief One glyph of a shaped run, relative to the run origin
+ */
+struct ShapedGlyph
+{
+    int32 codepoint;   ///< Unicode codepoint
+    int32 glyphIndex;  ///< Index into the font's glyph table
+    float32 offsetX;   ///< Pen X offset from the run origin
+    float32 offsetY;   ///< Pen Y offset from the run origin
+    float32 advance;   ///< Horizontal advance including glyph spacing
+};
+
+/**
+ * @brief Shaped text run
+ */
+struct TextLayout
+{
+    String text;
+    float32 scale{1.0f};
+    uint32 fontGeneration{0};
+    float32 width{0.0f};  ///< Width of the widest line in pixels
+    std::vector<ShapedGlyph> glyphs;
+};
+
+/**
+ * @brief Cache hit/miss counters
+ */
+struct TextLayoutCacheStats
+{
+    uint64 hits{0};
+    uint64 misses{0};
+    uint64 evictions{0};
+};
+
+/**
+ * @brief Bounded LRU cache of TextLayout entries
+ *
+ * Entries are keyed by a hash of the text, the font generation and the
+ * scale. The key is verified against the stored entry on lookup, so a hash
+ * collision degrades to a miss instead of returning the wrong layout.
+ */
+class TextLayoutCache
+{
+public:
+    static constexpr uint32 DEFAULT_CAPACITY = 512;
+
+    /**
+     * @brief Constructor
+     *
+     * @param capacity Maximum number of cached layouts
+     */
+    explicit TextLayoutCache(uint32 capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Look up a layout and mark it as most recently used
+     *
+     * @param text Text of the run
+     * @param scale Text scale factor
+     * @param fontGeneration Generation of the font the run was shaped with
+     * @return Cached layout or nullptr on miss
+     */
+    const TextLayout* find(const String& text, float32 scale, uint32 fontGeneration);
+
+    /**
+     * @brief Insert a freshly shaped layout, evicting the oldest if full
+     *
+     * @param layout Layout to store
+     * @return Reference to the stored layout
+     */
+    const TextLayout& insert(TextLayout&& layout);
+
+    /**
+     * @brief Drop all cached layouts
+     */
+    void clear();
+
+    /**
+     * @brief Change the maximum number of entries
+     *
+     * @param capacity New capacity (at least 1)
+     */
+    void setCapacity(uint32 capacity);
+
+    /**
+     * @brief Get number of cached layouts
+     */
+    [[nodiscard]] uint32 getSize() const;
+
+    /**
+     * @brief Get hit/miss counters
+     */
+    [[nodiscard]] const TextLayoutCacheStats& getStats() const;
+
+private:
+    /**
+     * @brief Hash the lookup key
+     */
+    static uint64 hashKey(const String& text, float32 scale, uint32 fontGeneration);
+
+    /**
+     * @brief Drop least recently used entries until within capacity
+     */
+    void trim();
+
+    using EntryList = std::list<std::pair<uint64, TextLayout>>;
+
+    EntryList m_entries;  ///< Most recently used at the front
+    std::unordered_map<uint64, EntryList::iterator> m_index;
+    uint32 m_capacity;
+    TextLayoutCacheStats m_stats;
+};
+
+}  // namespace deadcode
@@ -2,7 +2,11 @@
  * @file TextRenderer.hpp
  * @brief Text rendering with Raylib fonts
  *
- * Manages font loading and text rendering using Raylib.
+ * Manages font loading and text rendering using Raylib. Glyphs are batched
+ * per frame and submitted once per font atlas, and shaped runs are cached
+ * so unchanged strings are not re-measured every frame. All strings are
+ * decoded as UTF-8; codepoints outside the baked atlas are rasterized on
+ * demand into a GlyphAtlas, with a chain of fallback fonts.
  *
  * @author 0xDEADC0DE Team
  * @date 2026-02-08
@@ -11,21 +15,59 @@
 #pragma once
 
 #include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/FontAtlasCache.hpp"
+#include "deadcode/graphics/TextLayoutCache.hpp"
 
 #include <glm/glm.hpp>
 #include <raylib.h>
 
 #include <functional>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace deadcode
 {
 
+class GlitchEffect;
+class GlyphAtlas;
+class RenderBackend;
+struct GlyphAtlasStats;
+struct GlyphEffectAttributes;
+
+/**
+ * @brief Per-frame text rendering counters
+ */
+struct TextRenderStats
+{
+    uint32 textRuns{0};   ///< renderText/renderTextWithCallback/renderTextGlitched calls
+    uint32 glyphs{0};     ///< Glyph quads emitted
+    uint32 drawCalls{0};  ///< Draw calls used to submit them
+};
+
+/**
+ * @brief Loose glyphs in structure-of-arrays form, drawn by renderGlyphs()
+ *
+ * Every pointer addresses count elements. Positions are pen positions, as
+ * in renderCodepoint().
+ */
+struct GlyphSpan
+{
+    const int32* codepoints{nullptr};
+    const float32* x{nullptr};
+    const float32* y{nullptr};
+    const float32* scales{nullptr};  ///< Text scale factor per glyph
+    const Color* colors{nullptr};    ///< Alpha is honored
+    size_t count{0};
+};
+
 /**
  * @brief Text rendering system using Raylib
  *
  * Manages font loading and rendering text to screen using
- * Raylib's font API.
+ * Raylib's font API. Glyph quads go to the render backend; in batched
+ * mode (the default) they stay queued there until flush(), which the
+ * Renderer calls from endFrame().
  */
 class TextRenderer
 {
@@ -45,9 +87,10 @@ public:
      *
      * @param screenWidth Screen width in pixels
      * @param screenHeight Screen height in pixels
+     * @param backend Backend that owns textures and draws glyphs
      * @return true if successful
      */
-    bool initialize(int32 screenWidth, int32 screenHeight);
+    bool initialize(int32 screenWidth, int32 screenHeight, RenderBackend* backend);
 
     /**
      * @brief Shutdown and cleanup resources
@@ -57,11 +100,24 @@ public:
     /**
      * @brief Load a font from file
      *
+     * In SDF mode the atlas stores distance fields and glyphs are drawn
+     * through the distance-field shader, so a single atlas serves every
+     * text scale. If the shader cannot be loaded the font falls back to
+     * a bitmap atlas. The atlas comes from a baked cache file next to the
+     * font when one is valid (see FontAtlasCache).
+     *
      * @param fontPath Path to TTF font file
      * @param fontSize Font size in pixels
+     * @param mode Atlas rasterization mode
      * @return true if successful
      */
-    bool loadFont(const String& fontPath, uint32 fontSize);
+    bool loadFont(const String& fontPath, uint32 fontSize,
+                  FontAtlasMode mode = FontAtlasMode::Bitmap);
+
+    /**
+     * @brief Get the atlas mode of the loaded font
+     */
+    [[nodiscard]] FontAtlasMode getAtlasMode() const;
 
     /**
      * @brief Render text to screen
@@ -94,6 +150,73 @@ public:
                                                    float32& y, glm::vec3& color, bool& visible)>
                                     charCallback);
 
+    /**
+     * @brief Render text with the glitch effect evaluated on the GPU
+     *
+     * Every glyph quad (plus a ghost quad for duplication) carries its
+     * index, slice position, block and the effect's time, seed, intensity
+     * and configuration as vertex attributes; text_glitch.vert/.frag turn
+     * them into displacement and chromatic tinting. No per-glyph effect
+     * math runs on the CPU and the string is one draw call, shared with
+     * other glitched strings even when their GlitchEffects differ. Falls
+     * back to renderText() without the effect if the glitch shader is
+     * unavailable.
+     *
+     * @param text Text string to render
+     * @param x X position in screen coordinates
+     * @param y Y position in screen coordinates
+     * @param scale Text scale factor
+     * @param color Base text color (RGB, each 0-1)
+     * @param effect Glitch effect providing time, seed, intensity and configuration
+     */
+    void renderTextGlitched(const String& text, float32 x, float32 y, float32 scale,
+                            const glm::vec3& color, const GlitchEffect& effect);
+
+    /**
+     * @brief Start a new frame and reset the frame counters
+     */
+    void beginFrame();
+
+    /**
+     * @brief Submit all queued glyphs
+     *
+     * Called by the Renderer at the end of the frame. UI code that draws
+     * non-text primitives over earlier text should flush first so the
+     * layering is preserved.
+     */
+    void flush();
+
+    /**
+     * @brief Enable or disable glyph batching
+     *
+     * When disabled every string is drawn immediately with Raylib's text API.
+     *
+     * @param enabled Whether batching is enabled
+     */
+    void setBatchingEnabled(bool enabled);
+
+    /**
+     * @brief Check if glyph batching is enabled
+     */
+    [[nodiscard]] bool isBatchingEnabled() const;
+
+    /**
+     * @brief Get counters for the current frame
+     */
+    [[nodiscard]] const TextRenderStats& getFrameStats() const;
+
+    /**
+     * @brief Get the shaped-run cache
+     */
+    [[nodiscard]] const TextLayoutCache& getLayoutCache() const;
+
+    /**
+     * @brief Set the maximum number of cached text layouts
+     *
+     * @param capacity Number of layouts kept before the least recently used is evicted
+     */
+    void setLayoutCacheCapacity(uint32 capacity);
+
     /**
      * @brief Update screen dimensions (for window resize)
      *
@@ -105,27 +228,189 @@ public:
     /**
      * @brief Calculate the width of a text string
      *
+     * Served from the layout cache when the string was seen before.
+     *
      * @param text Text string to measure
      * @param scale Text scale factor
      * @return Width in pixels
      */
     float32 getTextWidth(const String& text, float32 scale) const;
 
+    /**
+     * @brief Get the advance of the reference character ('M')
+     *
+     * @param scale Text scale factor
+     * @return Width in pixels
+     */
     float32 getCharWidth(float32 scale) const;
 
     float32 getLineHeight(float32 scale) const;
 
+    /**
+     * @brief Render a single codepoint with its pen position at (x, y)
+     *
+     * Used by grid renderers that place glyphs cell by cell.
+     *
+     * @param codepoint Unicode codepoint
+     * @param x X position
+     * @param y Y position
+     * @param scale Text scale factor
+     * @param color Glyph color (alpha is honored)
+     */
+    void renderCodepoint(int32 codepoint, float32 x, float32 y, float32 scale, Color color);
+
+    /**
+     * @brief Render many independent glyphs in one pass
+     *
+     * Counts as a single text run. Used by particle systems, which keep
+     * their glyphs in arrays and would otherwise pay a call per glyph.
+     *
+     * @param glyphs Glyphs to draw
+     */
+    void renderGlyphs(const GlyphSpan& glyphs);
+
+    /**
+     * @brief Get the shaped layout of a string, shaping it on a cache miss
+     *
+     * Glyph offsets are relative to the pen position the string would be
+     * drawn at. The reference is only valid until the next string is
+     * shaped, which may evict it.
+     *
+     * @param text Text to shape
+     * @param scale Text scale factor
+     * @return Cached layout
+     */
+    const TextLayout& getLayout(const String& text, float32 scale) const;
+
+    /**
+     * @brief Get a counter that changes whenever glyph shapes or metrics may have changed
+     *
+     * Bumped by loadFont() and addFallbackFont(). Caches of rendered text
+     * compare it to know when to redraw.
+     */
+    [[nodiscard]] uint32 getFontGeneration() const;
+
+    /**
+     * @brief Check if a codepoint can be drawn without the '?' placeholder
+     *
+     * Reads the fonts' character maps only, nothing is rasterized.
+     *
+     * @param codepoint Unicode codepoint
+     * @return true if the loaded font or a fallback font has the glyph
+     */
+    [[nodiscard]] bool hasGlyph(int32 codepoint) const;
+
+    /**
+     * @brief Append a font to the fallback chain
+     *
+     * Codepoints missing from the loaded font are looked up in fallback
+     * fonts, in the order they were added, and rasterized on demand into
+     * the dynamic glyph atlas.
+     *
+     * @param fontPath Path to TTF/OTF font file
+     * @return true if the font could be opened
+     */
+    bool addFallbackFont(const String& fontPath);
+
+    /**
+     * @brief Get dynamic glyph atlas counters
+     */
+    [[nodiscard]] GlyphAtlasStats getGlyphAtlasStats() const;
+
+    /**
+     * @brief Get the render backend glyphs are drawn with
+     *
+     * UI code drawing boxes next to text uses it so both end up in the
+     * same backend.
+     */
+    [[nodiscard]] RenderBackend* getBackend() const;
+
     // Delete copy constructor and assignment
     TextRenderer(const TextRenderer&)            = delete;
     TextRenderer& operator=(const TextRenderer&) = delete;
 
 private:
+    /**
+     * @brief Load the distance-field shader if it is not loaded yet
+     *
+     * @return true if the shader is available
+     */
+    bool ensureSdfShader();
+
+    /**
+     * @brief Load the glitch shader pair if it is not loaded yet
+     *
+     * A failed load is not retried.
+     *
+     * @return true if the shader is available
+     */
+    bool ensureGlitchShader();
+
+    /**
+     * @brief Build the codepoint lookup table and glyph metrics for the loaded font
+     */
+    void buildGlyphTable();
+
+    /**
+     * @brief Look up a glyph index in O(1)
+     *
+     * @param codepoint Unicode codepoint
+     * @return Glyph index or -1 if the font has no such glyph
+     */
+    int32 findGlyphIndex(int32 codepoint) const;
+
+    /**
+     * @brief Resolve a codepoint to a baked glyph or the dynamic atlas
+     *
+     * Missing glyphs fall back to '?'. Dynamic glyphs are only measured,
+     * so layout queries never rasterize or evict atlas pages.
+     *
+     * @param codepoint Unicode codepoint
+     * @param advance Receives the unscaled advance
+     * @return Glyph index into the baked font, or -1 for a dynamic atlas glyph
+     */
+    int32 resolveGlyph(int32 codepoint, float32& advance) const;
+
+    /**
+     * @brief Draw or queue a single glyph
+     *
+     * @param glyphIndex Index into the font's glyph table, or -1 for the dynamic atlas
+     * @param codepoint Unicode codepoint (used for dynamic atlas glyphs)
+     * @param x Pen X position
+     * @param y Pen Y position
+     * @param fontSize Rendered font size in pixels
+     * @param color Glyph color
+     * @param effect Effect attributes to draw it with the glitch shader, or nullptr
+     */
+    void drawGlyph(int32 glyphIndex, int32 codepoint, float32 x, float32 y, float32 fontSize,
+                   Color color, const GlyphEffectAttributes* effect = nullptr);
+
     Font m_font;
     float32 m_fontSize;
     int32 m_screenWidth;
     int32 m_screenHeight;
     bool m_initialized;
     bool m_fontLoaded;
+    uint32 m_fontGeneration;  ///< Bumped on every font load, part of the layout cache key
+    FontAtlasMode m_atlasMode;
+    RenderBackend* m_backend;
+    ::Shader m_sdfShader;  ///< Raylib shader (not deadcode::Shader)
+    bool m_sdfShaderLoaded;
+    ::Shader m_glitchShader;
+    bool m_glitchShaderLoaded;
+    bool m_glitchShaderFailed;
+
+    // Glyph lookup, rebuilt on every font load
+    std::vector<uint16> m_bmpGlyphIndex;                ///< Direct index for U+0000..U+FFFF
+    std::unordered_map<int32, int32> m_extGlyphIndex;  ///< Codepoints beyond the BMP
+    std::vector<float32> m_glyphAdvance;                ///< Unscaled advance per glyph
+    int32 m_fallbackGlyph;
+    float32 m_charWidth;  ///< Unscaled advance of the reference character
+
+    UniquePtr<GlyphAtlas> m_glyphAtlas;  ///< Codepoints outside the baked atlas
+    mutable TextLayoutCache m_layoutCache;
+    bool m_batchingEnabled;
+    TextRenderStats m_frameStats;
 };
 
 }  // namespace deadcode
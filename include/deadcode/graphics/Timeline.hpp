@@ -0,0 +1,288 @@
+/**
+ * @file Timeline.hpp
+ * @brief Seekable sequences of tweens, delays and cue points
+ *
+ * Intros and scripted UI moments are timelines: tweens placed one after
+ * another or side by side, with labeled cue points that run callbacks.
+ * Time is kept in integer microseconds and the fraction of a microsecond
+ * left over from each frame is carried to the next, so a timeline played
+ * at any frame rate ends exactly on time.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-05
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/AnimationSystem.hpp"
+#include "deadcode/graphics/Easing.hpp"
+
+#include <glm/glm.hpp>
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace deadcode
+{
+
+/**
+ * @brief Timeline of tweens on AnimationSystem targets
+ *
+ * Build it with then() (after everything so far), with() (alongside the
+ * previous step), delay(), repeat(), label() and cue(), then drive it with
+ * advance() from the thread that owns its targets. Other timelines can be
+ * nested with then() and with(); their steps are copied in.
+ *
+ * Every clip is stored with its absolute start and end in an interval
+ * tree, so moving the playhead finds the clips it touches in O(log n) per
+ * clip written, however long the clips around them run, and seek() jumps
+ * straight to any time or label without replaying what lies between.
+ *
+ * Where clips share a target, the one that started last wins. Tweens the
+ * AnimationSystem runs on the same target are not coordinated with.
+ *
+ * Not thread-safe.
+ */
+class Timeline
+{
+public:
+    static constexpr int32 REPEAT_FOREVER = -1;
+
+    /**
+     * @brief Constructor
+     */
+    Timeline();
+
+    // ------------------------------------------------------------------------
+    // Building
+    // ------------------------------------------------------------------------
+
+    /// Tween a target after everything added so far
+    Timeline& then(AnimationTarget target, float32 from, float32 to, float32 duration,
+                   EasingType easing = EasingType::Linear);
+    Timeline& then(AnimationTarget target, const glm::vec2& from, const glm::vec2& to,
+                   float32 duration, EasingType easing = EasingType::Linear);
+    Timeline& then(AnimationTarget target, const glm::vec3& from, const glm::vec3& to,
+                   float32 duration, EasingType easing = EasingType::Linear);
+    Timeline& then(AnimationTarget target, const glm::vec4& from, const glm::vec4& to,
+                   float32 duration, EasingType easing = EasingType::Linear);
+
+    /// Tween a target starting together with the previous step
+    Timeline& with(AnimationTarget target, float32 from, float32 to, float32 duration,
+                   EasingType easing = EasingType::Linear);
+    Timeline& with(AnimationTarget target, const glm::vec2& from, const glm::vec2& to,
+                   float32 duration, EasingType easing = EasingType::Linear);
+    Timeline& with(AnimationTarget target, const glm::vec3& from, const glm::vec3& to,
+                   float32 duration, EasingType easing = EasingType::Linear);
+    Timeline& with(AnimationTarget target, const glm::vec4& from, const glm::vec4& to,
+                   float32 duration, EasingType easing = EasingType::Linear);
+
+    /**
+     * @brief Copy another timeline in after everything added so far
+     *
+     * Its labels and cues come along. A finite timeline-level repeat of
+     * the child is unrolled; REPEAT_FOREVER cannot be and counts as one
+     * iteration.
+     */
+    Timeline& then(const Timeline& child);
+
+    /// Copy another timeline in, starting together with the previous step
+    Timeline& with(const Timeline& child);
+
+    /// Leave a gap before the next then()
+    Timeline& delay(float32 seconds);
+
+    /**
+     * @brief Repeat the step added last
+     *
+     * @param count Total number of plays, at least 1
+     * @param yoyo Play every second iteration backwards
+     */
+    Timeline& repeat(int32 count, bool yoyo = false);
+
+    /// Name the point where the next then() starts
+    Timeline& label(const String& name);
+
+    /**
+     * @brief Call a function when the playhead crosses this point
+     *
+     * Placed where the next then() starts, and usable as a label. Cues
+     * fire in order during advance(), never during seek(). A callback may
+     * pause or seek the timeline but must not add steps to it.
+     */
+    Timeline& cue(const String& name, std::function<void()> callback);
+
+    /**
+     * @brief Repeat the whole timeline
+     *
+     * @param count Total number of plays, or REPEAT_FOREVER
+     * @param yoyo Play every second iteration backwards
+     */
+    void setRepeat(int32 count, bool yoyo = false);
+
+    /// Call a function when the last iteration ends
+    void setOnComplete(std::function<void()> onComplete);
+
+    /// Remove every step, label and cue and rewind
+    void clear();
+
+    // ------------------------------------------------------------------------
+    // Playback
+    // ------------------------------------------------------------------------
+
+    /// Start or resume playing
+    void play();
+
+    /// Stop advancing, the playhead stays where it is
+    void pause();
+
+    /**
+     * @brief Move the playhead by a frame's worth of time
+     *
+     * Writes every target the move touches and fires the cues it crosses.
+     *
+     * @param deltaTime Time since last update (seconds), scaled by the time scale
+     */
+    void advance(float32 deltaTime);
+
+    /**
+     * @brief Jump to a time without firing cues
+     *
+     * @param seconds Time from the start, over all iterations
+     */
+    void seek(float64 seconds);
+
+    /**
+     * @brief Jump to a label or cue without firing cues
+     *
+     * @param name Label or cue name
+     * @return false if there is no such label
+     */
+    bool seek(const String& name);
+
+    /// Set the playback speed, 1 is normal
+    void setTimeScale(float32 timeScale);
+
+    [[nodiscard]] bool isPlaying() const;
+
+    /// Check if the playhead reached the end of the last iteration
+    [[nodiscard]] bool isFinished() const;
+
+    /// Get the playhead position in seconds, over all iterations
+    [[nodiscard]] float64 getTime() const;
+
+    /// Get the length of one iteration in seconds
+    [[nodiscard]] float64 getDuration() const;
+
+    /// Get the length of all iterations in seconds, negative when repeating forever
+    [[nodiscard]] float64 getTotalDuration() const;
+
+    /// Get the number of tween steps
+    [[nodiscard]] uint32 getClipCount() const;
+
+private:
+    /// Value written by a clip, stored widened to vec4
+    enum class ValueKind : uint8
+    {
+        Float,
+        Vec2,
+        Vec3,
+        Vec4
+    };
+
+    /// One tween step, times in microseconds from the timeline start
+    struct Clip
+    {
+        int64 start{0};
+        int64 duration{0};  ///< One iteration
+        int64 end{0};       ///< start + duration * repeats
+        int32 repeats{1};
+        bool yoyo{false};
+        bool reversed{false};  ///< Played back to front, for unrolled yoyo children
+        EasingType easing{EasingType::Linear};
+        ValueKind kind{ValueKind::Float};
+        AnimationTarget target{INVALID_TARGET};
+        glm::vec4 from{0.0f};
+        glm::vec4 to{0.0f};
+    };
+
+    struct Cue
+    {
+        int64 time{0};
+        std::function<void()> callback;
+    };
+
+    Timeline& addClip(AnimationTarget target, ValueKind kind, const glm::vec4& from,
+                      const glm::vec4& to, float32 duration, EasingType easing, bool parallel);
+
+    Timeline& addChild(const Timeline& child, bool parallel);
+
+    /// Sort clips and cues and rebuild the search arrays after building
+    void prepare();
+
+    /// Move the playhead over all iterations; false if a callback took over
+    bool moveTo(int64 position, bool fireCues);
+
+    /// Render a move within one iteration and fire the cues it crosses
+    bool moveLocal(int64 from, int64 to, bool fireCues, bool includeStart, uint32 move);
+
+    /// Write every clip overlapping [low, high] with its value at a local time
+    void renderSpan(int64 low, int64 high, int64 time);
+
+    /**
+     * @brief Fill m_maxEnd for the subtree over m_clips[first, last)
+     *
+     * The sorted clips form an implicit balanced tree: the root of a range
+     * is its middle clip.
+     *
+     * @return Latest end in the range
+     */
+    int64 buildMaxEnd(size_t first, size_t last);
+
+    /// Append the clips of a subtree overlapping [low, high] to m_touched, in start order
+    void collectOverlaps(size_t first, size_t last, int64 low, int64 high);
+
+    /// Write one clip's value at a local time
+    void renderClip(const Clip& clip, int64 time) const;
+
+    /// Split a playhead position into iteration and local time
+    int64 getLocalTime(int64 position) const;
+    int64 getIteration(int64 position) const;
+    bool isIterationReversed(int64 iteration) const;
+    int64 getTotalLength() const;
+
+    /// Jump to a playhead position without firing cues
+    void seekPosition(int64 position);
+
+    static int64 toMicroseconds(float64 seconds);
+
+    static constexpr uint32 NO_CLIP = ~0u;
+
+    std::vector<Clip> m_clips;    ///< Sorted by start once prepared
+    std::vector<int64> m_maxEnd;  ///< Latest end in the subtree rooted at m_clips[i]
+    std::vector<Cue> m_cues;      ///< Sorted by time once prepared
+    std::unordered_map<String, int64> m_labels;
+    std::vector<uint32> m_touched;  ///< Scratch for renderSpan()
+
+    int64 m_cursor;     ///< Where the next then() starts
+    int64 m_lastStart;  ///< Where the previous step started
+    int64 m_duration;   ///< One iteration
+    uint32 m_lastClip;  ///< Clip repeat() applies to, NO_CLIP after a nested timeline
+    int32 m_repeats;
+    bool m_yoyo;
+    bool m_prepared;
+
+    int64 m_position;     ///< Playhead over all iterations
+    float64 m_remainder;  ///< Microseconds not yet applied (below one)
+    float32 m_timeScale;
+    uint32 m_moveCount;  ///< Bumped by every move, so a callback's seek is noticed
+    bool m_playing;
+    bool m_rendered;  ///< Targets hold the values of m_position
+    bool m_atStart;   ///< Cues exactly at the start still have to fire
+
+    std::function<void()> m_onComplete;
+};
+
+}  // namespace deadcode
@@ -0,0 +1,188 @@
+/**
+ * @file TweenPool.hpp
+ * @brief Structure-of-arrays storage for tweens of one value type
+ *
+ * The AnimationSystem keeps one pool per value type (float, vec2, vec3,
+ * vec4). Tweens are rows across parallel arrays, kept dense by
+ * swap-removal, so the update is a couple of flat loops with no virtual
+ * calls and no per-tween allocations.
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-02
+ */
+
+#pragma once
+
+#include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/Easing.hpp"
+#include "deadcode/graphics/EasingBatch.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace deadcode
+{
+
+/**
+ * @brief Dense pool of tweens of value type T
+ *
+ * Row i of every array belongs to the same tween. Rows move when another
+ * tween is removed, so callers address tweens through the slot stored in
+ * each row, never through the row index.
+ *
+ * @tparam T float32, glm::vec2, glm::vec3 or glm::vec4
+ */
+template <typename T>
+struct TweenPool
+{
+    std::vector<T> start;
+    std::vector<T> end;
+    std::vector<T> value;              ///< Value as of the last advance()
+    std::vector<float32> elapsed;      ///< Seconds since the tween started
+    std::vector<float32> invDuration;  ///< 1 / duration, so progress is a multiply
+    std::vector<float32> progress;     ///< 0-1, 1 once finished
+    std::vector<EasingType> easing;    ///< Curve applied to progress
+    std::vector<uint32> target;        ///< Bound target handle, 0 for none
+    std::vector<uint32> slot;          ///< Owning slot in the system's handle table
+    std::vector<std::function<void()>> onComplete;
+    std::vector<float32> eased;  ///< Scratch for advance(), not part of a row
+
+    /**
+     * @brief Reserve rows so that many tweens run without allocating
+     */
+    void
+    reserve(size_t capacity)
+    {
+        start.reserve(capacity);
+        end.reserve(capacity);
+        value.reserve(capacity);
+        elapsed.reserve(capacity);
+        invDuration.reserve(capacity);
+        progress.reserve(capacity);
+        easing.reserve(capacity);
+        target.reserve(capacity);
+        slot.reserve(capacity);
+        onComplete.reserve(capacity);
+        eased.reserve(capacity);
+    }
+
+    /**
+     * @brief Append a tween
+     *
+     * @return Row of the new tween
+     */
+    uint32
+    add(uint32 owner, const T& from, const T& to, float32 duration, EasingType curve,
+        uint32 boundTarget, std::function<void()> callback)
+    {
+        start.push_back(from);
+        end.push_back(to);
+        value.push_back(from);
+        elapsed.push_back(0.0f);
+        invDuration.push_back(1.0f / std::max(duration, MIN_DURATION));
+        progress.push_back(0.0f);
+        easing.push_back(curve);
+        target.push_back(boundTarget);
+        slot.push_back(owner);
+        onComplete.push_back(std::move(callback));
+        return size() - 1;
+    }
+
+    /**
+     * @brief Remove a row by moving the last row into it
+     *
+     * @param row Row to remove
+     * @return Slot of the row that moved into it, or row's own slot if none moved
+     */
+    uint32
+    remove(uint32 row)
+    {
+        uint32 last  = size() - 1;
+        uint32 moved = slot[last];
+        if (row != last)
+        {
+            start[row]       = start[last];
+            end[row]         = end[last];
+            value[row]       = value[last];
+            elapsed[row]     = elapsed[last];
+            invDuration[row] = invDuration[last];
+            progress[row]    = progress[last];
+            easing[row]      = easing[last];
+            target[row]      = target[last];
+            slot[row]        = slot[last];
+            onComplete[row]  = std::move(onComplete[last]);
+        }
+
+        start.pop_back();
+        end.pop_back();
+        value.pop_back();
+        elapsed.pop_back();
+        invDuration.pop_back();
+        progress.pop_back();
+        easing.pop_back();
+        target.pop_back();
+        slot.pop_back();
+        onComplete.pop_back();
+        return moved;
+    }
+
+    /**
+     * @brief Advance every tween and recompute its value
+     *
+     * Progress is eased in batches (Easing::evaluateBatch), one run per
+     * stretch of rows sharing a curve; tweens started together usually do.
+     *
+     * @param deltaTime Time since last update (seconds)
+     */
+    void
+    advance(float32 deltaTime)
+    {
+        uint32 count = size();
+        for (uint32 i = 0; i < count; ++i)
+        {
+            elapsed[i] += deltaTime;
+            progress[i] = std::min(elapsed[i] * invDuration[i], 1.0f);
+        }
+
+        eased.resize(count);
+        Easing::evaluateBatch(easing.data(), progress.data(), eased.data(), count);
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            value[i] = start[i] + (end[i] - start[i]) * eased[i];
+        }
+    }
+
+    /**
+     * @brief Remove every row
+     */
+    void
+    clear()
+    {
+        start.clear();
+        end.clear();
+        value.clear();
+        elapsed.clear();
+        invDuration.clear();
+        progress.clear();
+        easing.clear();
+        target.clear();
+        slot.clear();
+        onComplete.clear();
+        eased.clear();
+    }
+
+    /**
+     * @brief Get the number of tweens
+     */
+    [[nodiscard]] uint32
+    size() const
+    {
+        return static_cast<uint32>(slot.size());
+    }
+
+    static constexpr float32 MIN_DURATION = 1.0e-6f;  ///< Shorter tweens finish on the next step
+};
+
+}  // namespace deadcode
@@ -71,6 +71,16 @@ public:
      */
     void swapBuffers();
 
+    /**
+     * @brief Block until an input or window event arrives or the timeout expires
+     *
+     * Used when nothing on screen is animating. Events that arrive are
+     * processed, so they are visible to the next frame's input queries.
+     *
+     * @param timeoutSeconds Longest time to sleep
+     */
+    void waitEvents(float64 timeoutSeconds);
+
     /**
      * @brief Get window width
      * @return Current window width in pixels
@@ -101,6 +111,18 @@ public:
      */
     void setTitle(const String& title);
 
+    /**
+     * @brief Enable or disable vsync
+     * @param enabled true to wait for the display's vertical blank on present
+     */
+    void setVSync(bool enabled);
+
+    /**
+     * @brief Get the refresh rate of the monitor the window is on
+     * @return Refresh rate in Hz, 0 if unknown
+     */
+    [[nodiscard]] int32 getRefreshRate() const;
+
     // Delete copy constructor and assignment
     Window(const Window&)            = delete;
     Window& operator=(const Window&) = delete;
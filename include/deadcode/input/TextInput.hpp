@@ -5,6 +5,8 @@
 
 namespace deadcode
 {
+class RenderBackend;
+
 class TextInput
 {
 public:
@@ -12,7 +14,7 @@ public:
     ~TextInput();
 
     void update(float deltaTime);
-    void render(int32 posX, int32 posY);
+    void render(RenderBackend* backend, int32 posX, int32 posY);
 
 private:
     std::string m_text;
@@ -21,6 +21,7 @@
 namespace deadcode
 {
 
+class CellGrid;
 class TextRenderer;
 
 /**
@@ -163,6 +164,32 @@ public:
                      int32 startOffsetY, int32 lineSpacing = 1, FrameAlign align = FrameAlign::LEFT,
                      float32 scale = 1.0f);
 
+    /**
+     * @brief Draw the frame into a cell grid
+     *
+     * The frame covers width x height cells from (column, row): the border,
+     * plus title and footer rows with separators when set. Content cells
+     * are left untouched, so unchanged frames cost nothing to redraw.
+     *
+     * @param grid Grid to draw into
+     * @param column Left column of the frame
+     * @param row Top row of the frame
+     */
+    void render(CellGrid& grid, int32 column, int32 row) const;
+
+    /**
+     * @brief Write text into the content area of a frame drawn in a grid
+     *
+     * @param grid Grid the frame was drawn into
+     * @param column Left column of the frame
+     * @param row Top row of the frame
+     * @param text Text to write (clipped to the content width)
+     * @param offsetY Row offset from the top of the content area
+     * @param align Text alignment
+     */
+    void renderText(CellGrid& grid, int32 column, int32 row, const String& text, int32 offsetY,
+                    FrameAlign align = FrameAlign::LEFT) const;
+
     /**
      * @brief Get content area dimensions
      *
@@ -174,6 +201,12 @@ public:
     void getContentArea(TextRenderer* textRenderer, float32 scale, float32& outX, float32& outY,
                         int32& outWidth, int32& outHeight) const;
 
+    /**
+     * @brief Get the frame size in characters, e.g. to size a grid for it
+     */
+    [[nodiscard]] int32 getWidth() const;
+    [[nodiscard]] int32 getHeight() const;
+
     /**
      * @brief Get character width at current scale
      *
@@ -217,7 +250,19 @@ private:
      * @brief Render horizontal line
      */
     void renderHorizontalLine(TextRenderer* textRenderer, float32 x, float32 y, int32 width,
-                              char left, char middle, char right, float32 scale);
+                              int32 left, int32 middle, int32 right, float32 scale);
+
+    /**
+     * @brief Write one border row (left, middle..., right) into a grid
+     */
+    void putHorizontalLine(CellGrid& grid, int32 column, int32 row, int32 left, int32 middle,
+                           int32 right) const;
+
+    /**
+     * @brief Write a single-line label into a grid row, aligned within the frame
+     */
+    void putAlignedText(CellGrid& grid, int32 column, int32 row, const String& text,
+                        FrameAlign align, const glm::vec3& color) const;
 
     /**
      * @brief Render vertical lines
@@ -257,17 +302,17 @@ private:
     int32 m_screenWidth{0};   // Screen width for centering (0 = use frame width)
     int32 m_screenHeight{0};  // Screen height for centering
 
-    // Border characters for current style
-    char m_topLeft;
-    char m_topRight;
-    char m_bottomLeft;
-    char m_bottomRight;
-    char m_horizontal;
-    char m_vertical;
-    char m_teeDown;   // T pointing down
-    char m_teeUp;     // T pointing up
-    char m_teeRight;  // T pointing right
-    char m_teeLeft;   // T pointing left
+    // Border codepoints for current style
+    int32 m_topLeft;
+    int32 m_topRight;
+    int32 m_bottomLeft;
+    int32 m_bottomRight;
+    int32 m_horizontal;
+    int32 m_vertical;
+    int32 m_teeDown;   // T pointing down
+    int32 m_teeUp;     // T pointing up
+    int32 m_teeRight;  // T pointing right
+    int32 m_teeLeft;   // T pointing left
 };
 
 }  // namespace deadcode
@@ -12,9 +12,12 @@
 #pragma once
 
 #include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/DigitalRain.hpp"
 #include "deadcode/graphics/GlitchEffect.hpp"
+#include "deadcode/graphics/Renderer.hpp"
 #include "deadcode/ui/MenuFrame.hpp"
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <string>
@@ -23,6 +26,7 @@
 namespace deadcode
 {
 
+class CellGrid;
 class TextRenderer;
 class InputManager;
 
@@ -39,11 +43,26 @@ enum class StartMenuOption
     COUNT
 };
 
+/**
+ * @brief Animation state a start menu frame is drawn from
+ */
+struct StartMenuFrame
+{
+    bool blinkState{true};  ///< Selection marker shown
+    GlitchState glitch;     ///< Logo glitch
+    uint32 rainStep{0};     ///< Background rain step
+};
+
 /**
  * @brief Main start menu
  *
  * Displays game logo, menu options, and handles user selection.
  * Uses beautiful ASCII art frames and animations.
+ *
+ * Animations belong to the simulation: update(), captureFrame() and
+ * getTimeUntilNextFrame() only touch animation state and may run on the
+ * simulation thread, while everything else stays on the render thread
+ * and draws from captured frames.
  */
 class StartMenu
 {
@@ -68,18 +87,27 @@ public:
     bool initialize(int32 screenWidth, int32 screenHeight);
 
     /**
-     * @brief Update menu state
+     * @brief Advance the menu animations
      *
-     * @param deltaTime Time since last frame
+     * @param deltaTime Simulation step
      */
     void update(float deltaTime);
 
+    /**
+     * @brief Copy the animation state for drawing
+     */
+    [[nodiscard]] StartMenuFrame captureFrame() const;
+
     /**
      * @brief Render the menu
      *
-     * @param textRenderer TextRenderer to use for drawing
+     * Static parts (logo, subtitle, footer) are drawn through cached
+     * renderer layers and only redrawn when they change.
+     *
+     * @param renderer Renderer to draw with
+     * @param frame Animation state to draw
      */
-    void render(TextRenderer* textRenderer);
+    void render(Renderer* renderer, const StartMenuFrame& frame);
 
     /**
      * @brief Handle keyboard input
@@ -137,14 +165,66 @@ public:
 
     void onWindowResize(int32 screenWidth, int32 screenHeight);
 
+    /**
+     * @brief Limit the logo glitch to an effect tier
+     *
+     * @param quality Effect tier
+     */
+    void setEffectQuality(EffectQuality quality);
+
+    /**
+     * @brief Configure the digital rain behind the menu
+     *
+     * The rain's step clock runs in update(), so call this before the
+     * simulation starts.
+     *
+     * @param settings Rain settings
+     */
+    void setBackgroundRain(const DigitalRainSettings& settings);
+
+    /**
+     * @brief Set how far past the last update the next frame is drawn
+     *
+     * @param offset Seconds since the last update, for smooth glitch motion
+     */
+    void setRenderTimeOffset(float32 offset);
+
+    /**
+     * @brief Reseed the logo glitch, for reproducible frames
+     *
+     * @param seed Random seed
+     */
+    void setRandomSeed(uint32 seed);
+
+    /**
+     * @brief Get the time until the menu next looks different
+     *
+     * Covers the selection blink, the glitch effect and the rain steps.
+     * Input is not included, the caller wakes up for that on its own.
+     *
+     * @return Seconds until a redraw is needed (0 if animating), or a
+     *         negative value if nothing is scheduled
+     */
+    [[nodiscard]] float32 getTimeUntilNextFrame() const;
+
 private:
     /**
-     * @brief Render game logo
+     * @brief Render the main title, glitched when the glitch effect is active
      */
     void renderLogo(TextRenderer* textRenderer);
 
     /**
-     * @brief Render menu options
+     * @brief Render the subtitle under the main title
+     */
+    void renderSubtitle(TextRenderer* textRenderer);
+
+    /**
+     * @brief Get the logo scale and top position for the current screen size
+     */
+    void getLogoLayout(float32& heightScale, float32& scale, float32& topY) const;
+
+    /**
+     * @brief Render the menu frame and options through the options grid
      */
     void renderOptions(TextRenderer* textRenderer);
 
@@ -188,17 +268,32 @@ private:
 
     std::unique_ptr<MenuFrame> m_mainFrame;
     std::unique_ptr<MenuFrame> m_logoFrame;
+    std::unique_ptr<CellGrid> m_optionsGrid;  ///< m_mainFrame and the options, sized to the frame
 
-    // Animation state
+    // Animation state (simulation side)
     float32 m_blinkTimer{0.0f};
     bool m_blinkState{true};
     float32 m_glitchTimer{0.0f};
-
-    // Glitch effect
     std::unique_ptr<GlitchEffect> m_glitchEffect;
+    uint32 m_blinkRestartsSeen{0};
+
+    std::atomic<uint32> m_blinkRestarts{0};  ///< Bumped by input to restart the blink
+    float32 m_rainInterval{0.0f};            ///< Rain step length, 0 without rain
+    float32 m_rainTimer{0.0f};
+    uint32 m_rainStep{0};
+
+    // Drawn state (render side): the last frame, and a glitch that replays its state
+    StartMenuFrame m_frame;
+    std::unique_ptr<GlitchEffect> m_glitchDisplay;
+    std::unique_ptr<DigitalRain> m_rain;
 
     // ASCII art logo
     std::vector<String> m_logoLines;
+
+    // Cached layers for the static parts of the menu
+    Renderer* m_layerRenderer{nullptr};
+    RenderLayerId m_logoLayer{INVALID_RENDER_LAYER};
+    RenderLayerId m_chromeLayer{INVALID_RENDER_LAYER};
 };
 
 }  // namespace deadcode
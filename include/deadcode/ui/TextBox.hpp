@@ -14,6 +14,7 @@
 #include "deadcode/graphics/TextRenderer.hpp"
 #include "deadcode/input/InputManager.hpp"
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <string>
@@ -36,6 +37,21 @@ enum class BoxStyle
     NEON      ///< Neon glow style
 };
 
+/**
+ * @brief Animation state a text box frame is drawn from
+ */
+struct TextBoxFrame
+{
+    bool blinkState{true};  ///< Selection box shown
+};
+
+/**
+ * @brief Modal yes/no dialog
+ *
+ * update(), captureFrame() and getTimeUntilNextFrame() only touch the
+ * blink and may run on the simulation thread; the caller only steps a
+ * visible box.
+ */
 class TextBox
 {
 public:
@@ -47,7 +63,12 @@ public:
 
     void update(float deltaTime);
 
-    void render(TextRenderer* textRenderer, float32 scale = 1.0f);
+    /**
+     * @brief Copy the animation state for drawing
+     */
+    [[nodiscard]] TextBoxFrame captureFrame() const;
+
+    void render(TextRenderer* textRenderer, const TextBoxFrame& frame, float32 scale = 1.0f);
 
     void handleInput(int32 key, int32 action);
 
@@ -85,6 +106,13 @@ public:
 
     void onWindowResize(int32 screenWidth, int32 screenHeight);
 
+    /**
+     * @brief Get the time until the cursor blink next changes
+     *
+     * @return Seconds until a redraw is needed
+     */
+    [[nodiscard]] float32 getTimeUntilNextFrame() const;
+
 private:
     void moveSelectionLeft();
 
@@ -102,8 +130,10 @@ private:
     bool m_selectedOption{false};
     bool m_blinkState{true};
 
-    float32 m_blinkTimerSelected{0.0f};
     float32 m_blinkTimer{0.0f};
+    uint32 m_blinkRestartsSeen{0};
+    std::atomic<uint32> m_blinkRestarts{0};  ///< Bumped by input to restart the blink
+
     float32 m_scale{1.0f};
     Rectangle m_boxRectangle;
     Rectangle m_boxSelection;
@@ -20,6 +20,8 @@ ENABLE_DOCS=false
 ENABLE_SANITIZERS=false
 ENABLE_CLANG_TIDY=false
 ENABLE_CPPCHECK=false
+ENABLE_AVX2=false
+ENABLE_BENCHMARKS=false
 PARALLEL_JOBS=$(nproc 2>/dev/null || sysctl -n hw.ncpu 2>/dev/null || echo 4)
 
 # Function to print colored messages
@@ -56,6 +58,8 @@ OPTIONS:
     --sanitizers    Enable address and undefined behavior sanitizers
     --clang-tidy    Enable clang-tidy static analysis
     --cppcheck      Enable cppcheck static analysis
+    --avx2          Build SIMD kernels for AVX2 and FMA
+    --benchmarks    Build micro-benchmarks
     --jobs N        Number of parallel build jobs (default: $PARALLEL_JOBS)
     --help          Display this help message
 
@@ -114,6 +118,14 @@ while [[ $# -gt 0 ]]; do
             ENABLE_CPPCHECK=true
             shift
             ;;
+        --avx2)
+            ENABLE_AVX2=true
+            shift
+            ;;
+        --benchmarks)
+            ENABLE_BENCHMARKS=true
+            shift
+            ;;
         --jobs)
             PARALLEL_JOBS="$2"
             shift 2
@@ -192,6 +204,14 @@ if [ "$ENABLE_CPPCHECK" = true ]; then
     CMAKE_OPTIONS+=(-DENABLE_CPPCHECK=ON)
 fi
 
+if [ "$ENABLE_AVX2" = true ]; then
+    CMAKE_OPTIONS+=(-DENABLE_AVX2=ON)
+fi
+
+if [ "$ENABLE_BENCHMARKS" = true ]; then
+    CMAKE_OPTIONS+=(-DBUILD_BENCHMARKS=ON)
+fi
+
 # Configure step
 print_info "Configuring CMake..."
 if ! cmake "${CMAKE_OPTIONS[@]}"; then
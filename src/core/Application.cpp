@@ -10,27 +10,142 @@
 
 #include "deadcode/audio/AudioManager.hpp"
 #include "deadcode/core/Config.hpp"
+#include "deadcode/core/FramePacer.hpp"
 #include "deadcode/core/Logger.hpp"
+#include "deadcode/core/SimulationThread.hpp"
+#include "deadcode/core/TripleBuffer.hpp"
 #include "deadcode/core/Types.hpp"
 #include "deadcode/core/Version.hpp"
 #include "deadcode/game/GameLoop.hpp"
 #include "deadcode/game/GameState.hpp"
 #include "deadcode/game/SaveSystem.hpp"
+#include "deadcode/graphics/DigitalRain.hpp"
+#include "deadcode/graphics/PostProcess.hpp"
+#include "deadcode/graphics/QualityGovernor.hpp"
 #include "deadcode/graphics/Renderer.hpp"
 #include "deadcode/graphics/Window.hpp"
 #include "deadcode/input/InputManager.hpp"
 #include "deadcode/ui/StartMenu.hpp"
 #include "deadcode/ui/TextBox.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
-#include <thread>
 
 #include <raylib.h>
 
 namespace deadcode
 {
 
+namespace
+{
+constexpr float MAX_IDLE_WAIT = 1.0f;  ///< Bound on an idle sleep even if nothing is scheduled
+
+/**
+ * @brief Read graphics.post_processing from the config
+ */
+PostProcessSettings
+loadPostProcessSettings(const Config& config)
+{
+    PostProcessSettings settings;
+    settings.enabled         = config.get<bool>("graphics.post_processing.enabled", false);
+    settings.resolutionScale = config.get<float>("graphics.post_processing.resolution_scale", 1.0f);
+    settings.bilinearUpscale =
+        config.get<String>("graphics.post_processing.upscale_filter", "bilinear") != "nearest";
+
+    auto passes = config.get<std::vector<nlohmann::json>>("graphics.post_processing.passes");
+    for (const auto& entry : passes)
+    {
+        if (!entry.is_object() || !entry.contains("name"))
+        {
+            Logger::warn("Ignoring post-process pass without a name");
+            continue;
+        }
+
+        PostProcessPassSettings pass;
+        pass.name       = entry["name"].get<String>();
+        pass.shaderPath = entry.value("shader", "assets/shaders/post_" + pass.name + ".frag");
+        pass.enabled    = entry.value("enabled", true);
+
+        String quality = entry.value("quality", String("medium"));
+        pass.quality   = quality == "low"    ? PostProcessQuality::Low
+                         : quality == "high" ? PostProcessQuality::High
+                                             : PostProcessQuality::Medium;
+
+        settings.passes.push_back(std::move(pass));
+    }
+
+    return settings;
+}
+
+/**
+ * @brief Read graphics.rendering.dynamic_resolution from the config
+ *
+ * @param maxScale Render scale at the top level (the post-processing scale)
+ * @param targetFPS Frame rate the default budget is derived from
+ */
+QualityGovernorSettings
+loadQualityGovernorSettings(const Config& config, float maxScale, int targetFPS)
+{
+    const String prefix = "graphics.rendering.dynamic_resolution.";
+
+    float defaultBudget = targetFPS > 0 ? 1000.0f / static_cast<float>(targetFPS) : 16.6f;
+
+    QualityGovernorSettings settings;
+    settings.enabled         = config.get<bool>(prefix + "enabled", false);
+    settings.targetFrameTime = config.get<float>(prefix + "target_frame_ms", defaultBudget) /
+                               1000.0f;
+    settings.maxScale       = maxScale;
+    settings.minScale       = config.get<float>(prefix + "min_scale", 0.5f);
+    settings.scaleStep      = config.get<float>(prefix + "scale_step", 0.125f);
+    settings.sampleFrames   = config.get<uint32>(prefix + "sample_frames", 30);
+    settings.downgradeAt    = config.get<float>(prefix + "downgrade_threshold", 1.1f);
+    settings.upgradeAt      = config.get<float>(prefix + "upgrade_threshold", 0.6f);
+    settings.cooldownFrames = config.get<uint32>(prefix + "cooldown_frames", 60);
+    return settings;
+}
+
+/**
+ * @brief Read graphics.background.digital_rain from the config
+ */
+DigitalRainSettings
+loadDigitalRainSettings(const Config& config)
+{
+    const String prefix = "graphics.background.digital_rain.";
+
+    DigitalRainSettings settings;
+    settings.enabled    = config.get<bool>(prefix + "enabled", settings.enabled);
+    settings.budgetMs   = config.get<float>(prefix + "budget_ms", settings.budgetMs);
+    settings.stepRate   = config.get<float>(prefix + "step_rate", settings.stepRate);
+    settings.scale      = config.get<float>(prefix + "scale", settings.scale);
+    settings.minDensity = config.get<float>(prefix + "min_density", settings.minDensity);
+    settings.brightness = config.get<float>(prefix + "brightness", settings.brightness);
+    settings.glyphs     = config.get<String>(prefix + "glyphs", settings.glyphs);
+    return settings;
+}
+}  // namespace
+
+/**
+ * @brief Main thread state the simulation steps with
+ */
+struct Application::SimulationInput
+{
+    GameState gameState{GameState::MainMenu};
+    bool textBoxVisible{false};
+};
+
+/**
+ * @brief Animation state the main thread draws, published by the simulation
+ */
+struct Application::FrameSnapshot
+{
+    uint64 tick{0};
+    SimulationThread::Clock::time_point stateTime;  ///< When the state was current
+    float timeUntilNextChange{0.0f};                ///< Negative if nothing is scheduled
+    StartMenuFrame menu;
+    TextBoxFrame textBox;
+};
+
 // Pimpl implementation
 struct Application::Impl
 {
@@ -44,8 +159,22 @@ struct Application::Impl
     UniquePtr<TextBox> textBox;
     UniquePtr<GameLoop> gameLoop;
 
+    QualityGovernor qualityGovernor;
+    FramePacer framePacer;
+
     std::chrono::high_resolution_clock::time_point lastFrameTime;
     float deltaTime{0.0f};
+    float lastWorkTime{-1.0f};  ///< Busy time of the previous frame, negative if it idled
+    bool idleRendering{true};   ///< Sleep between frames while the menu is static
+    bool vsync{true};           ///< Vsync requested in the config
+
+    // Simulation runs on its own thread; the two sides only meet in these buffers
+    SimulationSettings simulationSettings;
+    SimulationThread simulation;
+    TripleBuffer<SimulationInput> simulationInput;  ///< Main thread to simulation
+    TripleBuffer<FrameSnapshot> frames;             ///< Simulation to main thread
+    SimulationInput lastInput;                      ///< Last input handed over
+    bool inputHandled{false};                       ///< Key input this frame
 };
 
 Application::Application()
@@ -131,6 +260,11 @@ Application::initialize(int argc, char** argv)
         return false;
     }
 
+    if (!startSimulation())
+    {
+        return false;
+    }
+
     m_impl->lastFrameTime = std::chrono::high_resolution_clock::now();
     m_initialized         = true;
 
@@ -163,6 +297,8 @@ Application::run()
             m_currentFPS = 1.0f / m_impl->deltaTime;
         }
 
+        updateQualityGovernor(m_impl->deltaTime);
+
         // Check for window resize
         handleWindowResize();
 
@@ -173,11 +309,36 @@ Application::run()
         }
 
         processInput(m_impl->deltaTime);
-        update(m_impl->deltaTime);
-        render(m_impl->deltaTime);
-
-        // Raylib handles frame timing internally via SetTargetFPS
-        // No need for manual syncFrameRate
+        bool inputChanged = handOverInput();
+
+        // Without a worker thread the simulation catches up here
+        m_impl->simulation.advance(m_impl->deltaTime, m_impl->lastWorkTime < 0.0f);
+
+        // Draw the newest published state, motion extrapolated to now
+        m_impl->frames.acquire();
+        const FrameSnapshot& frame = m_impl->frames.getFrontBuffer();
+        std::chrono::duration<float> stateAge = SimulationThread::Clock::now() - frame.stateTime;
+        float alpha = std::clamp(stateAge.count() / m_impl->simulation.getStep(), 0.0f, 1.0f);
+        render(frame, alpha);
+
+        // Nothing changes on an idle menu until the next blink/glitch, sleep until then.
+        // Input and window events end the wait early.
+        // A frame with fresh input draws again, the simulation has yet to react to it.
+        bool canIdle      = m_impl->idleRendering && !inputChanged;
+        float idleTimeout = canIdle ? getIdleTimeout(frame) : 0.0f;
+        std::chrono::duration<float> spent = std::chrono::high_resolution_clock::now() -
+                                             currentTime;
+        if (idleTimeout > 0.0f)
+        {
+            m_impl->window->waitEvents(static_cast<double>(idleTimeout));
+            m_impl->lastWorkTime = -1.0f;
+            m_impl->framePacer.resync();
+        }
+        else
+        {
+            m_impl->lastWorkTime = spent.count() - m_impl->renderer->getLastPresentTime();
+            m_impl->framePacer.waitForNextFrame();
+        }
     }
 
     m_running = false;
@@ -189,6 +350,11 @@ Application::shutdown()
 {
     Logger::info("Shutting down application...");
 
+    m_impl->framePacer.logStats();
+
+    // Nothing may step the subsystems while they go away
+    m_impl->simulation.stop();
+
     // Shutdown subsystems in reverse order
     if (m_impl->audioManager)
     {
@@ -200,6 +366,9 @@ Application::shutdown()
         m_impl->inputManager->shutdown();
     }
 
+    // The menu's options grid hands its render texture back to the renderer's backend
+    m_impl->mainMenu.reset();
+
     if (m_impl->renderer)
     {
         m_impl->renderer->shutdown();
@@ -244,6 +413,11 @@ Application::setTargetFPS(int fps)
 {
     m_targetFPS = fps;
     Logger::info("Target FPS set to: {}", fps);
+
+    if (m_impl->window)
+    {
+        configureFramePacing();
+    }
 }
 
 float
@@ -281,12 +455,15 @@ Application::initializeWindow()
 
     m_impl->window = std::make_unique<Window>();
 
+    m_targetFPS   = m_impl->config->get<int>("graphics.rendering.target_fps", m_targetFPS);
+    m_impl->vsync = m_impl->config->get<bool>("graphics.window.vsync", true);
+
     WindowConfig config;
     config.title     = Version::getGameTitleWithVersion() + " - Text-Based RPG";
     config.width     = 800;
     config.height    = 600;
-    config.vsync     = true;
-    config.targetFPS = m_targetFPS;
+    config.vsync     = false;  // Decided by configureFramePacing() once the monitor is known
+    config.targetFPS = 0;      // FramePacer holds the frame rate, not Raylib
 
     if (!m_impl->window->create(config))
     {
@@ -294,9 +471,25 @@ Application::initializeWindow()
         return false;
     }
 
+    configureFramePacing();
     return true;
 }
 
+void
+Application::configureFramePacing()
+{
+    // Vsync can only hold the monitor's own rate, any other target is paced by hand
+    int32 refreshRate = m_impl->window->getRefreshRate();
+    bool vsyncPaced   = m_impl->vsync && m_targetFPS > 0 && refreshRate == m_targetFPS;
+
+    m_impl->window->setVSync(vsyncPaced);
+    m_impl->framePacer.setTargetFPS(m_targetFPS);
+    m_impl->framePacer.setVSyncPaced(vsyncPaced);
+
+    Logger::info("Frame pacing: {} FPS target, {} Hz monitor, {}", m_targetFPS, refreshRate,
+                 vsyncPaced ? "vsync" : "sleep and spin");
+}
+
 bool
 Application::initializeRenderer()
 {
@@ -310,16 +503,41 @@ Application::initializeRenderer()
         return false;
     }
 
-    // Load font
-    if (!m_impl->renderer->getTextRenderer()->loadFont("assets/fonts/PixelOperator-Bold.ttf", 52))
+    // Load font (an SDF atlas stays crisp at every UI scale)
+    m_impl->idleRendering = m_impl->config->get<bool>("graphics.rendering.idle_rendering", true);
+
+    String atlas = m_impl->config->get<String>("graphics.rendering.font_atlas", "sdf");
+    FontAtlasMode atlasMode = (atlas == "bitmap") ? FontAtlasMode::Bitmap : FontAtlasMode::SDF;
+    if (!m_impl->renderer->getTextRenderer()->loadFont("assets/fonts/PixelOperator-Bold.ttf", 52,
+                                                       atlasMode))
     {
         Logger::error("Failed to load font");
         return false;
     }
 
+    // Box drawing and Nerd Font symbols come from fallback fonts, rasterized on first use
+    auto fallbackFonts = m_impl->config->get<std::vector<String>>(
+        "graphics.rendering.fallback_fonts",
+        {"assets/fonts/dos-vga-win.ttf", "assets/fonts/JetBrainsMonoNerdFont-Regular.ttf"});
+    for (const auto& fallbackFont : fallbackFonts)
+    {
+        m_impl->renderer->getTextRenderer()->addFallbackFont(fallbackFont);
+    }
+
     // Set clear color to dark blue
     m_impl->renderer->setClearColor(glm::vec3(0.0f, 0.0f, 0.0f));
 
+    // CRT look: full-screen passes at a reduced internal resolution
+    PostProcessSettings postProcess = loadPostProcessSettings(*m_impl->config);
+    if (!m_impl->renderer->configurePostProcess(postProcess))
+    {
+        Logger::warn("Post-processing unavailable, drawing straight to the screen");
+    }
+
+    // Trades render scale and effect detail for frame time on slow machines
+    m_impl->qualityGovernor.initialize(loadQualityGovernorSettings(
+        *m_impl->config, postProcess.resolutionScale, m_targetFPS));
+
     return true;
 }
 
@@ -394,6 +612,7 @@ Application::initializeGame()
         Logger::error("Failed to initialize start menu");
         return false;
     }
+    m_impl->mainMenu->setBackgroundRain(loadDigitalRainSettings(*m_impl->config));
 
     // Setup menu callbacks
     setupMainMenu();
@@ -426,6 +645,15 @@ Application::initializeGameLoop()
         return false;
     }
 
+    // Updates run at a fixed rate, independent of the display
+    int tickRate = std::clamp(m_impl->config->get<int>("game.simulation.tick_rate", 120), 10, 1000);
+    int catchUp  = std::max(m_impl->config->get<int>("game.simulation.max_catch_up_steps", 5), 1);
+
+    SimulationSettings& simulation = m_impl->simulationSettings;
+    simulation.step                = 1.0f / static_cast<float>(tickRate);
+    simulation.maxCatchUpSteps     = static_cast<uint32>(catchUp);
+    simulation.threaded            = m_impl->config->get<bool>("game.simulation.threaded", true);
+
     return true;
 }
 
@@ -455,63 +683,165 @@ Application::processInput(float deltaTime)
 void
 Application::update(float deltaTime)
 {
-    if (m_gameState == GameState::MainMenu && m_impl->mainMenu)
+    // Runs on the simulation thread: main thread state only arrives through the input buffer
+    m_impl->simulationInput.acquire();
+    const SimulationInput& input = m_impl->simulationInput.getFrontBuffer();
+
+    if (input.gameState == GameState::MainMenu && m_impl->mainMenu)
     {
         m_impl->mainMenu->update(deltaTime);
-        if (m_impl->textBox->isVisible())
+        if (input.textBoxVisible)
         {
             m_impl->textBox->update(deltaTime);
         }
     }
-    else if (m_gameState == GameState::Playing)
+    else if (input.gameState == GameState::Playing)
     {
         m_impl->gameLoop->update(deltaTime);
     }
 }
 
-void
-Application::render(float deltaTime)
+bool
+Application::startSimulation()
 {
-    (void) deltaTime;  // Unused for now
+    return m_impl->simulation.start(
+        m_impl->simulationSettings, [this](float32 step) { update(step); },
+        [this](uint64 tick, SimulationThread::Clock::time_point stateTime) {
+            return publishFrame(tick, stateTime);
+        });
+}
 
+bool
+Application::handOverInput()
+{
+    SimulationInput& input = m_impl->simulationInput.getBackBuffer();
+    input.gameState        = m_gameState;
+    input.textBoxVisible   = m_impl->textBox && m_impl->textBox->isVisible();
+
+    bool changed = m_impl->inputHandled || input.gameState != m_impl->lastInput.gameState ||
+                   input.textBoxVisible != m_impl->lastInput.textBoxVisible;
+    m_impl->lastInput    = input;
+    m_impl->inputHandled = false;
+    m_impl->simulationInput.publish();
+
+    // The simulation may be sleeping through a static menu
+    if (changed)
+    {
+        m_impl->simulation.wake();
+    }
+    return changed;
+}
+
+float
+Application::publishFrame(uint64 tick, SimulationThread::Clock::time_point stateTime)
+{
+    const SimulationInput& input = m_impl->simulationInput.getFrontBuffer();
+
+    // Only the menu holds still between changes, everything else animates every step
+    float untilChange = 0.0f;
+    if (input.gameState == GameState::MainMenu && m_impl->mainMenu)
+    {
+        untilChange = m_impl->mainMenu->getTimeUntilNextFrame();
+        if (input.textBoxVisible)
+        {
+            untilChange = std::min(untilChange, m_impl->textBox->getTimeUntilNextFrame());
+        }
+    }
+
+    FrameSnapshot& frame      = m_impl->frames.getBackBuffer();
+    frame.tick                = tick;
+    frame.stateTime           = stateTime;
+    frame.timeUntilNextChange = untilChange;
+    frame.menu    = m_impl->mainMenu ? m_impl->mainMenu->captureFrame() : StartMenuFrame{};
+    frame.textBox = m_impl->textBox ? m_impl->textBox->captureFrame() : TextBoxFrame{};
+    m_impl->frames.publish();
+
+    return untilChange;
+}
+
+float
+Application::getIdleTimeout(const FrameSnapshot& frame) const
+{
+    if (m_gameState != GameState::MainMenu || !m_impl->mainMenu)
+        return 0.0f;
+
+    // The snapshot counts from when its state was current
+    float next = MAX_IDLE_WAIT;
+    if (frame.timeUntilNextChange >= 0.0f)
+    {
+        std::chrono::duration<float> age = SimulationThread::Clock::now() - frame.stateTime;
+        next = std::min(next, frame.timeUntilNextChange - age.count());
+    }
+
+    // The frame limiter already sleeps that long, waiting would only add jitter
+    float frameTime = m_targetFPS > 0 ? 1.0f / static_cast<float>(m_targetFPS) : 0.0f;
+    return next > frameTime ? next : 0.0f;
+}
+
+void
+Application::render(const FrameSnapshot& frame, float alpha)
+{
     if (!m_impl->renderer)
         return;
 
     m_impl->renderer->beginFrame();
 
+    // Time-driven motion is drawn where it is now, not at the last simulation step
+    if (m_impl->mainMenu)
+    {
+        m_impl->mainMenu->setRenderTimeOffset(alpha * m_impl->simulation.getStep());
+    }
+
     auto* textRenderer = m_impl->renderer->getTextRenderer();
 
     if (m_gameState == GameState::MainMenu && m_impl->mainMenu && textRenderer)
     {
         // Render main menu
-        m_impl->mainMenu->render(textRenderer);
+        m_impl->mainMenu->render(m_impl->renderer.get(), frame.menu);
     }
     else if (m_gameState == GameState::Playing && textRenderer)
     {
         m_impl->gameLoop->render(textRenderer);
     }
 
-    m_impl->textBox->render(textRenderer);
+    // The dialog covers whatever the menu or game drew this frame
+    m_impl->renderer->setDrawLayer(DrawLayer::OVERLAY);
+    m_impl->textBox->render(textRenderer, frame.textBox);
+    m_impl->renderer->setDrawLayer(DrawLayer::DEFAULT);
 
     m_impl->renderer->endFrame();
 }
 
 void
-Application::syncFrameRate()
+Application::updateQualityGovernor(float frameTime)
 {
-    if (m_targetFPS <= 0)
+    // Frames that slept on purpose say nothing about the budget
+    if (m_impl->lastWorkTime < 0.0f)
     {
-        return;  // Unlimited FPS
+        m_impl->qualityGovernor.resetSamples();
+        return;
     }
 
-    auto targetFrameTime = std::chrono::duration<float>(1.0f / static_cast<float>(m_targetFPS));
-    auto currentTime     = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<float> frameTime = currentTime - m_impl->lastFrameTime;
+    if (m_impl->qualityGovernor.addFrame(frameTime, m_impl->lastWorkTime))
+    {
+        applyQualityLevel();
+    }
+}
+
+void
+Application::applyQualityLevel()
+{
+    const QualityLevel& level = m_impl->qualityGovernor.getLevel();
 
-    if (frameTime < targetFrameTime)
+    if (PostProcessChain* postProcess = m_impl->renderer->getPostProcess())
     {
-        auto sleepTime = targetFrameTime - frameTime;
-        std::this_thread::sleep_for(sleepTime);
+        postProcess->setResolutionScale(level.resolutionScale);
+        postProcess->setEffectQuality(level.effects);
+    }
+
+    if (m_impl->mainMenu)
+    {
+        m_impl->mainMenu->setEffectQuality(level.effects);
     }
 }
 
@@ -559,6 +889,8 @@ Application::handleKeyInput(int key, int scancode, int action, int mods)
     (void) scancode;  // Unused for now
     (void) mods;      // Unused for now
 
+    m_impl->inputHandled = true;
+
     if (m_gameState == GameState::MainMenu && m_impl->mainMenu && !m_impl->textBox->isVisible())
     {
         m_impl->mainMenu->handleInput(key, action);
@@ -607,6 +939,9 @@ Application::handleWindowResize()
 
         Logger::info("Window resized to {}x{}", currentWidth, currentHeight);
 
+        // Recreating targets and layouts makes the next frames slow, that is not a trend
+        m_impl->qualityGovernor.resetSamples();
+
         // Update text renderer projection
         if (m_impl->renderer && m_impl->renderer->getTextRenderer())
         {
@@ -0,0 +1,224 @@
+/**
+ * @file FramePacer.cpp
+ * @brief Implementation of FramePacer class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-26
+ */
+
+#include "deadcode/core/FramePacer.hpp"
+
+#include "deadcode/core/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace deadcode
+{
+
+namespace
+{
+using namespace std::chrono_literals;
+
+// Spin window bounds; the OS usually oversleeps 50-100 us, so this stays sub-millisecond
+constexpr FramePacer::Clock::duration MIN_SPIN = 200us;
+constexpr FramePacer::Clock::duration MAX_SPIN = 2ms;
+
+/// Weight of the newest oversleep sample in the smoothed value
+constexpr float64 OVERSHOOT_SMOOTHING = 0.1;
+
+float64
+toSeconds(FramePacer::Clock::duration duration)
+{
+    return std::chrono::duration<float64>(duration).count();
+}
+}  // namespace
+
+float64
+FramePacerStats::getMeanWakeError() const
+{
+    return waits > 0 ? totalWakeError / static_cast<float64>(waits) : 0.0;
+}
+
+float64
+FramePacerStats::getJitter() const
+{
+    return frames > 0 ? std::sqrt(totalDeviationSquared / static_cast<float64>(frames)) : 0.0;
+}
+
+FramePacer::FramePacer()
+    : m_period(Clock::duration::zero()),
+      m_sleepOvershoot(100us),
+      m_targetFPS(0),
+      m_vsyncPaced(false),
+      m_scheduled(false)
+{
+}
+
+void
+FramePacer::setTargetFPS(int32 fps)
+{
+    m_targetFPS = std::max(fps, 0);
+    m_period    = m_targetFPS > 0 ? std::chrono::duration_cast<Clock::duration>(
+                                     std::chrono::duration<float64>(1.0 / m_targetFPS))
+                                  : Clock::duration::zero();
+    resync();
+    resetStats();
+}
+
+int32
+FramePacer::getTargetFPS() const
+{
+    return m_targetFPS;
+}
+
+void
+FramePacer::setVSyncPaced(bool vsyncPaced)
+{
+    m_vsyncPaced = vsyncPaced;
+    resync();
+}
+
+void
+FramePacer::waitForNextFrame()
+{
+    Clock::time_point now = Clock::now();
+    if (!m_scheduled)
+    {
+        m_lastFrame = now;
+        m_deadline  = now + m_period;
+        m_scheduled = true;
+        return;
+    }
+
+    if (m_period > Clock::duration::zero() && !m_vsyncPaced)
+    {
+        if (now < m_deadline)
+        {
+            waitUntil(m_deadline);
+            now = Clock::now();
+
+            float64 wakeError = toSeconds(now - m_deadline);
+            m_stats.waits++;
+            m_stats.totalWakeError += wakeError;
+            m_stats.maxWakeError = std::max(m_stats.maxWakeError, wakeError);
+            m_deadline += m_period;
+        }
+        else
+        {
+            m_stats.missedDeadlines++;
+
+            // More than a frame behind: start over instead of rushing frames to catch up
+            m_deadline += m_period;
+            if (now >= m_deadline)
+            {
+                m_deadline = now + m_period;
+            }
+        }
+    }
+
+    recordFrame(now - m_lastFrame);
+    m_lastFrame = now;
+}
+
+void
+FramePacer::resync()
+{
+    m_scheduled = false;
+}
+
+const FramePacerStats&
+FramePacer::getStats() const
+{
+    return m_stats;
+}
+
+void
+FramePacer::resetStats()
+{
+    m_stats = FramePacerStats{};
+}
+
+void
+FramePacer::logStats() const
+{
+    if (m_stats.frames == 0 || m_period == Clock::duration::zero())
+        return;
+
+    Logger::info("Frame pacing at {} FPS{}: {} frames, {} missed, jitter {:.3f} ms, "
+                 "wake error mean {:.3f} ms / max {:.3f} ms",
+                 m_targetFPS, m_vsyncPaced ? " (vsync)" : "", m_stats.frames,
+                 m_stats.missedDeadlines, m_stats.getJitter() * 1000.0,
+                 m_stats.getMeanWakeError() * 1000.0, m_stats.maxWakeError * 1000.0);
+
+    // One line per non-empty bucket, labelled by its range in microseconds
+    const auto& edges = FramePacerStats::BUCKET_EDGES;
+    for (size_t i = 0; i < FramePacerStats::BUCKET_COUNT; ++i)
+    {
+        uint64 count = m_stats.deviationHistogram[i];
+        if (count == 0)
+            continue;
+
+        float64 share = 100.0 * static_cast<float64>(count) / static_cast<float64>(m_stats.frames);
+        if (i == 0)
+        {
+            Logger::info("  frame time deviation < {} us: {} ({:.1f}%)", edges[0], count, share);
+        }
+        else if (i == edges.size())
+        {
+            Logger::info("  frame time deviation >= {} us: {} ({:.1f}%)", edges[i - 1], count,
+                         share);
+        }
+        else
+        {
+            Logger::info("  frame time deviation {} to {} us: {} ({:.1f}%)", edges[i - 1],
+                         edges[i], count, share);
+        }
+    }
+}
+
+void
+FramePacer::waitUntil(Clock::time_point deadline)
+{
+    Clock::duration spin = std::clamp(m_sleepOvershoot * 3 / 2, MIN_SPIN, MAX_SPIN);
+
+    Clock::time_point wakeTarget = deadline - spin;
+    Clock::time_point now        = Clock::now();
+    if (now < wakeTarget)
+    {
+        std::this_thread::sleep_for(wakeTarget - now);
+
+        // Learn how late the OS wakes us, so the spin covers it
+        Clock::duration overshoot = std::max(Clock::now() - wakeTarget, Clock::duration::zero());
+        m_sleepOvershoot          = std::chrono::duration_cast<Clock::duration>(
+            m_sleepOvershoot * (1.0 - OVERSHOOT_SMOOTHING) + overshoot * OVERSHOOT_SMOOTHING);
+    }
+
+    while (Clock::now() < deadline)
+    {
+        std::this_thread::yield();
+    }
+}
+
+void
+FramePacer::recordFrame(Clock::duration frameTime)
+{
+    float64 deviation = toSeconds(frameTime - m_period);
+
+    m_stats.frames++;
+    m_stats.totalDeviation += deviation;
+    m_stats.totalDeviationSquared += deviation * deviation;
+
+    // Unlimited frame rates have no target to deviate from
+    if (m_period == Clock::duration::zero())
+        return;
+
+    auto micros = static_cast<int32>(std::clamp(deviation * 1000000.0, -1.0e9, 1.0e9));
+    const auto& edges = FramePacerStats::BUCKET_EDGES;
+    auto bucket = static_cast<size_t>(std::upper_bound(edges.begin(), edges.end(), micros) -
+                                      edges.begin());
+    m_stats.deviationHistogram[bucket]++;
+}
+
+}  // namespace deadcode
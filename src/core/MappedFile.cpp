@@ -0,0 +1,145 @@
+/**
+ * @file MappedFile.cpp
+ * @brief Implementation of MappedFile class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-17
+ */
+
+#include "deadcode/core/MappedFile.hpp"
+
+#include <utility>
+
+#ifdef _WIN32
+// Keep GDI/USER out, their names clash with Raylib's
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI
+#define NOUSER
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace deadcode
+{
+
+MappedFile::MappedFile() : m_data(nullptr), m_size(0) {}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0))
+{
+}
+
+MappedFile&
+MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+}
+
+bool
+MappedFile::open(const String& path)
+{
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+        return false;
+
+    // The view keeps the mapping object alive
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (view == nullptr)
+        return false;
+
+    m_data = static_cast<const uint8*>(view);
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(info.st_size);
+    void* view  = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+    if (view == MAP_FAILED)
+        return false;
+
+    m_data = static_cast<const uint8*>(view);
+    m_size = size;
+#endif
+
+    return true;
+}
+
+void
+MappedFile::close()
+{
+    if (m_data == nullptr)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+#else
+    munmap(const_cast<uint8*>(m_data), m_size);
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+bool
+MappedFile::isOpen() const
+{
+    return m_data != nullptr;
+}
+
+const uint8*
+MappedFile::getData() const
+{
+    return m_data;
+}
+
+size_t
+MappedFile::getSize() const
+{
+    return m_size;
+}
+
+}  // namespace deadcode
@@ -0,0 +1,197 @@
+/**
+ * @file SimulationThread.cpp
+ * @brief Implementation of SimulationThread class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-27
+ */
+
+#include "deadcode/core/SimulationThread.hpp"
+
+#include "deadcode/core/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <system_error>
+
+namespace deadcode
+{
+
+namespace
+{
+constexpr float32 MAX_IDLE_SLEEP = 1.0f;  ///< Bound on an idle sleep even if nothing is scheduled
+
+SimulationThread::Clock::duration
+toDuration(float32 seconds)
+{
+    return std::chrono::duration_cast<SimulationThread::Clock::duration>(
+        std::chrono::duration<float32>(seconds));
+}
+}  // namespace
+
+SimulationThread::SimulationThread()
+    : m_accumulator(0.0f),
+      m_tick(0),
+      m_running(false),
+      m_wakeRequested(false)
+{
+}
+
+SimulationThread::~SimulationThread()
+{
+    stop();
+}
+
+bool
+SimulationThread::start(const SimulationSettings& settings, StepFunction step,
+                        PublishFunction publish)
+{
+    stop();
+
+    m_settings                 = settings;
+    m_settings.step            = std::clamp(m_settings.step, 0.001f, 0.1f);
+    m_settings.maxCatchUpSteps = std::max(m_settings.maxCatchUpSteps, 1u);
+    m_step                     = std::move(step);
+    m_publish                  = std::move(publish);
+    m_accumulator              = 0.0f;
+    m_tick                     = 0;
+
+    // The render thread has a snapshot to draw before the first step
+    m_publish(m_tick, Clock::now());
+
+    if (m_settings.threaded)
+    {
+        m_running.store(true, std::memory_order_release);
+        try
+        {
+            m_worker = std::thread(&SimulationThread::run, this);
+        }
+        catch (const std::system_error& e)
+        {
+            Logger::warn("Failed to start simulation thread ({}), simulating on the main thread",
+                         e.what());
+            m_running.store(false, std::memory_order_release);
+            m_settings.threaded = false;
+        }
+    }
+
+    Logger::info("Simulation: {:.0f} Hz on the {} thread, up to {} catch-up steps",
+                 1.0f / m_settings.step, m_settings.threaded ? "worker" : "main",
+                 m_settings.maxCatchUpSteps);
+    return true;
+}
+
+void
+SimulationThread::stop()
+{
+    if (!m_worker.joinable())
+        return;
+
+    {
+        // Under the lock, so a worker about to sleep cannot miss it
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_running.store(false, std::memory_order_release);
+    }
+    m_wakeCondition.notify_one();
+    m_worker.join();
+}
+
+void
+SimulationThread::advance(float32 elapsed, bool resumed)
+{
+    if (m_settings.threaded || !m_step)
+        return;
+
+    runSteps(elapsed, resumed, Clock::now());
+}
+
+void
+SimulationThread::wake()
+{
+    if (!m_settings.threaded)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_wakeRequested = true;
+    }
+    m_wakeCondition.notify_one();
+}
+
+bool
+SimulationThread::isThreaded() const
+{
+    return m_settings.threaded;
+}
+
+float32
+SimulationThread::getStep() const
+{
+    return m_settings.step;
+}
+
+void
+SimulationThread::run()
+{
+    Clock::time_point previous = Clock::now();
+    bool resumed               = false;
+
+    while (m_running.load(std::memory_order_acquire))
+    {
+        Clock::time_point now = Clock::now();
+        float32 elapsed       = std::chrono::duration<float32>(now - previous).count();
+        previous              = now;
+
+        float32 untilChange = runSteps(elapsed, resumed, now);
+        resumed             = false;
+
+        if (untilChange > m_settings.step)
+        {
+            // Nothing moves until then: sleep instead of ticking, input ends it early
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_wakeCondition.wait_for(lock, toDuration(std::min(untilChange, MAX_IDLE_SLEEP)),
+                                     [this] {
+                                         return m_wakeRequested ||
+                                                !m_running.load(std::memory_order_acquire);
+                                     });
+            m_wakeRequested = false;
+            resumed         = true;
+            continue;
+        }
+
+        std::this_thread::sleep_until(now + toDuration(m_settings.step - m_accumulator));
+    }
+}
+
+float32
+SimulationThread::runSteps(float32 elapsed, bool resumed, Clock::time_point now)
+{
+    float32 step = m_settings.step;
+    m_accumulator += elapsed;
+
+    // A deliberate sleep is simulated in full, nothing moved during it. After a hitch only a
+    // few steps catch up and the rest of the time is dropped, so timers and tweens never jump.
+    uint32 maxSteps = resumed ? static_cast<uint32>(std::ceil(m_accumulator / step))
+                              : m_settings.maxCatchUpSteps;
+
+    uint32 steps = 0;
+    while (m_accumulator >= step && steps < maxSteps)
+    {
+        m_step(step);
+        m_accumulator -= step;
+        m_tick++;
+        steps++;
+    }
+
+    if (m_accumulator >= step)
+    {
+        float32 dropped = m_accumulator - std::fmod(m_accumulator, step);
+        Logger::debug("Simulation fell behind, dropping {:.1f} ms", dropped * 1000.0f);
+        m_accumulator -= dropped;
+    }
+
+    // The state is as of the last step, which lags the clock by the leftover time
+    return m_publish(m_tick, now - toDuration(m_accumulator));
+}
+
+}  // namespace deadcode
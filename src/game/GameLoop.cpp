@@ -8,6 +8,7 @@
 #include "deadcode/game/GameLoop.hpp"
 
 #include "deadcode/core/Logger.hpp"
+#include "deadcode/graphics/TextRenderer.hpp"
 #include "deadcode/input/TextInput.hpp"
 
 #include <glm/fwd.hpp>
@@ -51,7 +52,7 @@ GameLoop::render(TextRenderer* textRenderer)
                              m_screenWidth - (textRenderer->getTextWidth("ST", 0.5F)) - 20, 20,
                              0.5F, glm::vec3(1.0F, 1.0F, 1.0F));
 
-    m_textInput->render(80, m_screenHeight - 100);
+    m_textInput->render(textRenderer->getBackend(), 80, m_screenHeight - 100);
 
     // textRenderer->renderText("Hello World",
     //                          (m_screenWidth / 2.0F) -
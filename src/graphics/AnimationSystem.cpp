@@ -1,6 +1,6 @@
 /**
  * @file AnimationSystem.cpp
- * @brief Implementation of animation system using tweeny library
+ * @brief Implementation of animation system with typed tween and keyframe pools
  *
  * @author 0xDEADC0DE Team
  * @date 2026-01-30
@@ -12,577 +12,768 @@
 
 #include <algorithm>
 
-#include <tweeny.h>
-
 namespace deadcode
 {
 
 // ============================================================================
-// TWEENY-BASED ANIMATION IMPLEMENTATION
+// INTERPOLATOR IMPLEMENTATIONS
 // ============================================================================
 
-template <typename T>
-class TweenyAnimation : public IAnimation
+float32
+Interpolator<float32>::interpolate(float32 start, float32 end, float32 t,
+                                   EasingType easing)
 {
-public:
-    TweenyAnimation(std::uint32_t id, T& target, tweeny::tween<T> tween,
-                    std::function<void()> onComplete)
-        : m_id(id), m_target(target), m_tween(tween), m_onComplete(onComplete), m_complete(false)
-    {
-    }
-
-    bool
-    update(float32 deltaTime) override
-    {
-        if (m_complete)
-            return false;
-
-        // tweeny uses milliseconds, convert deltaTime (seconds) to ms
-        int32_t stepMs = static_cast<int32_t>(deltaTime * 1000.0f);
-        m_tween.step(stepMs);
-        m_target = m_tween.peek();
-
-        if (m_tween.progress() >= 1.0f)
-        {
-            m_complete = true;
-            if (m_onComplete)
-            {
-                m_onComplete();
-            }
-            return false;
-        }
-
-        return true;
-    }
-
-    bool
-    isComplete() const override
-    {
-        return m_complete;
-    }
-
-    void
-    reset() override
-    {
-        m_complete = false;
-        m_tween.seek(0);
-        m_target = m_tween.peek();
-    }
+    float32 easedT = Easing::evaluate(easing, t);
+    return start + (end - start) * easedT;
+}
 
-    std::uint32_t
-    getID() const override
-    {
-        return m_id;
-    }
+glm::vec2
+Interpolator<glm::vec2>::interpolate(const glm::vec2& start, const glm::vec2& end, float32 t,
+                                     EasingType easing)
+{
+    float32 easedT = Easing::evaluate(easing, t);
+    return start + (end - start) * easedT;
+}
 
-    AnimationProperty
-    getProperty() const override
-    {
-        return AnimationProperty::Custom;
-    }
+glm::vec3
+Interpolator<glm::vec3>::interpolate(const glm::vec3& start, const glm::vec3& end, float32 t,
+                                     EasingType easing)
+{
+    float32 easedT = Easing::evaluate(easing, t);
+    return start + (end - start) * easedT;
+}
 
-private:
-    std::uint32_t m_id;
-    T& m_target;
-    tweeny::tween<T> m_tween;
-    std::function<void()> m_onComplete;
-    bool m_complete;
-};
+glm::vec4
+Interpolator<glm::vec4>::interpolate(const glm::vec4& start, const glm::vec4& end, float32 t,
+                                     EasingType easing)
+{
+    float32 easedT = Easing::evaluate(easing, t);
+    return start + (end - start) * easedT;
+}
 
 // ============================================================================
-// EASING FUNCTION IMPLEMENTATIONS (Placeholder - using tweeny's defaults)
+// ANIMATION SYSTEM IMPLEMENTATION
 // ============================================================================
 
-namespace Easing
+namespace
 {
+constexpr uint32 INDEX_BITS      = 20;  ///< Up to ~1M slots, the rest is generation
+constexpr uint32 INDEX_MASK      = (1u << INDEX_BITS) - 1;
+constexpr uint32 GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1;
+constexpr uint32 NO_FREE_SLOT    = INDEX_MASK;  ///< Also caps the slot count
 
-// For now, these return the t value directly since tweeny handles easing internally
-// TODO: Properly integrate with tweeny's easing system which uses different signature
-float32
-linear(float32 t)
+uint32
+makeHandle(uint32 index, uint32 generation)
 {
-    return t;
+    return (generation << INDEX_BITS) | index;
 }
 
-float32
-easeInQuad(float32 t)
+uint32
+getHandleIndex(uint32 handle)
 {
-    return t * t;
+    return handle & INDEX_MASK;
 }
 
-float32
-easeOutQuad(float32 t)
+uint32
+getHandleGeneration(uint32 handle)
 {
-    return 1.0f - (1.0f - t) * (1.0f - t);
+    return handle >> INDEX_BITS;
 }
 
-float32
-easeInOutQuad(float32 t)
+/// Generations skip 0, so no valid handle is ever 0
+uint32
+nextGeneration(uint32 generation)
 {
-    return t < 0.5f ? 2.0f * t * t : 1.0f - std::pow(-2.0f * t + 2.0f, 2.0f) / 2.0f;
+    uint32 next = (generation + 1) & GENERATION_MASK;
+    return next == 0 ? 1 : next;
 }
+}  // namespace
 
-float32
-easeInCubic(float32 t)
+template <>
+TweenPool<float32>&
+AnimationSystem::getPool<float32>()
 {
-    return t * t * t;
+    return m_floatTweens;
 }
 
-float32
-easeOutCubic(float32 t)
+template <>
+TweenPool<glm::vec2>&
+AnimationSystem::getPool<glm::vec2>()
 {
-    return 1.0f - std::pow(1.0f - t, 3.0f);
+    return m_vec2Tweens;
 }
 
-float32
-easeInOutCubic(float32 t)
+template <>
+TweenPool<glm::vec3>&
+AnimationSystem::getPool<glm::vec3>()
 {
-    return t < 0.5f ? 4.0f * t * t * t : 1.0f - std::pow(-2.0f * t + 2.0f, 3.0f) / 2.0f;
+    return m_vec3Tweens;
 }
 
-float32
-easeInQuart(float32 t)
+template <>
+TweenPool<glm::vec4>&
+AnimationSystem::getPool<glm::vec4>()
 {
-    return t * t * t * t;
+    return m_vec4Tweens;
 }
 
-float32
-easeOutQuart(float32 t)
+template <>
+KeyframePool<float32>&
+AnimationSystem::getKeyframePool<float32>()
 {
-    return 1.0f - std::pow(1.0f - t, 4.0f);
+    return m_floatKeyframes;
 }
 
-float32
-easeInOutQuart(float32 t)
+template <>
+KeyframePool<glm::vec2>&
+AnimationSystem::getKeyframePool<glm::vec2>()
 {
-    return t < 0.5f ? 8.0f * t * t * t * t : 1.0f - std::pow(-2.0f * t + 2.0f, 4.0f) / 2.0f;
+    return m_vec2Keyframes;
 }
 
-float32
-easeInQuint(float32 t)
+template <>
+KeyframePool<glm::vec3>&
+AnimationSystem::getKeyframePool<glm::vec3>()
 {
-    return t * t * t * t * t;
+    return m_vec3Keyframes;
 }
 
-float32
-easeOutQuint(float32 t)
+template <>
+KeyframePool<glm::vec4>&
+AnimationSystem::getKeyframePool<glm::vec4>()
 {
-    return 1.0f - std::pow(1.0f - t, 5.0f);
+    return m_vec4Keyframes;
 }
 
-float32
-easeInOutQuint(float32 t)
+template <>
+AnimationSystem::ValueType
+AnimationSystem::getValueType<float32>()
 {
-    return t < 0.5f ? 16.0f * t * t * t * t * t : 1.0f - std::pow(-2.0f * t + 2.0f, 5.0f) / 2.0f;
+    return ValueType::Float;
 }
 
-float32
-easeInSine(float32 t)
+template <>
+AnimationSystem::ValueType
+AnimationSystem::getValueType<glm::vec2>()
 {
-    constexpr float32 MY_PI = 3.14159265358979323846f;
-    return 1.0f - std::cos((t * MY_PI) / 2.0f);
+    return ValueType::Vec2;
 }
 
-float32
-easeOutSine(float32 t)
+template <>
+AnimationSystem::ValueType
+AnimationSystem::getValueType<glm::vec3>()
 {
-    constexpr float32 MY_PI = 3.14159265358979323846f;
-    return std::sin((t * MY_PI) / 2.0f);
+    return ValueType::Vec3;
 }
 
-float32
-easeInOutSine(float32 t)
+template <>
+AnimationSystem::ValueType
+AnimationSystem::getValueType<glm::vec4>()
 {
-    constexpr float32 MY_PI = 3.14159265358979323846f;
-    return -(std::cos(MY_PI * t) - 1.0f) / 2.0f;
+    return ValueType::Vec4;
 }
 
-float32
-easeInExpo(float32 t)
+AnimationSystem&
+AnimationSystem::getInstance()
 {
-    return t == 0.0f ? 0.0f : std::pow(2.0f, 10.0f * t - 10.0f);
+    static AnimationSystem instance;
+    return instance;
 }
 
-float32
-easeOutExpo(float32 t)
+AnimationSystem::AnimationSystem() : m_freeSlot(NO_FREE_SLOT), m_initialized(false) {}
+
+AnimationSystem::~AnimationSystem()
 {
-    return t == 1.0f ? 1.0f : 1.0f - std::pow(2.0f, -10.0f * t);
+    shutdown();
 }
 
-float32
-easeInOutExpo(float32 t)
+bool
+AnimationSystem::initialize()
 {
-    if (t == 0.0f)
-        return 0.0f;
-    if (t == 1.0f)
-        return 1.0f;
-    return t < 0.5f ? std::pow(2.0f, 20.0f * t - 10.0f) / 2.0f
-                    : (2.0f - std::pow(2.0f, -20.0f * t + 10.0f)) / 2.0f;
+    if (m_initialized)
+    {
+        Logger::warn("AnimationSystem already initialized");
+        return true;
+    }
+
+    Logger::info("Initializing AnimationSystem...");
+
+    reserve(DEFAULT_CAPACITY);
+    reserveKeyframes(DEFAULT_KEYFRAME_CAPACITY);
+    m_initialized = true;
+
+    Logger::info("AnimationSystem initialized successfully");
+    return true;
 }
 
-float32
-easeInCirc(float32 t)
+void
+AnimationSystem::shutdown()
 {
-    return 1.0f - std::sqrt(1.0f - std::pow(t, 2.0f));
+    if (!m_initialized)
+        return;
+
+    Logger::info("Shutting down AnimationSystem...");
+
+    stopAll();
+    m_initialized = false;
+
+    Logger::info("AnimationSystem shut down");
 }
 
-float32
-easeOutCirc(float32 t)
+void
+AnimationSystem::update(float32 deltaTime)
 {
-    return std::sqrt(1.0f - std::pow(t - 1.0f, 2.0f));
+    if (!m_initialized)
+        return;
+
+    m_finished.clear();
+    updatePool(m_floatTweens, deltaTime);
+    updatePool(m_vec2Tweens, deltaTime);
+    updatePool(m_vec3Tweens, deltaTime);
+    updatePool(m_vec4Tweens, deltaTime);
+    updatePool(m_floatKeyframes, deltaTime);
+    updatePool(m_vec2Keyframes, deltaTime);
+    updatePool(m_vec3Keyframes, deltaTime);
+    updatePool(m_vec4Keyframes, deltaTime);
+
+    // Callbacks run last, they may start or stop animations
+    for (AnimationHandle animation : m_finished)
+    {
+        const Slot* slot = findSlot(animation);
+        if (!slot)
+            continue;
+
+        std::function<void()> onComplete;
+        switch (slot->type)
+        {
+            case ValueType::Float:
+                onComplete = takeOnComplete<float32>(*slot);
+                break;
+            case ValueType::Vec2:
+                onComplete = takeOnComplete<glm::vec2>(*slot);
+                break;
+            case ValueType::Vec3:
+                onComplete = takeOnComplete<glm::vec3>(*slot);
+                break;
+            case ValueType::Vec4:
+                onComplete = takeOnComplete<glm::vec4>(*slot);
+                break;
+        }
+
+        removeAnimation(getHandleIndex(animation));
+        if (onComplete)
+        {
+            onComplete();
+        }
+    }
 }
 
-float32
-easeInOutCirc(float32 t)
+void
+AnimationSystem::reserve(uint32 tweensPerType)
 {
-    return t < 0.5f ? (1.0f - std::sqrt(1.0f - std::pow(2.0f * t, 2.0f))) / 2.0f
-                    : (std::sqrt(1.0f - std::pow(-2.0f * t + 2.0f, 2.0f)) + 1.0f) / 2.0f;
+    m_floatTweens.reserve(tweensPerType);
+    m_vec2Tweens.reserve(tweensPerType);
+    m_vec3Tweens.reserve(tweensPerType);
+    m_vec4Tweens.reserve(tweensPerType);
+    m_slots.reserve(static_cast<size_t>(tweensPerType) * 4);
+    m_finished.reserve(static_cast<size_t>(tweensPerType) * 4);
 }
 
-float32
-easeInElastic(float32 t)
+void
+AnimationSystem::reserveKeyframes(uint32 animationsPerType)
 {
-    constexpr float32 MY_PI = 3.14159265358979323846f;
-    constexpr float32 c4 = (2.0f * MY_PI) / 3.0f;
-    if (t == 0.0f)
-        return 0.0f;
-    if (t == 1.0f)
-        return 1.0f;
-    return -std::pow(2.0f, 10.0f * t - 10.0f) * std::sin((t * 10.0f - 10.75f) * c4);
+    m_floatKeyframes.reserve(animationsPerType);
+    m_vec2Keyframes.reserve(animationsPerType);
+    m_vec3Keyframes.reserve(animationsPerType);
+    m_vec4Keyframes.reserve(animationsPerType);
 }
 
-float32
-easeOutElastic(float32 t)
+AnimationTarget
+AnimationSystem::bindTarget(float32& value)
 {
-    constexpr float32 MY_PI = 3.14159265358979323846f;
-    constexpr float32 c4 = (2.0f * MY_PI) / 3.0f;
-    if (t == 0.0f)
-        return 0.0f;
-    if (t == 1.0f)
-        return 1.0f;
-    return std::pow(2.0f, -10.0f * t) * std::sin((t * 10.0f - 0.75f) * c4) + 1.0f;
+    return addTarget(value);
 }
 
-float32
-easeInOutElastic(float32 t)
+AnimationTarget
+AnimationSystem::bindTarget(glm::vec2& value)
 {
-    constexpr float32 MY_PI = 3.14159265358979323846f;
-    constexpr float32 c5 = (2.0f * MY_PI) / 4.5f;
-    if (t == 0.0f)
-        return 0.0f;
-    if (t == 1.0f)
-        return 1.0f;
-    return t < 0.5f
-               ? -(std::pow(2.0f, 20.0f * t - 10.0f) * std::sin((20.0f * t - 11.125f) * c5)) / 2.0f
-               : (std::pow(2.0f, -20.0f * t + 10.0f) * std::sin((20.0f * t - 11.125f) * c5)) /
-                         2.0f +
-                     1.0f;
+    return addTarget(value);
 }
 
-float32
-easeInBack(float32 t)
+AnimationTarget
+AnimationSystem::bindTarget(glm::vec3& value)
 {
-    constexpr float32 c1 = 1.70158f;
-    constexpr float32 c3 = c1 + 1.0f;
-    return c3 * t * t * t - c1 * t * t;
+    return addTarget(value);
 }
 
-float32
-easeOutBack(float32 t)
+AnimationTarget
+AnimationSystem::bindTarget(glm::vec4& value)
 {
-    constexpr float32 c1 = 1.70158f;
-    constexpr float32 c3 = c1 + 1.0f;
-    return 1.0f + c3 * std::pow(t - 1.0f, 3.0f) + c1 * std::pow(t - 1.0f, 2.0f);
+    return addTarget(value);
 }
 
-float32
-easeInOutBack(float32 t)
+void
+AnimationSystem::unbindTarget(AnimationTarget target)
 {
-    constexpr float32 c1 = 1.70158f;
-    constexpr float32 c2 = c1 * 1.525f;
-    return t < 0.5f
-               ? (std::pow(2.0f * t, 2.0f) * ((c2 + 1.0f) * 2.0f * t - c2)) / 2.0f
-               : (std::pow(2.0f * t - 2.0f, 2.0f) * ((c2 + 1.0f) * (t * 2.0f - 2.0f) + c2) + 2.0f) /
-                     2.0f;
+    if (!isTargetBound(target))
+        return;
+
+    uint32 index     = getHandleIndex(target);
+    TargetSlot& slot = m_targets[index];
+    slot.address     = nullptr;
+    slot.generation  = nextGeneration(slot.generation);
+    m_freeTargets.push_back(index);
 }
 
-float32
-easeOutBounce(float32 t)
+bool
+AnimationSystem::isTargetBound(AnimationTarget target) const
 {
-    constexpr float32 n1 = 7.5625f;
-    constexpr float32 d1 = 2.75f;
-    if (t < 1.0f / d1)
-    {
-        return n1 * t * t;
-    }
-    else if (t < 2.0f / d1)
-    {
-        t -= 1.5f / d1;
-        return n1 * t * t + 0.75f;
-    }
-    else if (t < 2.5f / d1)
-    {
-        t -= 2.25f / d1;
-        return n1 * t * t + 0.9375f;
-    }
-    else
-    {
-        t -= 2.625f / d1;
-        return n1 * t * t + 0.984375f;
-    }
+    uint32 index = getHandleIndex(target);
+    return index < m_targets.size() && m_targets[index].address != nullptr &&
+           m_targets[index].generation == getHandleGeneration(target);
 }
 
-float32
-easeInBounce(float32 t)
+bool
+AnimationSystem::setTargetValue(AnimationTarget target, float32 value)
 {
-    return 1.0f - easeOutBounce(1.0f - t);
+    return writeTarget(target, value);
 }
 
-float32
-easeInOutBounce(float32 t)
+bool
+AnimationSystem::setTargetValue(AnimationTarget target, const glm::vec2& value)
 {
-    return t < 0.5f ? (1.0f - easeOutBounce(1.0f - 2.0f * t)) / 2.0f
-                    : (1.0f + easeOutBounce(2.0f * t - 1.0f)) / 2.0f;
+    return writeTarget(target, value);
 }
 
-}  // namespace Easing
+bool
+AnimationSystem::setTargetValue(AnimationTarget target, const glm::vec3& value)
+{
+    return writeTarget(target, value);
+}
 
-// ============================================================================
-// INTERPOLATOR IMPLEMENTATIONS
-// ============================================================================
+bool
+AnimationSystem::setTargetValue(AnimationTarget target, const glm::vec4& value)
+{
+    return writeTarget(target, value);
+}
 
-float32
-Interpolator<float32>::interpolate(float32 start, float32 end, float32 t,
-                                   std::function<float32(float32)> easingFunc)
+AnimationHandle
+AnimationSystem::createTween(AnimationTarget target, float32 startValue, float32 endValue,
+                             float32 duration, EasingType easing, std::function<void()> onComplete)
 {
-    float32 easedT = easingFunc(t);
-    return start + (end - start) * easedT;
+    return addTween(target, startValue, endValue, duration, easing, std::move(onComplete));
 }
 
-glm::vec2
-Interpolator<glm::vec2>::interpolate(const glm::vec2& start, const glm::vec2& end, float32 t,
-                                     std::function<float32(float32)> easingFunc)
+AnimationHandle
+AnimationSystem::createTween(AnimationTarget target, glm::vec2 startValue, glm::vec2 endValue,
+                             float32 duration, EasingType easing, std::function<void()> onComplete)
 {
-    float32 easedT = easingFunc(t);
-    return start + (end - start) * easedT;
+    return addTween(target, startValue, endValue, duration, easing, std::move(onComplete));
 }
 
-glm::vec3
-Interpolator<glm::vec3>::interpolate(const glm::vec3& start, const glm::vec3& end, float32 t,
-                                     std::function<float32(float32)> easingFunc)
+AnimationHandle
+AnimationSystem::createTween(AnimationTarget target, glm::vec3 startValue, glm::vec3 endValue,
+                             float32 duration, EasingType easing, std::function<void()> onComplete)
 {
-    float32 easedT = easingFunc(t);
-    return start + (end - start) * easedT;
+    return addTween(target, startValue, endValue, duration, easing, std::move(onComplete));
 }
 
-glm::vec4
-Interpolator<glm::vec4>::interpolate(const glm::vec4& start, const glm::vec4& end, float32 t,
-                                     std::function<float32(float32)> easingFunc)
+AnimationHandle
+AnimationSystem::createTween(AnimationTarget target, glm::vec4 startValue, glm::vec4 endValue,
+                             float32 duration, EasingType easing, std::function<void()> onComplete)
 {
-    float32 easedT = easingFunc(t);
-    return start + (end - start) * easedT;
+    return addTween(target, startValue, endValue, duration, easing, std::move(onComplete));
 }
 
-// ============================================================================
-// ANIMATION SYSTEM IMPLEMENTATION
-// ============================================================================
+AnimationHandle
+AnimationSystem::createKeyframes(AnimationTarget target, KeyframeTrack<float32> track, bool loop,
+                                 std::function<void()> onComplete)
+{
+    return addKeyframes(target, std::move(track), loop, std::move(onComplete));
+}
 
-AnimationSystem&
-AnimationSystem::getInstance()
+AnimationHandle
+AnimationSystem::createKeyframes(AnimationTarget target, KeyframeTrack<glm::vec2> track, bool loop,
+                                 std::function<void()> onComplete)
 {
-    static AnimationSystem instance;
-    return instance;
+    return addKeyframes(target, std::move(track), loop, std::move(onComplete));
 }
 
-AnimationSystem::AnimationSystem() : m_nextAnimationID(1), m_initialized(false) {}
+AnimationHandle
+AnimationSystem::createKeyframes(AnimationTarget target, KeyframeTrack<glm::vec3> track, bool loop,
+                                 std::function<void()> onComplete)
+{
+    return addKeyframes(target, std::move(track), loop, std::move(onComplete));
+}
 
-AnimationSystem::~AnimationSystem()
+AnimationHandle
+AnimationSystem::createKeyframes(AnimationTarget target, KeyframeTrack<glm::vec4> track, bool loop,
+                                 std::function<void()> onComplete)
 {
-    shutdown();
+    return addKeyframes(target, std::move(track), loop, std::move(onComplete));
 }
 
-bool
-AnimationSystem::initialize()
+void
+AnimationSystem::seekAnimation(AnimationHandle animation, float32 seconds)
 {
-    if (m_initialized)
+    const Slot* slot = findSlot(animation);
+    if (!slot)
+        return;
+
+    seconds = std::max(seconds, 0.0f);
+    switch (slot->type)
     {
-        Logger::warn("AnimationSystem already initialized");
-        return true;
+        case ValueType::Float:
+            seekRow<float32>(*slot, seconds);
+            break;
+        case ValueType::Vec2:
+            seekRow<glm::vec2>(*slot, seconds);
+            break;
+        case ValueType::Vec3:
+            seekRow<glm::vec3>(*slot, seconds);
+            break;
+        case ValueType::Vec4:
+            seekRow<glm::vec4>(*slot, seconds);
+            break;
     }
+}
 
-    Logger::info("Initializing AnimationSystem (using tweeny backend)...");
-
-    m_animations.clear();
-    m_nextAnimationID = 1;
-    m_initialized     = true;
+void
+AnimationSystem::stopAnimation(AnimationHandle animation)
+{
+    if (!findSlot(animation))
+        return;
 
-    Logger::info("AnimationSystem initialized successfully");
-    return true;
+    removeAnimation(getHandleIndex(animation));
+    Logger::debug("Stopped animation {:#x}", animation);
 }
 
 void
-AnimationSystem::shutdown()
+AnimationSystem::stopAll()
 {
-    if (!m_initialized)
-        return;
+    uint32 count = getActiveAnimationCount();
 
-    Logger::info("Shutting down AnimationSystem...");
+    m_floatTweens.clear();
+    m_vec2Tweens.clear();
+    m_vec3Tweens.clear();
+    m_vec4Tweens.clear();
+    m_floatKeyframes.clear();
+    m_vec2Keyframes.clear();
+    m_vec3Keyframes.clear();
+    m_vec4Keyframes.clear();
 
-    stopAll();
-    m_animations.clear();
-    m_initialized = false;
+    // Every handle handed out so far goes stale
+    m_freeSlot = NO_FREE_SLOT;
+    for (uint32 i = static_cast<uint32>(m_slots.size()); i-- > 0;)
+    {
+        Slot& slot = m_slots[i];
+        if (slot.live)
+        {
+            slot.generation = nextGeneration(slot.generation);
+            slot.live       = false;
+        }
+        slot.row   = m_freeSlot;
+        m_freeSlot = i;
+    }
 
-    Logger::info("AnimationSystem shut down");
+    Logger::debug("Stopped all {} animations", count);
 }
 
-void
-AnimationSystem::update(float32 deltaTime)
+uint32
+AnimationSystem::getActiveAnimationCount() const
 {
-    if (!m_initialized)
-        return;
+    return m_floatTweens.size() + m_vec2Tweens.size() + m_vec3Tweens.size() +
+           m_vec4Tweens.size() + m_floatKeyframes.size() + m_vec2Keyframes.size() +
+           m_vec3Keyframes.size() + m_vec4Keyframes.size();
+}
+
+bool
+AnimationSystem::isRunning(AnimationHandle animation) const
+{
+    return findSlot(animation) != nullptr;
+}
 
-    // Update all animations and remove completed ones
-    m_animations.erase(std::remove_if(m_animations.begin(), m_animations.end(),
-                                      [deltaTime](const std::unique_ptr<IAnimation>& anim) {
-                                          return !anim->update(deltaTime);
-                                      }),
-                       m_animations.end());
+float32
+AnimationSystem::getProgress(AnimationHandle animation) const
+{
+    const Slot* slot = findSlot(animation);
+    if (!slot)
+        return -1.0f;
+
+    switch (slot->type)
+    {
+        case ValueType::Float:
+            return getRowProgress(m_floatTweens, m_floatKeyframes, *slot);
+        case ValueType::Vec2:
+            return getRowProgress(m_vec2Tweens, m_vec2Keyframes, *slot);
+        case ValueType::Vec3:
+            return getRowProgress(m_vec3Tweens, m_vec3Keyframes, *slot);
+        case ValueType::Vec4:
+            return getRowProgress(m_vec4Tweens, m_vec4Keyframes, *slot);
+    }
+    return -1.0f;
 }
 
-std::uint32_t
-AnimationSystem::createTween(float32& target, float32 startValue, float32 endValue,
-                             float32 duration, std::function<float32(float32)> easingFunc,
-                             std::function<void()> onComplete)
+template <typename T>
+AnimationHandle
+AnimationSystem::addTween(AnimationTarget target, const T& startValue, const T& endValue,
+                          float32 duration, EasingType easing, std::function<void()> onComplete)
 {
     if (!m_initialized)
     {
         Logger::error("AnimationSystem not initialized");
-        return 0;
+        return INVALID_ANIMATION;
+    }
+
+    if (target != INVALID_TARGET && !resolveTarget<T>(target))
+    {
+        Logger::error("Tween target {:#x} is not bound or has another value type", target);
+        return INVALID_ANIMATION;
     }
 
-    std::uint32_t id   = m_nextAnimationID++;
-    int32_t durationMs = static_cast<int32_t>(duration * 1000.0f);
-    auto tween         = tweeny::from(startValue).to(endValue).during(durationMs);
+    uint32 index = acquireSlot();
+    if (index == NO_FREE_SLOT)
+        return INVALID_ANIMATION;
 
-    // Note: easing parameter ignored for now, tweeny uses linear by default
-    (void) easingFunc;
+    Slot& slot     = m_slots[index];
+    slot.type      = getValueType<T>();
+    slot.keyframed = false;
+    slot.live      = true;
+    slot.row       = getPool<T>().add(index, startValue, endValue, duration, easing, target,
+                                      std::move(onComplete));
 
-    m_animations.push_back(
-        std::make_unique<TweenyAnimation<float32>>(id, target, tween, onComplete));
+    // The target shows the start value right away, not one update later
+    if (T* value = resolveTarget<T>(target))
+    {
+        *value = startValue;
+    }
 
-    Logger::debug("Created float tween animation ID: {}", id);
-    return id;
+    return makeHandle(index, slot.generation);
 }
 
-std::uint32_t
-AnimationSystem::createTween(glm::vec2& target, glm::vec2 startValue, glm::vec2 endValue,
-                             float32 duration, std::function<float32(float32)> easingFunc,
-                             std::function<void()> onComplete)
+template <typename T>
+AnimationHandle
+AnimationSystem::addKeyframes(AnimationTarget target, KeyframeTrack<T> track, bool loop,
+                              std::function<void()> onComplete)
 {
     if (!m_initialized)
     {
         Logger::error("AnimationSystem not initialized");
-        return 0;
+        return INVALID_ANIMATION;
+    }
+
+    if (track.isEmpty())
+    {
+        Logger::error("Keyframe track has no keys");
+        return INVALID_ANIMATION;
+    }
+
+    if (target != INVALID_TARGET && !resolveTarget<T>(target))
+    {
+        Logger::error("Keyframe target {:#x} is not bound or has another value type", target);
+        return INVALID_ANIMATION;
     }
 
-    std::uint32_t id   = m_nextAnimationID++;
-    int32_t durationMs = static_cast<int32_t>(duration * 1000.0f);
-    auto tweenVec2     = tweeny::from(startValue).to(endValue).during(durationMs);
+    uint32 index = acquireSlot();
+    if (index == NO_FREE_SLOT)
+        return INVALID_ANIMATION;
+
+    KeyframePool<T>& pool = getKeyframePool<T>();
 
-    // Note: easing parameter ignored for now
-    (void) easingFunc;
+    Slot& slot     = m_slots[index];
+    slot.type      = getValueType<T>();
+    slot.keyframed = true;
+    slot.live      = true;
+    slot.row       = pool.add(index, std::move(track), loop, target, std::move(onComplete));
 
-    m_animations.push_back(
-        std::make_unique<TweenyAnimation<glm::vec2>>(id, target, tweenVec2, onComplete));
+    // The target shows the first key right away, not one update later
+    writeTarget(target, pool.value[slot.row]);
 
-    Logger::debug("Created vec2 tween animation ID: {}", id);
-    return id;
+    return makeHandle(index, slot.generation);
 }
 
-std::uint32_t
-AnimationSystem::createTween(glm::vec3& target, glm::vec3 startValue, glm::vec3 endValue,
-                             float32 duration, std::function<float32(float32)> easingFunc,
-                             std::function<void()> onComplete)
+uint32
+AnimationSystem::acquireSlot()
 {
-    if (!m_initialized)
+    uint32 index = m_freeSlot;
+    if (index != NO_FREE_SLOT)
     {
-        Logger::error("AnimationSystem not initialized");
-        return 0;
+        m_freeSlot = m_slots[index].row;
+        return index;
     }
 
-    std::uint32_t id   = m_nextAnimationID++;
-    int32_t durationMs = static_cast<int32_t>(duration * 1000.0f);
-    auto tweenVec3     = tweeny::from(startValue).to(endValue).during(durationMs);
-
-    // Note: easing parameter ignored for now
-    (void) easingFunc;
-
-    m_animations.push_back(
-        std::make_unique<TweenyAnimation<glm::vec3>>(id, target, tweenVec3, onComplete));
-
-    Logger::debug("Created vec3 tween animation ID: {}", id);
-    return id;
+    if (m_slots.size() >= NO_FREE_SLOT)
+    {
+        Logger::error("AnimationSystem out of animation slots");
+        return NO_FREE_SLOT;
+    }
+    m_slots.emplace_back();
+    return static_cast<uint32>(m_slots.size() - 1);
 }
 
-std::uint32_t
-AnimationSystem::createTween(glm::vec4& target, glm::vec4 startValue, glm::vec4 endValue,
-                             float32 duration, std::function<float32(float32)> easingFunc,
-                             std::function<void()> onComplete)
+template <typename T>
+AnimationTarget
+AnimationSystem::addTarget(T& value)
 {
-    if (!m_initialized)
+    uint32 index = 0;
+    if (!m_freeTargets.empty())
     {
-        Logger::error("AnimationSystem not initialized");
-        return 0;
+        index = m_freeTargets.back();
+        m_freeTargets.pop_back();
     }
+    else
+    {
+        if (m_targets.size() >= INDEX_MASK)
+        {
+            Logger::error("AnimationSystem out of target slots");
+            return INVALID_TARGET;
+        }
+        index = static_cast<uint32>(m_targets.size());
+        m_targets.emplace_back();
+    }
+
+    TargetSlot& slot = m_targets[index];
+    slot.address     = &value;
+    slot.type        = getValueType<T>();
+    return makeHandle(index, slot.generation);
+}
 
-    std::uint32_t id   = m_nextAnimationID++;
-    int32_t durationMs = static_cast<int32_t>(duration * 1000.0f);
-    auto tweenVec4     = tweeny::from(startValue).to(endValue).during(durationMs);
+template <typename T>
+T*
+AnimationSystem::resolveTarget(AnimationTarget target) const
+{
+    if (!isTargetBound(target))
+        return nullptr;
 
-    // Note: easing parameter ignored for now
-    (void) easingFunc;
+    const TargetSlot& slot = m_targets[getHandleIndex(target)];
+    return slot.type == getValueType<T>() ? static_cast<T*>(slot.address) : nullptr;
+}
 
-    m_animations.push_back(
-        std::make_unique<TweenyAnimation<glm::vec4>>(id, target, tweenVec4, onComplete));
+template <typename T>
+bool
+AnimationSystem::writeTarget(AnimationTarget target, const T& value)
+{
+    T* address = resolveTarget<T>(target);
+    if (!address)
+        return false;
 
-    Logger::debug("Created vec4 tween animation ID: {}", id);
-    return id;
+    *address = value;
+    return true;
 }
 
+template <typename Pool>
 void
-AnimationSystem::stopAnimation(std::uint32_t animationID)
+AnimationSystem::updatePool(Pool& pool, float32 deltaTime)
+{
+    using T = typename decltype(Pool::value)::value_type;
+    pool.advance(deltaTime);
+
+    uint32 count = pool.size();
+    for (uint32 i = 0; i < count; ++i)
+    {
+        if (pool.target[i] != INVALID_TARGET)
+        {
+            if (T* value = resolveTarget<T>(pool.target[i]))
+            {
+                *value = pool.value[i];
+            }
+        }
+
+        if (pool.progress[i] >= 1.0f)
+        {
+            uint32 slot = pool.slot[i];
+            m_finished.push_back(makeHandle(slot, m_slots[slot].generation));
+        }
+    }
+}
+
+template <typename T>
+std::function<void()>
+AnimationSystem::takeOnComplete(const Slot& slot)
 {
-    m_animations.erase(std::remove_if(m_animations.begin(), m_animations.end(),
-                                      [animationID](const std::unique_ptr<IAnimation>& anim) {
-                                          return anim->getID() == animationID;
-                                      }),
-                       m_animations.end());
+    if (slot.keyframed)
+        return std::move(getKeyframePool<T>().onComplete[slot.row]);
+    return std::move(getPool<T>().onComplete[slot.row]);
+}
 
-    Logger::debug("Stopped animation ID: {}", animationID);
+template <typename T>
+float32
+AnimationSystem::getRowProgress(const TweenPool<T>& tweens, const KeyframePool<T>& keyframes,
+                                const Slot& slot)
+{
+    return slot.keyframed ? keyframes.progress[slot.row] : tweens.progress[slot.row];
 }
 
+template <typename T>
 void
-AnimationSystem::stopAll()
+AnimationSystem::seekRow(const Slot& slot, float32 seconds)
 {
-    std::uint32_t count = static_cast<std::uint32_t>(m_animations.size());
-    m_animations.clear();
+    if (slot.keyframed)
+    {
+        KeyframePool<T>& pool = getKeyframePool<T>();
+        pool.setTime(slot.row, seconds);
+        writeTarget(pool.target[slot.row], pool.value[slot.row]);
+        return;
+    }
 
-    Logger::debug("Stopped all {} animations", count);
+    TweenPool<T>& pool = getPool<T>();
+    uint32 row         = slot.row;
+    pool.elapsed[row]  = seconds;
+    pool.progress[row] = std::min(seconds * pool.invDuration[row], 1.0f);
+
+    float32 eased   = Easing::evaluate(pool.easing[row], pool.progress[row]);
+    pool.value[row] = pool.start[row] + (pool.end[row] - pool.start[row]) * eased;
+    writeTarget(pool.target[row], pool.value[row]);
 }
 
-std::uint32_t
-AnimationSystem::getActiveAnimationCount() const
+template <typename T>
+uint32
+AnimationSystem::removeRow(const Slot& slot)
 {
-    return static_cast<std::uint32_t>(m_animations.size());
+    if (slot.keyframed)
+        return getKeyframePool<T>().remove(slot.row);
+    return getPool<T>().remove(slot.row);
 }
 
-bool
-AnimationSystem::isRunning(std::uint32_t animationID) const
+const AnimationSystem::Slot*
+AnimationSystem::findSlot(AnimationHandle animation) const
 {
-    return std::any_of(m_animations.begin(), m_animations.end(),
-                       [animationID](const std::unique_ptr<IAnimation>& anim) {
-                           return anim->getID() == animationID && !anim->isComplete();
-                       });
+    uint32 index = getHandleIndex(animation);
+    if (index >= m_slots.size())
+        return nullptr;
+
+    const Slot& slot = m_slots[index];
+    return slot.live && slot.generation == getHandleGeneration(animation) ? &slot : nullptr;
+}
+
+void
+AnimationSystem::removeAnimation(uint32 slotIndex)
+{
+    Slot& slot = m_slots[slotIndex];
+
+    // The pool fills the hole with its last row, whose slot has to follow it
+    uint32 moved = 0;
+    switch (slot.type)
+    {
+        case ValueType::Float:
+            moved = removeRow<float32>(slot);
+            break;
+        case ValueType::Vec2:
+            moved = removeRow<glm::vec2>(slot);
+            break;
+        case ValueType::Vec3:
+            moved = removeRow<glm::vec3>(slot);
+            break;
+        case ValueType::Vec4:
+            moved = removeRow<glm::vec4>(slot);
+            break;
+    }
+    m_slots[moved].row = slot.row;
+
+    slot.generation = nextGeneration(slot.generation);
+    slot.live       = false;
+    slot.row        = m_freeSlot;
+    m_freeSlot      = slotIndex;
 }
 
 }  // namespace deadcode
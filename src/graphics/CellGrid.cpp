@@ -0,0 +1,360 @@
+/**
+ * @file CellGrid.cpp
+ * @brief Implementation of CellGrid class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-19
+ */
+
+#include "deadcode/graphics/CellGrid.hpp"
+
+#include "deadcode/core/Logger.hpp"
+#include "deadcode/core/Utf8.hpp"
+#include "deadcode/graphics/RenderBackend.hpp"
+#include "deadcode/graphics/TextRenderer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace deadcode
+{
+
+namespace
+{
+constexpr int32 BITS_PER_WORD = 64;
+
+inline bool
+sameColor(Color a, Color b)
+{
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+}  // namespace
+
+bool
+Cell::operator==(const Cell& other) const
+{
+    return codepoint == other.codepoint && attributes == other.attributes &&
+           sameColor(foreground, other.foreground) && sameColor(background, other.background);
+}
+
+CellGrid::CellGrid(int32 columns, int32 rows)
+    : m_columns(0),
+      m_rows(0),
+      m_target{},
+      m_backend(nullptr),
+      m_cellWidth(0),
+      m_cellHeight(0),
+      m_scale(0.0f),
+      m_fontGeneration(0)
+{
+    resize(columns, rows);
+}
+
+CellGrid::~CellGrid()
+{
+    if (m_backend)
+    {
+        m_backend->unloadRenderTarget(m_target);
+    }
+}
+
+void
+CellGrid::resize(int32 columns, int32 rows)
+{
+    m_columns = std::max(0, columns);
+    m_rows    = std::max(0, rows);
+    m_cells.assign(static_cast<size_t>(m_columns * m_rows), Cell{});
+    m_dirtyRows.assign(static_cast<size_t>((m_rows + BITS_PER_WORD - 1) / BITS_PER_WORD), 0);
+
+    // Target size depends on the grid size, ensureTarget() recreates it
+    m_cellWidth  = 0;
+    m_cellHeight = 0;
+
+    Logger::debug("CellGrid resized to {}x{}", m_columns, m_rows);
+}
+
+void
+CellGrid::setCell(int32 column, int32 row, const Cell& cell)
+{
+    if (column < 0 || column >= m_columns || row < 0 || row >= m_rows)
+        return;
+
+    Cell& current = m_cells[static_cast<size_t>(row * m_columns + column)];
+    if (current != cell)
+    {
+        current = cell;
+        markDirty(row);
+    }
+}
+
+Cell
+CellGrid::getCell(int32 column, int32 row) const
+{
+    if (column < 0 || column >= m_columns || row < 0 || row >= m_rows)
+        return Cell{};
+
+    return m_cells[static_cast<size_t>(row * m_columns + column)];
+}
+
+int32
+CellGrid::putText(int32 column, int32 row, StringView text, Color foreground, Color background,
+                  uint8 attributes)
+{
+    int32 written = 0;
+    for (size_t pos = 0; pos < text.size() && column + written < m_columns;)
+    {
+        Cell cell;
+        cell.codepoint  = Utf8::decodeNext(text.data(), text.size(), pos);
+        cell.foreground = foreground;
+        cell.background = background;
+        cell.attributes = attributes;
+
+        setCell(column + written, row, cell);
+        written++;
+    }
+    return written;
+}
+
+void
+CellGrid::fill(int32 column, int32 row, int32 width, int32 height, const Cell& cell)
+{
+    for (int32 r = row; r < row + height; ++r)
+    {
+        for (int32 c = column; c < column + width; ++c)
+        {
+            setCell(c, r, cell);
+        }
+    }
+}
+
+void
+CellGrid::clear()
+{
+    fill(0, 0, m_columns, m_rows, Cell{});
+}
+
+void
+CellGrid::invalidate()
+{
+    for (int32 row = 0; row < m_rows; ++row)
+    {
+        markDirty(row);
+    }
+}
+
+void
+CellGrid::render(TextRenderer* textRenderer, float32 x, float32 y, float32 scale)
+{
+    m_stats = CellGridStats{};
+    if (!textRenderer || m_columns == 0 || m_rows == 0)
+        return;
+
+    // Whole pixels keep glyphs on the same texel grid in every row
+    int32 cellWidth  = static_cast<int32>(std::ceil(textRenderer->getCharWidth(scale)));
+    int32 cellHeight = static_cast<int32>(std::ceil(textRenderer->getLineHeight(scale)));
+    if (cellWidth <= 0 || cellHeight <= 0)
+        return;
+
+    // Without render textures the grid is drawn cell by cell every frame
+    if (!textRenderer->getBackend()->supportsRenderTargets())
+    {
+        m_cellWidth  = cellWidth;
+        m_cellHeight = cellHeight;
+        drawBackgrounds(*textRenderer->getBackend(), x, y, false);
+        drawForegrounds(textRenderer, x, y, scale, false);
+        return;
+    }
+
+    if (ensureTarget(*textRenderer->getBackend(), cellWidth, cellHeight) || scale != m_scale ||
+        textRenderer->getFontGeneration() != m_fontGeneration)
+    {
+        m_scale          = scale;
+        m_fontGeneration = textRenderer->getFontGeneration();
+        invalidate();
+    }
+
+    // Screen commands queued so far stay queued while the dirty rows draw into the target
+    bool anyDirty = std::any_of(m_dirtyRows.begin(), m_dirtyRows.end(),
+                                [](uint64 word) { return word != 0; });
+    if (anyDirty)
+    {
+        rebuildDirtyRows(textRenderer, scale);
+    }
+
+    // The target holds premultiplied color; render textures are stored bottom-up
+    auto targetWidth  = static_cast<float32>(m_target.texture.width);
+    auto targetHeight = static_cast<float32>(m_target.texture.height);
+    textRenderer->getBackend()->drawTexture(m_target.texture, {x, y, targetWidth, targetHeight},
+                                            {0.0f, 0.0f, targetWidth, -targetHeight}, WHITE,
+                                            RenderBlend::Premultiplied);
+}
+
+int32
+CellGrid::getColumns() const
+{
+    return m_columns;
+}
+
+int32
+CellGrid::getRows() const
+{
+    return m_rows;
+}
+
+bool
+CellGrid::isRowDirty(int32 row) const
+{
+    if (row < 0 || row >= m_rows)
+        return false;
+
+    return (m_dirtyRows[static_cast<size_t>(row / BITS_PER_WORD)] >> (row % BITS_PER_WORD)) & 1u;
+}
+
+const CellGridStats&
+CellGrid::getStats() const
+{
+    return m_stats;
+}
+
+void
+CellGrid::markDirty(int32 row)
+{
+    m_dirtyRows[static_cast<size_t>(row / BITS_PER_WORD)] |= uint64{1} << (row % BITS_PER_WORD);
+}
+
+bool
+CellGrid::ensureTarget(RenderBackend& backend, int32 cellWidth, int32 cellHeight)
+{
+    if (m_target.id != 0 && m_backend == &backend && cellWidth == m_cellWidth &&
+        cellHeight == m_cellHeight)
+        return false;
+
+    if (m_backend)
+    {
+        m_backend->unloadRenderTarget(m_target);
+    }
+
+    m_backend    = &backend;
+    m_cellWidth  = cellWidth;
+    m_cellHeight = cellHeight;
+    m_target     = backend.loadRenderTarget(m_columns * cellWidth, m_rows * cellHeight, false);
+
+    // Start fully transparent, rows are only ever overwritten individually
+    float32 targetWidth  = static_cast<float32>(m_target.texture.width);
+    float32 targetHeight = static_cast<float32>(m_target.texture.height);
+    backend.beginRenderTarget(m_target, targetWidth, targetHeight);
+    backend.clearRenderTarget(BLANK);
+    backend.endRenderTarget();
+
+    Logger::debug("CellGrid target created: {}x{} cells of {}x{} px", m_columns, m_rows,
+                  cellWidth, cellHeight);
+    return true;
+}
+
+void
+CellGrid::rebuildDirtyRows(TextRenderer* textRenderer, float32 scale)
+{
+    RenderBackend& backend = *textRenderer->getBackend();
+    backend.beginRenderTarget(m_target, static_cast<float32>(m_target.texture.width),
+                              static_cast<float32>(m_target.texture.height));
+
+    // Pass 1: overwrite backgrounds (transparent included) so old glyphs disappear
+    backend.setBlendMode(RenderBlend::Replace);
+    drawBackgrounds(backend, 0.0f, 0.0f, true);
+
+    // Pass 2: glyphs, blended so the target ends up premultiplied with correct alpha
+    backend.setBlendMode(RenderBlend::Premultiply);
+    drawForegrounds(textRenderer, 0.0f, 0.0f, scale, true);
+    textRenderer->flush();
+
+    backend.setBlendMode(RenderBlend::Alpha);
+    backend.endRenderTarget();
+
+    std::fill(m_dirtyRows.begin(), m_dirtyRows.end(), 0);
+}
+
+void
+CellGrid::drawBackgrounds(RenderBackend& backend, float32 originX, float32 originY,
+                          bool dirtyOnly)
+{
+    float32 cellWidth  = static_cast<float32>(m_cellWidth);
+    float32 cellHeight = static_cast<float32>(m_cellHeight);
+
+    for (int32 row = 0; row < m_rows; ++row)
+    {
+        if (dirtyOnly && !isRowDirty(row))
+            continue;
+
+        for (int32 column = 0; column < m_columns; ++column)
+        {
+            const Cell& cell = m_cells[static_cast<size_t>(row * m_columns + column)];
+            Color background = (cell.attributes & CellAttr::REVERSE) ? cell.foreground
+                                                                     : cell.background;
+
+            // Dirty rows in the target must be overwritten even where transparent
+            if (!dirtyOnly && background.a == 0)
+                continue;
+
+            // Premultiply here, the target is composited as RenderBlend::Premultiplied
+            if (dirtyOnly)
+            {
+                float32 alpha = static_cast<float32>(background.a) / 255.0f;
+                background.r  = static_cast<uint8>(static_cast<float32>(background.r) * alpha);
+                background.g  = static_cast<uint8>(static_cast<float32>(background.g) * alpha);
+                background.b  = static_cast<uint8>(static_cast<float32>(background.b) * alpha);
+            }
+
+            backend.drawRectangle(Rectangle{originX + static_cast<float32>(column) * cellWidth,
+                                            originY + static_cast<float32>(row) * cellHeight,
+                                            cellWidth, cellHeight},
+                                  background);
+        }
+
+        m_stats.rowsRebuilt++;
+        m_stats.cellsRebuilt += static_cast<uint32>(m_columns);
+    }
+}
+
+void
+CellGrid::drawForegrounds(TextRenderer* textRenderer, float32 originX, float32 originY,
+                          float32 scale, bool dirtyOnly)
+{
+    RenderBackend& backend = *textRenderer->getBackend();
+    float32 cellWidth      = static_cast<float32>(m_cellWidth);
+    float32 cellHeight     = static_cast<float32>(m_cellHeight);
+
+    for (int32 row = 0; row < m_rows; ++row)
+    {
+        if (dirtyOnly && !isRowDirty(row))
+            continue;
+
+        float32 rowY = originY + static_cast<float32>(row) * cellHeight;
+        for (int32 column = 0; column < m_columns; ++column)
+        {
+            const Cell& cell = m_cells[static_cast<size_t>(row * m_columns + column)];
+            Color foreground = (cell.attributes & CellAttr::REVERSE) ? cell.background
+                                                                     : cell.foreground;
+            if (cell.attributes & CellAttr::DIM)
+            {
+                foreground.a = static_cast<uint8>(foreground.a / 2);
+            }
+
+            float32 cellX = originX + static_cast<float32>(column) * cellWidth;
+            if (cell.codepoint != ' ' && foreground.a > 0)
+            {
+                textRenderer->renderCodepoint(cell.codepoint, cellX, rowY, scale, foreground);
+                m_stats.glyphs++;
+            }
+
+            if (cell.attributes & CellAttr::UNDERLINE)
+            {
+                float32 thickness = std::max(1.0f, std::floor(cellHeight / 16.0f));
+                backend.drawRectangle(Rectangle{cellX, rowY + cellHeight - thickness, cellWidth,
+                                                thickness},
+                                      foreground);
+            }
+        }
+    }
+}
+
+}  // namespace deadcode
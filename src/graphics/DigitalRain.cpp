@@ -0,0 +1,333 @@
+/**
+ * @file DigitalRain.cpp
+ * @brief Implementation of DigitalRain class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-01
+ */
+
+#include "deadcode/graphics/DigitalRain.hpp"
+
+#include "deadcode/core/Logger.hpp"
+#include "deadcode/core/Utf8.hpp"
+#include "deadcode/graphics/GlitchEffect.hpp"
+#include "deadcode/graphics/TextRenderer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+namespace deadcode
+{
+
+namespace
+{
+// Noise seeds, one per property so the properties are independent
+constexpr uint32 SPEED_SEED    = 0x5EED0001;
+constexpr uint32 TRAIL_SEED    = 0x5EED0002;
+constexpr uint32 GAP_SEED      = 0x5EED0003;
+constexpr uint32 PHASE_SEED    = 0x5EED0004;
+constexpr uint32 ORDER_SEED    = 0x5EED0005;
+constexpr uint32 PERIOD_SEED   = 0x5EED0006;
+constexpr uint32 OFFSET_SEED   = 0x5EED0007;
+constexpr uint32 GLYPH_SEED    = 0x5EED0008;
+constexpr uint32 ADJUST_FRAMES = 20;  ///< Frames averaged per density decision
+
+constexpr float32 BACK_OFF_MARGIN = 0.9f;  ///< Aim this far under the budget when over it
+constexpr float32 GROW_BELOW      = 0.7f;  ///< Add columns only while under this share of it
+constexpr uint32 GROW_DIVISOR     = 20;    ///< Columns added per decision: 1/20 of the screen
+
+Color
+toRainColor(const glm::vec3& color, float32 alpha)
+{
+    Color result = toRaylib(color);
+    result.a     = static_cast<uint8>(std::clamp(alpha, 0.0f, 1.0f) * 255.0f);
+    return result;
+}
+}  // namespace
+
+DigitalRain::DigitalRain()
+    : m_quality(EffectQuality::High),
+      m_screenWidth(0),
+      m_screenHeight(0),
+      m_fontGeneration(0),
+      m_layoutValid(false),
+      m_cellWidth(0.0f),
+      m_cellHeight(0.0f),
+      m_rows(0),
+      m_activeColumns(0),
+      m_costSum(0.0f),
+      m_costFrames(0)
+{
+}
+
+void
+DigitalRain::configure(const DigitalRainSettings& settings)
+{
+    m_settings          = settings;
+    m_settings.stepRate = std::clamp(m_settings.stepRate, 1.0f, 120.0f);
+    m_settings.maxSpeed = std::max(m_settings.maxSpeed, m_settings.minSpeed);
+    m_settings.maxTrail = std::max(m_settings.maxTrail, m_settings.minTrail);
+    m_layoutValid       = false;
+}
+
+const DigitalRainSettings&
+DigitalRain::getSettings() const
+{
+    return m_settings;
+}
+
+float32
+DigitalRain::getStepInterval() const
+{
+    return m_settings.enabled ? 1.0f / m_settings.stepRate : 0.0f;
+}
+
+void
+DigitalRain::setScreenSize(int32 width, int32 height)
+{
+    m_screenWidth  = width;
+    m_screenHeight = height;
+    m_layoutValid  = false;
+}
+
+void
+DigitalRain::setQuality(EffectQuality quality)
+{
+    m_quality       = quality;
+    m_activeColumns = std::min(m_activeColumns, getMaxColumns());
+}
+
+void
+DigitalRain::render(TextRenderer* textRenderer, uint32 step)
+{
+    m_stats.glyphs = 0;
+    if (!textRenderer || !m_settings.enabled || m_quality == EffectQuality::Minimal)
+        return;
+
+    if (!m_layoutValid || m_fontGeneration != textRenderer->getFontGeneration())
+    {
+        buildColumns(*textRenderer);
+    }
+    if (m_activeColumns == 0)
+        return;
+
+    auto start = std::chrono::steady_clock::now();
+
+    advanceColumns(step);
+    emitGlyphs(step);
+
+    GlyphSpan glyphs;
+    glyphs.codepoints = m_codepoints.data();
+    glyphs.x          = m_glyphX.data();
+    glyphs.y          = m_glyphY.data();
+    glyphs.scales     = m_glyphScales.data();
+    glyphs.colors     = m_glyphColors.data();
+    glyphs.count      = m_codepoints.size();
+    textRenderer->renderGlyphs(glyphs);
+
+    std::chrono::duration<float32, std::milli> cost = std::chrono::steady_clock::now() - start;
+    m_stats.glyphs = static_cast<uint32>(m_codepoints.size());
+    m_costSum += cost.count();
+    m_costFrames++;
+    if (m_costFrames >= ADJUST_FRAMES)
+    {
+        adjustDensity();
+    }
+}
+
+const DigitalRainStats&
+DigitalRain::getStats() const
+{
+    return m_stats;
+}
+
+void
+DigitalRain::buildColumns(const TextRenderer& textRenderer)
+{
+    m_fontGeneration = textRenderer.getFontGeneration();
+    m_cellWidth      = textRenderer.getCharWidth(m_settings.scale);
+    m_cellHeight     = textRenderer.getLineHeight(m_settings.scale);
+    m_activeColumns  = 0;
+    m_stats          = DigitalRainStats{};
+
+    // Without a font there is nothing to measure, try again next frame
+    if (m_cellWidth <= 0.0f || m_cellHeight <= 0.0f || m_screenWidth <= 0 || m_screenHeight <= 0)
+        return;
+
+    m_layoutValid = true;
+
+    // Glyphs the fonts lack would all show up as the '?' placeholder
+    m_glyphSet.clear();
+    const String& glyphs = m_settings.glyphs;
+    for (size_t pos = 0; pos < glyphs.size();)
+    {
+        int32 codepoint = Utf8::decodeNext(glyphs.data(), glyphs.size(), pos);
+        if (codepoint > ' ' && textRenderer.hasGlyph(codepoint))
+        {
+            m_glyphSet.push_back(codepoint);
+        }
+    }
+    if (m_glyphSet.empty())
+    {
+        m_glyphSet = {'0', '1'};
+    }
+
+    auto columns = static_cast<uint32>(
+        std::ceil(static_cast<float32>(m_screenWidth) / m_cellWidth));
+    m_rows = static_cast<int32>(std::ceil(static_cast<float32>(m_screenHeight) / m_cellHeight));
+
+    m_speed.resize(columns);
+    m_phase.resize(columns);
+    m_cycle.resize(columns);
+    m_trail.resize(columns);
+    m_head.resize(columns);
+    m_order.resize(columns);
+
+    auto rows        = static_cast<float32>(m_rows);
+    float32 minTrail = static_cast<float32>(m_settings.minTrail);
+    float32 maxTrail = static_cast<float32>(m_settings.maxTrail);
+    for (uint32 c = 0; c < columns; ++c)
+    {
+        float32 speed = m_settings.minSpeed + GlitchEffect::generateNoise(c, SPEED_SEED) *
+                                                  (m_settings.maxSpeed - m_settings.minSpeed);
+        float32 trail = GlitchEffect::generateNoise(c, TRAIL_SEED) * (maxTrail - minTrail);
+        m_speed[c]    = speed / m_settings.stepRate;
+        m_trail[c]    = minTrail + trail;
+
+        // The gap after the trail keeps columns from falling in lockstep
+        m_cycle[c] = rows + m_trail[c] + GlitchEffect::generateNoise(c, GAP_SEED) * rows;
+        m_phase[c] = GlitchEffect::generateNoise(c, PHASE_SEED) * m_cycle[c];
+    }
+
+    std::iota(m_order.begin(), m_order.end(), 0u);
+    std::sort(m_order.begin(), m_order.end(), [](uint32 a, uint32 b) {
+        return GlitchEffect::generateNoise(a, ORDER_SEED) <
+               GlitchEffect::generateNoise(b, ORDER_SEED);
+    });
+
+    // Start at the most the tier allows, the budget trims it within a few frames
+    m_stats.columns = columns;
+    m_activeColumns = getMaxColumns();
+    m_costSum       = 0.0f;
+    m_costFrames    = 0;
+
+    size_t maxGlyphs = static_cast<size_t>(columns) * (m_settings.maxTrail + 1);
+    m_codepoints.reserve(maxGlyphs);
+    m_glyphX.reserve(maxGlyphs);
+    m_glyphY.reserve(maxGlyphs);
+    m_glyphScales.reserve(maxGlyphs);
+    m_glyphColors.reserve(maxGlyphs);
+
+    m_stats.activeColumns = m_activeColumns;
+    Logger::debug("Digital rain: {} columns x {} rows, {} glyphs in the set", columns, m_rows,
+                  m_glyphSet.size());
+}
+
+void
+DigitalRain::advanceColumns(uint32 step)
+{
+    // Double precision, the distance fallen grows without bound over a long session
+    auto steps = static_cast<float64>(step);
+    for (size_t c = 0; c < m_head.size(); ++c)
+    {
+        float64 distance = static_cast<float64>(m_phase[c]) +
+                           static_cast<float64>(m_speed[c]) * steps;
+        auto cycle       = static_cast<float64>(m_cycle[c]);
+        m_head[c]        = static_cast<float32>(distance - std::floor(distance / cycle) * cycle);
+    }
+}
+
+void
+DigitalRain::emitGlyphs(uint32 step)
+{
+    m_codepoints.clear();
+    m_glyphX.clear();
+    m_glyphY.clear();
+    m_glyphScales.clear();
+    m_glyphColors.clear();
+
+    float32 meanPeriod = std::max(m_settings.mutationPeriod * m_settings.stepRate, 1.0f);
+    auto glyphCount    = static_cast<float32>(m_glyphSet.size());
+
+    for (uint32 i = 0; i < m_activeColumns; ++i)
+    {
+        uint32 column = m_order[i];
+        auto head     = static_cast<int32>(m_head[column]);
+        auto trail    = static_cast<int32>(m_trail[column]);
+        float32 x     = static_cast<float32>(column) * m_cellWidth;
+
+        for (int32 k = 0; k < trail; ++k)
+        {
+            int32 row = head - k;
+            if (row < 0)
+                break;
+            if (row >= m_rows)
+                continue;
+
+            // Every cell flips its glyph on its own period, at its own offset
+            uint32 cell    = column * static_cast<uint32>(m_rows) + static_cast<uint32>(row);
+            float32 period = meanPeriod * (0.5f + GlitchEffect::generateNoise(cell, PERIOD_SEED));
+            float32 offset = GlitchEffect::generateNoise(cell, OFFSET_SEED) * period;
+            auto epoch     = static_cast<uint32>((static_cast<float32>(step) + offset) / period);
+            auto glyph     = static_cast<size_t>(
+                GlitchEffect::generateNoise(cell, GLYPH_SEED + epoch) * glyphCount);
+
+            float32 fade = 1.0f - static_cast<float32>(k) / static_cast<float32>(trail);
+            m_codepoints.push_back(m_glyphSet[std::min(glyph, m_glyphSet.size() - 1)]);
+            m_glyphX.push_back(x);
+            m_glyphY.push_back(static_cast<float32>(row) * m_cellHeight);
+            m_glyphScales.push_back(m_settings.scale);
+            m_glyphColors.push_back(k == 0 ? toRainColor(m_settings.headColor,
+                                                         m_settings.brightness)
+                                           : toRainColor(m_settings.trailColor,
+                                                         m_settings.brightness * fade));
+        }
+    }
+}
+
+void
+DigitalRain::adjustDensity()
+{
+    float32 meanCost = m_costSum / static_cast<float32>(m_costFrames);
+    m_costSum        = 0.0f;
+    m_costFrames     = 0;
+    m_stats.costMs   = meanCost;
+
+    uint32 columns    = m_stats.columns;
+    uint32 maxColumns = getMaxColumns();
+    auto minColumns   = std::min(
+        maxColumns,
+        static_cast<uint32>(std::ceil(static_cast<float32>(columns) * m_settings.minDensity)));
+
+    uint32 active = m_activeColumns;
+    if (meanCost > m_settings.budgetMs)
+    {
+        // Cost is close to linear in the column count, scale straight to the budget
+        float32 fit = m_settings.budgetMs / meanCost * BACK_OFF_MARGIN;
+        active      = static_cast<uint32>(static_cast<float32>(active) * fit);
+    }
+    else if (meanCost < m_settings.budgetMs * GROW_BELOW)
+    {
+        active += std::max(columns / GROW_DIVISOR, 1u);
+    }
+    active = std::clamp(active, minColumns, maxColumns);
+
+    if (active != m_activeColumns)
+    {
+        Logger::debug("Digital rain: {:.3f} ms for {} columns (budget {:.3f} ms), now {}",
+                      meanCost, m_activeColumns, m_settings.budgetMs, active);
+        m_activeColumns = active;
+    }
+    m_stats.activeColumns = m_activeColumns;
+}
+
+uint32
+DigitalRain::getMaxColumns() const
+{
+    uint32 columns = m_stats.columns;
+    return m_quality == EffectQuality::Low ? (columns + 1) / 2 : columns;
+}
+
+}  // namespace deadcode
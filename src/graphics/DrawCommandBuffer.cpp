@@ -0,0 +1,377 @@
+/**
+ * @file DrawCommandBuffer.cpp
+ * @brief Implementation of DrawCommandBuffer class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-22
+ */
+
+#include "deadcode/graphics/DrawCommandBuffer.hpp"
+
+#include "deadcode/core/Logger.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace deadcode
+{
+
+namespace
+{
+constexpr uint32 VERTICES_PER_QUAD = 4;
+}  // namespace
+
+DrawCommandBuffer::DrawCommandBuffer(RenderBackend* backend)
+    : m_backend(backend),
+      m_layer(DrawLayer::DEFAULT),
+      m_blend(RenderBlend::Alpha)
+{
+}
+
+RenderBackendType
+DrawCommandBuffer::getType() const
+{
+    return m_backend->getType();
+}
+
+bool
+DrawCommandBuffer::supportsRenderTargets() const
+{
+    return m_backend->supportsRenderTargets();
+}
+
+Texture2D
+DrawCommandBuffer::loadTexture(const Image& image, bool bilinear)
+{
+    return m_backend->loadTexture(image, bilinear);
+}
+
+void
+DrawCommandBuffer::updateTexture(const Texture2D& texture, const Rectangle& region,
+                                 const void* pixels)
+{
+    m_backend->updateTexture(texture, region, pixels);
+}
+
+void
+DrawCommandBuffer::unloadTexture(const Texture2D& texture)
+{
+    m_backend->unloadTexture(texture);
+}
+
+RenderTexture2D
+DrawCommandBuffer::loadRenderTarget(int32 width, int32 height, bool bilinear)
+{
+    return m_backend->loadRenderTarget(width, height, bilinear);
+}
+
+void
+DrawCommandBuffer::unloadRenderTarget(const RenderTexture2D& target)
+{
+    m_backend->unloadRenderTarget(target);
+}
+
+::Shader
+DrawCommandBuffer::loadShader(const char* vertexPath, const char* fragmentPath)
+{
+    return m_backend->loadShader(vertexPath, fragmentPath);
+}
+
+void
+DrawCommandBuffer::unloadShader(const ::Shader& shader)
+{
+    m_backend->unloadShader(shader);
+}
+
+void
+DrawCommandBuffer::beginFrame(Color clearColor)
+{
+    m_commands.clear();
+    m_effects.clear();
+    m_levels.clear();
+    m_frameStats = DrawCommandStats{};
+    m_layer      = DrawLayer::DEFAULT;
+    m_backend->beginFrame(clearColor);
+}
+
+void
+DrawCommandBuffer::endFrame()
+{
+    flush();
+    if (!m_levels.empty())
+    {
+        // The backend reports the unbalanced targets; still draw what they left behind
+        m_levels.clear();
+        flush();
+    }
+    m_lastFrameStats = m_frameStats;
+    m_backend->endFrame();
+
+    Logger::trace("Frame: {} commands, {} state changes, {} draw calls, {} vertices",
+                  m_lastFrameStats.commands, m_lastFrameStats.stateChanges,
+                  m_lastFrameStats.drawCalls, m_lastFrameStats.vertices);
+}
+
+void
+DrawCommandBuffer::beginRenderTarget(const RenderTexture2D& target, float32 viewWidth,
+                                     float32 viewHeight)
+{
+    m_levels.push_back(
+        {m_commands.size(), m_effects.size(), target, viewWidth, viewHeight, m_blend});
+    m_backend->beginRenderTarget(target, viewWidth, viewHeight);
+}
+
+void
+DrawCommandBuffer::endRenderTarget()
+{
+    flush();
+    if (!m_levels.empty())
+    {
+        m_levels.pop_back();
+    }
+    m_backend->endRenderTarget();
+}
+
+void
+DrawCommandBuffer::clearRenderTarget(Color color)
+{
+    flush();
+    m_backend->clearRenderTarget(color);
+}
+
+void
+DrawCommandBuffer::setBlendMode(RenderBlend blend)
+{
+    flush();
+    m_blend = blend;
+    m_backend->setBlendMode(blend);
+}
+
+void
+DrawCommandBuffer::drawGlyph(const Texture2D& texture, const Rectangle& dest,
+                             const Rectangle& source, Color color, const ::Shader& shader,
+                             int32 codepoint)
+{
+    m_commands.push_back({m_layer, CommandKind::Glyph, RenderBlend::Alpha, texture, shader, dest,
+                          source, color, codepoint, 0});
+}
+
+void
+DrawCommandBuffer::drawEffectGlyph(const Texture2D& texture, const Rectangle& dest,
+                                   const Rectangle& source, Color color, const ::Shader& shader,
+                                   const GlyphEffectAttributes& attributes, int32 codepoint)
+{
+    m_effects.push_back(attributes);
+    m_commands.push_back({m_layer, CommandKind::Glyph, RenderBlend::Alpha, texture, shader, dest,
+                          source, color, codepoint, static_cast<uint32>(m_effects.size())});
+}
+
+void
+DrawCommandBuffer::drawTexture(const Texture2D& texture, const Rectangle& dest,
+                               const Rectangle& source, Color color, RenderBlend blend)
+{
+    m_commands.push_back({m_layer, CommandKind::Texture, blend, texture, ::Shader{}, dest, source,
+                          color, 0, 0});
+}
+
+void
+DrawCommandBuffer::drawShadedTexture(const Texture2D& texture, const Rectangle& dest,
+                                     const Rectangle& source, const ::Shader& shader)
+{
+    m_commands.push_back({m_layer, CommandKind::Texture, m_blend, texture, shader, dest, source,
+                          WHITE, 0, 0});
+}
+
+int32
+DrawCommandBuffer::getShaderLocation(const ::Shader& shader, const char* uniformName)
+{
+    return m_backend->getShaderLocation(shader, uniformName);
+}
+
+void
+DrawCommandBuffer::setShaderValue(const ::Shader& shader, int32 location, const void* value,
+                                  int32 uniformType, int32 count)
+{
+    m_backend->setShaderValue(shader, location, value, uniformType, count);
+}
+
+void
+DrawCommandBuffer::drawRectangle(const Rectangle& rect, Color color)
+{
+    m_commands.push_back({m_layer, CommandKind::Rectangle, RenderBlend::Alpha, Texture2D{},
+                          ::Shader{}, rect, Rectangle{}, color, 0, 0});
+}
+
+uint32
+DrawCommandBuffer::flush()
+{
+    // Only the bound target's commands, outer targets wait for their turn
+    size_t first       = m_levels.empty() ? 0 : m_levels.back().firstCommand;
+    size_t firstEffect = m_levels.empty() ? 0 : m_levels.back().firstEffect;
+    if (m_commands.size() == first)
+        return 0;
+
+    m_order.resize(m_commands.size() - first);
+    std::iota(m_order.begin(), m_order.end(), static_cast<uint32>(first));
+
+    // Layer, kind, texture, then shader; the index keeps equal states in submission order
+    std::sort(m_order.begin(), m_order.end(), [this](uint32 a, uint32 b) {
+        const Command& lhs = m_commands[a];
+        const Command& rhs = m_commands[b];
+        if (lhs.layer != rhs.layer)
+            return lhs.layer < rhs.layer;
+        if (lhs.kind != rhs.kind)
+            return lhs.kind < rhs.kind;
+        if (lhs.texture.id != rhs.texture.id)
+            return lhs.texture.id < rhs.texture.id;
+        if (lhs.shader.id != rhs.shader.id)
+            return lhs.shader.id < rhs.shader.id;
+        return a < b;
+    });
+
+    uint32 drawCalls        = 0;
+    const Command* previous = nullptr;
+    for (uint32 index : m_order)
+    {
+        const Command& command = m_commands[index];
+
+        if (previous && previous->layer != command.layer)
+        {
+            // Everything in lower layers must be on screen before this layer starts
+            drawCalls += m_backend->flush();
+        }
+
+        bool stateChanged = !previous || previous->texture.id != command.texture.id ||
+                            previous->shader.id != command.shader.id;
+        if (previous && stateChanged)
+        {
+            m_frameStats.stateChanges++;
+        }
+
+        if (command.kind == CommandKind::Rectangle)
+        {
+            // A run of rectangles shares one draw in the backend's immediate batch
+            if (stateChanged || previous->layer != command.layer)
+            {
+                drawCalls++;
+            }
+            m_backend->drawRectangle(command.dest, command.color);
+        }
+        else if (command.kind == CommandKind::Texture)
+        {
+            drawCalls++;
+            if (command.shader.id != 0)
+            {
+                m_backend->drawShadedTexture(command.texture, command.dest, command.source,
+                                             command.shader);
+            }
+            else
+            {
+                m_backend->drawTexture(command.texture, command.dest, command.source,
+                                       command.color, command.blend);
+            }
+        }
+        else if (command.effect != 0)
+        {
+            m_backend->drawEffectGlyph(command.texture, command.dest, command.source,
+                                       command.color, command.shader,
+                                       m_effects[command.effect - 1], command.codepoint);
+        }
+        else
+        {
+            m_backend->drawGlyph(command.texture, command.dest, command.source, command.color,
+                                 command.shader, command.codepoint);
+        }
+
+        previous = &command;
+    }
+    drawCalls += m_backend->flush();
+
+    auto executed = static_cast<uint32>(m_order.size());
+    m_frameStats.commands += executed;
+    m_frameStats.vertices += executed * VERTICES_PER_QUAD;
+    m_frameStats.drawCalls += drawCalls;
+
+    m_commands.resize(first);
+    m_effects.resize(firstEffect);
+    return drawCalls;
+}
+
+uint32
+DrawCommandBuffer::flushAll()
+{
+    if (m_levels.empty())
+        return flush();
+
+    std::vector<TargetLevel> levels = m_levels;
+    RenderBlend innerBlend          = m_blend;
+
+    // Unwind to the screen, each target's commands drawn into it under its own blend mode.
+    // Blend changes go straight to the backend, setBlendMode() would flush the wrong level.
+    uint32 drawCalls = 0;
+    while (!m_levels.empty())
+    {
+        drawCalls += flush();
+        RenderBlend outerBlend = m_levels.back().outerBlend;
+        m_levels.pop_back();
+        m_backend->endRenderTarget();
+        if (outerBlend != m_blend)
+        {
+            m_blend = outerBlend;
+            m_backend->setBlendMode(outerBlend);
+        }
+    }
+    drawCalls += flush();
+
+    // Bind the same targets again; nothing is queued, so every level starts empty
+    for (TargetLevel& level : levels)
+    {
+        if (level.outerBlend != m_blend)
+        {
+            m_blend = level.outerBlend;
+            m_backend->setBlendMode(level.outerBlend);
+        }
+        level.firstCommand = 0;
+        level.firstEffect  = 0;
+        m_levels.push_back(level);
+        m_backend->beginRenderTarget(level.target, level.viewWidth, level.viewHeight);
+    }
+    if (innerBlend != m_blend)
+    {
+        m_blend = innerBlend;
+        m_backend->setBlendMode(innerBlend);
+    }
+    return drawCalls;
+}
+
+void
+DrawCommandBuffer::setDrawLayer(int32 layer)
+{
+    m_layer = layer;
+}
+
+int32
+DrawCommandBuffer::getDrawLayer() const
+{
+    return m_layer;
+}
+
+uint32
+DrawCommandBuffer::getPendingCount() const
+{
+    return static_cast<uint32>(m_commands.size());
+}
+
+const DrawCommandStats&
+DrawCommandBuffer::getFrameStats() const
+{
+    return m_frameStats;
+}
+
+const DrawCommandStats&
+DrawCommandBuffer::getLastFrameStats() const
+{
+    return m_lastFrameStats;
+}
+
+}  // namespace deadcode
@@ -0,0 +1,435 @@
+/**
+ * @file Easing.cpp
+ * @brief Implementation of easing curves and their tables
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-03
+ */
+
+#include "deadcode/graphics/Easing.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace deadcode
+{
+
+namespace
+{
+constexpr float32 MY_PI = 3.14159265358979323846f;
+
+constexpr uint32 TABLE_COUNT = 6;  ///< Expo and elastic
+
+/// Row of a curve in the tables, or TABLE_COUNT if it has none
+constexpr uint32
+getTableRow(EasingType type)
+{
+    switch (type)
+    {
+        case EasingType::InExpo:
+            return 0;
+        case EasingType::OutExpo:
+            return 1;
+        case EasingType::InOutExpo:
+            return 2;
+        case EasingType::InElastic:
+            return 3;
+        case EasingType::OutElastic:
+            return 4;
+        case EasingType::InOutElastic:
+            return 5;
+        default:
+            return TABLE_COUNT;
+    }
+}
+
+using EasingTable = std::array<float32, Easing::TABLE_SIZE + 1>;
+
+/// Built on first use, the build is thread-safe as a function-local static
+const std::array<EasingTable, TABLE_COUNT>&
+getTables()
+{
+    static const std::array<EasingTable, TABLE_COUNT> tables = []
+    {
+        std::array<EasingTable, TABLE_COUNT> result{};
+        for (uint32 type = 0; type < static_cast<uint32>(EasingType::Count); ++type)
+        {
+            uint32 row = getTableRow(static_cast<EasingType>(type));
+            if (row == TABLE_COUNT)
+                continue;
+
+            for (uint32 i = 0; i <= Easing::TABLE_SIZE; ++i)
+            {
+                float32 t      = static_cast<float32>(i) / static_cast<float32>(Easing::TABLE_SIZE);
+                result[row][i] = Easing::evaluate(static_cast<EasingType>(type), t);
+            }
+        }
+        return result;
+    }();
+    return tables;
+}
+}  // namespace
+
+// ============================================================================
+// EASING FUNCTION IMPLEMENTATIONS
+// ============================================================================
+
+namespace Easing
+{
+
+float32
+linear(float32 t)
+{
+    return t;
+}
+
+float32
+easeInQuad(float32 t)
+{
+    return t * t;
+}
+
+float32
+easeOutQuad(float32 t)
+{
+    return 1.0f - (1.0f - t) * (1.0f - t);
+}
+
+float32
+easeInOutQuad(float32 t)
+{
+    float32 u = -2.0f * t + 2.0f;
+    return t < 0.5f ? 2.0f * t * t : 1.0f - u * u / 2.0f;
+}
+
+float32
+easeInCubic(float32 t)
+{
+    return t * t * t;
+}
+
+float32
+easeOutCubic(float32 t)
+{
+    float32 u = 1.0f - t;
+    return 1.0f - u * u * u;
+}
+
+float32
+easeInOutCubic(float32 t)
+{
+    float32 u = -2.0f * t + 2.0f;
+    return t < 0.5f ? 4.0f * t * t * t : 1.0f - u * u * u / 2.0f;
+}
+
+float32
+easeInQuart(float32 t)
+{
+    return t * t * t * t;
+}
+
+float32
+easeOutQuart(float32 t)
+{
+    float32 u = 1.0f - t;
+    return 1.0f - u * u * u * u;
+}
+
+float32
+easeInOutQuart(float32 t)
+{
+    float32 u = -2.0f * t + 2.0f;
+    return t < 0.5f ? 8.0f * t * t * t * t : 1.0f - u * u * u * u / 2.0f;
+}
+
+float32
+easeInQuint(float32 t)
+{
+    return t * t * t * t * t;
+}
+
+float32
+easeOutQuint(float32 t)
+{
+    float32 u = 1.0f - t;
+    return 1.0f - u * u * u * u * u;
+}
+
+float32
+easeInOutQuint(float32 t)
+{
+    float32 u = -2.0f * t + 2.0f;
+    return t < 0.5f ? 16.0f * t * t * t * t * t : 1.0f - u * u * u * u * u / 2.0f;
+}
+
+float32
+easeInSine(float32 t)
+{
+    return 1.0f - std::cos((t * MY_PI) / 2.0f);
+}
+
+float32
+easeOutSine(float32 t)
+{
+    return std::sin((t * MY_PI) / 2.0f);
+}
+
+float32
+easeInOutSine(float32 t)
+{
+    return -(std::cos(MY_PI * t) - 1.0f) / 2.0f;
+}
+
+float32
+easeInExpo(float32 t)
+{
+    return t == 0.0f ? 0.0f : std::exp2(10.0f * t - 10.0f);
+}
+
+float32
+easeOutExpo(float32 t)
+{
+    return t == 1.0f ? 1.0f : 1.0f - std::exp2(-10.0f * t);
+}
+
+float32
+easeInOutExpo(float32 t)
+{
+    if (t == 0.0f)
+        return 0.0f;
+    if (t == 1.0f)
+        return 1.0f;
+    return t < 0.5f ? std::exp2(20.0f * t - 10.0f) / 2.0f
+                    : (2.0f - std::exp2(-20.0f * t + 10.0f)) / 2.0f;
+}
+
+float32
+easeInCirc(float32 t)
+{
+    return 1.0f - std::sqrt(1.0f - t * t);
+}
+
+float32
+easeOutCirc(float32 t)
+{
+    float32 u = t - 1.0f;
+    return std::sqrt(1.0f - u * u);
+}
+
+float32
+easeInOutCirc(float32 t)
+{
+    float32 u = 2.0f * t;
+    float32 v = -2.0f * t + 2.0f;
+    return t < 0.5f ? (1.0f - std::sqrt(1.0f - u * u)) / 2.0f
+                    : (std::sqrt(1.0f - v * v) + 1.0f) / 2.0f;
+}
+
+float32
+easeInElastic(float32 t)
+{
+    constexpr float32 c4 = (2.0f * MY_PI) / 3.0f;
+    if (t == 0.0f)
+        return 0.0f;
+    if (t == 1.0f)
+        return 1.0f;
+    return -std::exp2(10.0f * t - 10.0f) * std::sin((t * 10.0f - 10.75f) * c4);
+}
+
+float32
+easeOutElastic(float32 t)
+{
+    constexpr float32 c4 = (2.0f * MY_PI) / 3.0f;
+    if (t == 0.0f)
+        return 0.0f;
+    if (t == 1.0f)
+        return 1.0f;
+    return std::exp2(-10.0f * t) * std::sin((t * 10.0f - 0.75f) * c4) + 1.0f;
+}
+
+float32
+easeInOutElastic(float32 t)
+{
+    constexpr float32 c5 = (2.0f * MY_PI) / 4.5f;
+    if (t == 0.0f)
+        return 0.0f;
+    if (t == 1.0f)
+        return 1.0f;
+    float32 wave = std::sin((20.0f * t - 11.125f) * c5);
+    return t < 0.5f ? -(std::exp2(20.0f * t - 10.0f) * wave) / 2.0f
+                    : (std::exp2(-20.0f * t + 10.0f) * wave) / 2.0f + 1.0f;
+}
+
+float32
+easeInBack(float32 t)
+{
+    constexpr float32 c1 = 1.70158f;
+    constexpr float32 c3 = c1 + 1.0f;
+    return c3 * t * t * t - c1 * t * t;
+}
+
+float32
+easeOutBack(float32 t)
+{
+    constexpr float32 c1 = 1.70158f;
+    constexpr float32 c3 = c1 + 1.0f;
+    float32 u            = t - 1.0f;
+    return 1.0f + c3 * u * u * u + c1 * u * u;
+}
+
+float32
+easeInOutBack(float32 t)
+{
+    constexpr float32 c1 = 1.70158f;
+    constexpr float32 c2 = c1 * 1.525f;
+    float32 u            = 2.0f * t;
+    float32 v            = 2.0f * t - 2.0f;
+    return t < 0.5f ? (u * u * ((c2 + 1.0f) * u - c2)) / 2.0f
+                    : (v * v * ((c2 + 1.0f) * v + c2) + 2.0f) / 2.0f;
+}
+
+float32
+easeOutBounce(float32 t)
+{
+    constexpr float32 n1 = 7.5625f;
+    constexpr float32 d1 = 2.75f;
+    if (t < 1.0f / d1)
+    {
+        return n1 * t * t;
+    }
+    else if (t < 2.0f / d1)
+    {
+        t -= 1.5f / d1;
+        return n1 * t * t + 0.75f;
+    }
+    else if (t < 2.5f / d1)
+    {
+        t -= 2.25f / d1;
+        return n1 * t * t + 0.9375f;
+    }
+    else
+    {
+        t -= 2.625f / d1;
+        return n1 * t * t + 0.984375f;
+    }
+}
+
+float32
+easeInBounce(float32 t)
+{
+    return 1.0f - easeOutBounce(1.0f - t);
+}
+
+float32
+easeInOutBounce(float32 t)
+{
+    return t < 0.5f ? (1.0f - easeOutBounce(1.0f - 2.0f * t)) / 2.0f
+                    : (1.0f + easeOutBounce(2.0f * t - 1.0f)) / 2.0f;
+}
+
+// ============================================================================
+// DISPATCH
+// ============================================================================
+
+float32
+evaluate(EasingType type, float32 t)
+{
+    switch (type)
+    {
+        case EasingType::Linear:
+            return linear(t);
+        case EasingType::InQuad:
+            return easeInQuad(t);
+        case EasingType::OutQuad:
+            return easeOutQuad(t);
+        case EasingType::InOutQuad:
+            return easeInOutQuad(t);
+        case EasingType::InCubic:
+            return easeInCubic(t);
+        case EasingType::OutCubic:
+            return easeOutCubic(t);
+        case EasingType::InOutCubic:
+            return easeInOutCubic(t);
+        case EasingType::InQuart:
+            return easeInQuart(t);
+        case EasingType::OutQuart:
+            return easeOutQuart(t);
+        case EasingType::InOutQuart:
+            return easeInOutQuart(t);
+        case EasingType::InQuint:
+            return easeInQuint(t);
+        case EasingType::OutQuint:
+            return easeOutQuint(t);
+        case EasingType::InOutQuint:
+            return easeInOutQuint(t);
+        case EasingType::InSine:
+            return easeInSine(t);
+        case EasingType::OutSine:
+            return easeOutSine(t);
+        case EasingType::InOutSine:
+            return easeInOutSine(t);
+        case EasingType::InExpo:
+            return easeInExpo(t);
+        case EasingType::OutExpo:
+            return easeOutExpo(t);
+        case EasingType::InOutExpo:
+            return easeInOutExpo(t);
+        case EasingType::InCirc:
+            return easeInCirc(t);
+        case EasingType::OutCirc:
+            return easeOutCirc(t);
+        case EasingType::InOutCirc:
+            return easeInOutCirc(t);
+        case EasingType::InElastic:
+            return easeInElastic(t);
+        case EasingType::OutElastic:
+            return easeOutElastic(t);
+        case EasingType::InOutElastic:
+            return easeInOutElastic(t);
+        case EasingType::InBack:
+            return easeInBack(t);
+        case EasingType::OutBack:
+            return easeOutBack(t);
+        case EasingType::InOutBack:
+            return easeInOutBack(t);
+        case EasingType::OutBounce:
+            return easeOutBounce(t);
+        case EasingType::InBounce:
+            return easeInBounce(t);
+        case EasingType::InOutBounce:
+            return easeInOutBounce(t);
+        case EasingType::Count:
+            break;
+    }
+    return t;
+}
+
+float32
+sample(EasingType type, float32 t)
+{
+    uint32 row = getTableRow(type);
+    if (row == TABLE_COUNT)
+        return evaluate(type, t);
+
+    const EasingTable& table = getTables()[row];
+    if (t <= 0.0f)
+        return table.front();
+    if (t >= 1.0f)
+        return table.back();
+
+    float32 position = t * static_cast<float32>(TABLE_SIZE);
+    uint32 index     = std::min(static_cast<uint32>(position), TABLE_SIZE - 1);
+    float32 fraction = position - static_cast<float32>(index);
+    return table[index] + (table[index + 1] - table[index]) * fraction;
+}
+
+bool
+hasTable(EasingType type)
+{
+    return getTableRow(type) != TABLE_COUNT;
+}
+
+}  // namespace Easing
+
+}  // namespace deadcode
@@ -0,0 +1,775 @@
+/**
+ * @file EasingBatch.cpp
+ * @brief Implementation of the batch easing kernels
+ *
+ * Each curve is written once as a template over a lane type, then
+ * instantiated for the widest vector type the build targets and for a
+ * single float, which handles the tail of a run. Lane types provide the
+ * arithmetic operators plus the handful of free functions below (select,
+ * less, equal, floor, sqrt, ...).
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-04
+ */
+
+#include "deadcode/graphics/EasingBatch.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#if defined(__AVX2__)
+#define DEADCODE_EASING_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DEADCODE_EASING_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace deadcode
+{
+
+namespace
+{
+// ============================================================================
+// LANE TYPES
+// ============================================================================
+
+/// One float, the fallback and the tail of every run
+struct ScalarLanes
+{
+    static constexpr uint32 WIDTH = 1;
+
+    float32 v;
+
+    static ScalarLanes
+    load(const float32* p)
+    {
+        return {*p};
+    }
+
+    void
+    store(float32* p) const
+    {
+        *p = v;
+    }
+};
+
+inline ScalarLanes
+broadcast(ScalarLanes, float32 value)
+{
+    return {value};
+}
+
+inline ScalarLanes
+operator+(ScalarLanes a, ScalarLanes b)
+{
+    return {a.v + b.v};
+}
+
+inline ScalarLanes
+operator-(ScalarLanes a, ScalarLanes b)
+{
+    return {a.v - b.v};
+}
+
+inline ScalarLanes
+operator*(ScalarLanes a, ScalarLanes b)
+{
+    return {a.v * b.v};
+}
+
+inline bool
+less(ScalarLanes a, ScalarLanes b)
+{
+    return a.v < b.v;
+}
+
+inline bool
+equal(ScalarLanes a, ScalarLanes b)
+{
+    return a.v == b.v;
+}
+
+inline ScalarLanes
+select(bool mask, ScalarLanes a, ScalarLanes b)
+{
+    return mask ? a : b;
+}
+
+inline ScalarLanes
+minimum(ScalarLanes a, ScalarLanes b)
+{
+    return {std::min(a.v, b.v)};
+}
+
+inline ScalarLanes
+maximum(ScalarLanes a, ScalarLanes b)
+{
+    return {std::max(a.v, b.v)};
+}
+
+inline ScalarLanes
+floorLanes(ScalarLanes a)
+{
+    return {std::floor(a.v)};
+}
+
+inline ScalarLanes
+sqrtLanes(ScalarLanes a)
+{
+    return {std::sqrt(a.v)};
+}
+
+/// 2^n for integral n in [-126, 127]
+inline ScalarLanes
+pow2Integral(ScalarLanes n)
+{
+    return {std::bit_cast<float32>(static_cast<uint32>(static_cast<int32>(n.v) + 127) << 23)};
+}
+
+#if defined(DEADCODE_EASING_AVX2)
+
+/// Eight floats in an AVX register
+struct WideLanes
+{
+    static constexpr uint32 WIDTH = 8;
+
+    __m256 v;
+
+    static WideLanes
+    load(const float32* p)
+    {
+        return {_mm256_loadu_ps(p)};
+    }
+
+    void
+    store(float32* p) const
+    {
+        _mm256_storeu_ps(p, v);
+    }
+};
+
+inline WideLanes
+broadcast(WideLanes, float32 value)
+{
+    return {_mm256_set1_ps(value)};
+}
+
+inline WideLanes
+operator+(WideLanes a, WideLanes b)
+{
+    return {_mm256_add_ps(a.v, b.v)};
+}
+
+inline WideLanes
+operator-(WideLanes a, WideLanes b)
+{
+    return {_mm256_sub_ps(a.v, b.v)};
+}
+
+inline WideLanes
+operator*(WideLanes a, WideLanes b)
+{
+    return {_mm256_mul_ps(a.v, b.v)};
+}
+
+inline __m256
+less(WideLanes a, WideLanes b)
+{
+    return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ);
+}
+
+inline __m256
+equal(WideLanes a, WideLanes b)
+{
+    return _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ);
+}
+
+inline WideLanes
+select(__m256 mask, WideLanes a, WideLanes b)
+{
+    return {_mm256_blendv_ps(b.v, a.v, mask)};
+}
+
+inline WideLanes
+minimum(WideLanes a, WideLanes b)
+{
+    return {_mm256_min_ps(a.v, b.v)};
+}
+
+inline WideLanes
+maximum(WideLanes a, WideLanes b)
+{
+    return {_mm256_max_ps(a.v, b.v)};
+}
+
+inline WideLanes
+floorLanes(WideLanes a)
+{
+    return {_mm256_floor_ps(a.v)};
+}
+
+inline WideLanes
+sqrtLanes(WideLanes a)
+{
+    return {_mm256_sqrt_ps(a.v)};
+}
+
+inline WideLanes
+pow2Integral(WideLanes n)
+{
+    __m256i exponent = _mm256_add_epi32(_mm256_cvttps_epi32(n.v), _mm256_set1_epi32(127));
+    return {_mm256_castsi256_ps(_mm256_slli_epi32(exponent, 23))};
+}
+
+#elif defined(DEADCODE_EASING_SSE2)
+
+/// Four floats in an SSE register
+struct WideLanes
+{
+    static constexpr uint32 WIDTH = 4;
+
+    __m128 v;
+
+    static WideLanes
+    load(const float32* p)
+    {
+        return {_mm_loadu_ps(p)};
+    }
+
+    void
+    store(float32* p) const
+    {
+        _mm_storeu_ps(p, v);
+    }
+};
+
+inline WideLanes
+broadcast(WideLanes, float32 value)
+{
+    return {_mm_set1_ps(value)};
+}
+
+inline WideLanes
+operator+(WideLanes a, WideLanes b)
+{
+    return {_mm_add_ps(a.v, b.v)};
+}
+
+inline WideLanes
+operator-(WideLanes a, WideLanes b)
+{
+    return {_mm_sub_ps(a.v, b.v)};
+}
+
+inline WideLanes
+operator*(WideLanes a, WideLanes b)
+{
+    return {_mm_mul_ps(a.v, b.v)};
+}
+
+inline __m128
+less(WideLanes a, WideLanes b)
+{
+    return _mm_cmplt_ps(a.v, b.v);
+}
+
+inline __m128
+equal(WideLanes a, WideLanes b)
+{
+    return _mm_cmpeq_ps(a.v, b.v);
+}
+
+inline WideLanes
+select(__m128 mask, WideLanes a, WideLanes b)
+{
+    return {_mm_or_ps(_mm_and_ps(mask, a.v), _mm_andnot_ps(mask, b.v))};
+}
+
+inline WideLanes
+minimum(WideLanes a, WideLanes b)
+{
+    return {_mm_min_ps(a.v, b.v)};
+}
+
+inline WideLanes
+maximum(WideLanes a, WideLanes b)
+{
+    return {_mm_max_ps(a.v, b.v)};
+}
+
+/// SSE2 has no floor; truncate, then step down where truncation rounded up
+inline WideLanes
+floorLanes(WideLanes a)
+{
+    __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(a.v));
+    __m128 roundedUp = _mm_cmpgt_ps(truncated, a.v);
+    return {_mm_sub_ps(truncated, _mm_and_ps(roundedUp, _mm_set1_ps(1.0f)))};
+}
+
+inline WideLanes
+sqrtLanes(WideLanes a)
+{
+    return {_mm_sqrt_ps(a.v)};
+}
+
+inline WideLanes
+pow2Integral(WideLanes n)
+{
+    __m128i exponent = _mm_add_epi32(_mm_cvttps_epi32(n.v), _mm_set1_epi32(127));
+    return {_mm_castsi128_ps(_mm_slli_epi32(exponent, 23))};
+}
+
+#else
+
+using WideLanes = ScalarLanes;
+
+#endif
+
+// ============================================================================
+// APPROXIMATIONS
+// ============================================================================
+
+constexpr float32 PI          = 3.14159265358979323846f;
+constexpr float32 HALF_PI     = PI / 2.0f;
+constexpr float32 INV_TWO_PI  = 0.159154943091895335769f;
+constexpr float32 TWO_PI_HIGH = 6.28125f;                   ///< Few mantissa bits, k * it is exact
+constexpr float32 TWO_PI_LOW  = 1.9353071795864769253e-3f;  ///< 2 pi - TWO_PI_HIGH
+
+/// Broadcast a constant to every lane
+template <typename V>
+V
+splat(float32 value)
+{
+    return broadcast(V{}, value);
+}
+
+/**
+ * @brief 2^x for x in [-126, 126], relative error below 2e-7
+ *
+ * Splits x into integer and fraction; 2^fraction is a degree-5 minimax
+ * polynomial on [0, 1), 2^integer is built in the exponent bits.
+ */
+template <typename V>
+V
+exp2Approx(V x)
+{
+    x         = minimum(maximum(x, splat<V>(-126.0f)), splat<V>(126.0f));
+    V integer = floorLanes(x);
+    V f       = x - integer;
+
+    V p = splat<V>(0.00189646115f);
+    p   = p * f + splat<V>(0.00894282898f);
+    p   = p * f + splat<V>(0.0558662463f);
+    p   = p * f + splat<V>(0.240139711f);
+    p   = p * f + splat<V>(0.693154752f);
+    p   = p * f + splat<V>(0.999999893f);
+    return p * pow2Integral(integer);
+}
+
+/**
+ * @brief sin(x), absolute error below 1e-7 on top of the rounding of x
+ *
+ * Reduces x to [-pi, pi] in two steps so k * 2 pi adds no error, folds it
+ * to [-pi/2, pi/2], then evaluates an odd degree-9 minimax polynomial.
+ */
+template <typename V>
+V
+sinApprox(V x)
+{
+    V k = floorLanes(x * splat<V>(INV_TWO_PI) + splat<V>(0.5f));
+    x   = x - k * splat<V>(TWO_PI_HIGH);
+    x   = x - k * splat<V>(TWO_PI_LOW);
+
+    x = select(less(splat<V>(HALF_PI), x), splat<V>(PI) - x, x);
+    x = select(less(x, splat<V>(-HALF_PI)), splat<V>(-PI) - x, x);
+
+    V y = x * x;
+    V p = splat<V>(2.60522492e-06f);
+    p   = p * y + splat<V>(-0.000198090753f);
+    p   = p * y + splat<V>(0.00833305106f);
+    p   = p * y + splat<V>(-0.16666658f);
+    p   = p * y + splat<V>(0.999999996f);
+    return p * x;
+}
+
+// ============================================================================
+// CURVES
+// ============================================================================
+
+template <typename V>
+V
+half(V x)
+{
+    return x * splat<V>(0.5f);
+}
+
+template <typename V>
+V
+inPower(V t, uint32 power)
+{
+    V result = t;
+    for (uint32 i = 1; i < power; ++i)
+    {
+        result = result * t;
+    }
+    return result;
+}
+
+template <typename V>
+V
+outPower(V t, uint32 power)
+{
+    return splat<V>(1.0f) - inPower(splat<V>(1.0f) - t, power);
+}
+
+/// 2^(power-1) t^power below 0.5, mirrored above
+template <typename V>
+V
+inOutPower(V t, uint32 power)
+{
+    V u = splat<V>(-2.0f) * t + splat<V>(2.0f);
+    return select(less(t, splat<V>(0.5f)),
+                  splat<V>(static_cast<float32>(1u << (power - 1))) * inPower(t, power),
+                  splat<V>(1.0f) - half(inPower(u, power)));
+}
+
+/// Pin the curve to exactly 0 at t = 0 and 1 at t = 1
+template <typename V>
+V
+pinEnds(V t, V value)
+{
+    value = select(equal(t, splat<V>(0.0f)), splat<V>(0.0f), value);
+    return select(equal(t, splat<V>(1.0f)), splat<V>(1.0f), value);
+}
+
+template <typename V>
+V
+inSine(V t)
+{
+    return pinEnds(t, splat<V>(1.0f) - sinApprox(t * splat<V>(HALF_PI) + splat<V>(HALF_PI)));
+}
+
+template <typename V>
+V
+outSine(V t)
+{
+    return sinApprox(t * splat<V>(HALF_PI));
+}
+
+template <typename V>
+V
+inOutSine(V t)
+{
+    return pinEnds(t, half(splat<V>(1.0f) - sinApprox(t * splat<V>(PI) + splat<V>(HALF_PI))));
+}
+
+template <typename V>
+V
+inExpo(V t)
+{
+    V value = exp2Approx(splat<V>(10.0f) * t - splat<V>(10.0f));
+    return select(equal(t, splat<V>(0.0f)), splat<V>(0.0f), value);
+}
+
+template <typename V>
+V
+outExpo(V t)
+{
+    return pinEnds(t, splat<V>(1.0f) - exp2Approx(splat<V>(-10.0f) * t));
+}
+
+template <typename V>
+V
+inOutExpo(V t)
+{
+    auto lower = less(t, splat<V>(0.5f));
+    V e        = exp2Approx(select(lower, splat<V>(20.0f) * t - splat<V>(10.0f),
+                                   splat<V>(-20.0f) * t + splat<V>(10.0f)));
+    return pinEnds(t, select(lower, half(e), half(splat<V>(2.0f) - e)));
+}
+
+template <typename V>
+V
+inCirc(V t)
+{
+    return splat<V>(1.0f) - sqrtLanes(splat<V>(1.0f) - t * t);
+}
+
+template <typename V>
+V
+outCirc(V t)
+{
+    V u = t - splat<V>(1.0f);
+    return sqrtLanes(splat<V>(1.0f) - u * u);
+}
+
+template <typename V>
+V
+inOutCirc(V t)
+{
+    auto lower = less(t, splat<V>(0.5f));
+    V u        = select(lower, splat<V>(2.0f) * t, splat<V>(-2.0f) * t + splat<V>(2.0f));
+    V root     = sqrtLanes(splat<V>(1.0f) - u * u);
+    return select(lower, half(splat<V>(1.0f) - root), half(root + splat<V>(1.0f)));
+}
+
+template <typename V>
+V
+inElastic(V t)
+{
+    constexpr float32 c4 = (2.0f * PI) / 3.0f;
+
+    V wave  = sinApprox((t * splat<V>(10.0f) - splat<V>(10.75f)) * splat<V>(c4));
+    V value = splat<V>(0.0f) - exp2Approx(splat<V>(10.0f) * t - splat<V>(10.0f)) * wave;
+    return pinEnds(t, value);
+}
+
+template <typename V>
+V
+outElastic(V t)
+{
+    constexpr float32 c4 = (2.0f * PI) / 3.0f;
+
+    V wave  = sinApprox((t * splat<V>(10.0f) - splat<V>(0.75f)) * splat<V>(c4));
+    V value = exp2Approx(splat<V>(-10.0f) * t) * wave + splat<V>(1.0f);
+    return pinEnds(t, value);
+}
+
+template <typename V>
+V
+inOutElastic(V t)
+{
+    constexpr float32 c5 = (2.0f * PI) / 4.5f;
+
+    auto lower = less(t, splat<V>(0.5f));
+    V wave     = sinApprox((splat<V>(20.0f) * t - splat<V>(11.125f)) * splat<V>(c5));
+    V e        = exp2Approx(select(lower, splat<V>(20.0f) * t - splat<V>(10.0f),
+                                   splat<V>(-20.0f) * t + splat<V>(10.0f)));
+    V value    = select(lower, splat<V>(0.0f) - half(e * wave), half(e * wave) + splat<V>(1.0f));
+    return pinEnds(t, value);
+}
+
+template <typename V>
+V
+inBack(V t)
+{
+    constexpr float32 c1 = 1.70158f;
+    constexpr float32 c3 = c1 + 1.0f;
+    return t * t * (splat<V>(c3) * t - splat<V>(c1));
+}
+
+template <typename V>
+V
+outBack(V t)
+{
+    constexpr float32 c1 = 1.70158f;
+    constexpr float32 c3 = c1 + 1.0f;
+    V u                  = t - splat<V>(1.0f);
+    return splat<V>(1.0f) + u * u * (splat<V>(c3) * u + splat<V>(c1));
+}
+
+template <typename V>
+V
+inOutBack(V t)
+{
+    constexpr float32 c1 = 1.70158f;
+    constexpr float32 c2 = c1 * 1.525f;
+
+    auto lower = less(t, splat<V>(0.5f));
+    V u        = splat<V>(2.0f) * t - select(lower, splat<V>(0.0f), splat<V>(2.0f));
+    V bend     = select(lower, splat<V>(-c2), splat<V>(c2));
+    V value    = u * u * (splat<V>(c2 + 1.0f) * u + bend);
+    return select(lower, half(value), half(value + splat<V>(2.0f)));
+}
+
+/// Pick the parabola t falls on from the last one back, then evaluate it once
+template <typename V>
+V
+outBounce(V t)
+{
+    constexpr float32 n1 = 7.5625f;
+    constexpr float32 d1 = 2.75f;
+
+    V offset = splat<V>(2.625f / d1);
+    V lift   = splat<V>(0.984375f);
+
+    auto piece = less(t, splat<V>(2.5f / d1));
+    offset     = select(piece, splat<V>(2.25f / d1), offset);
+    lift       = select(piece, splat<V>(0.9375f), lift);
+
+    piece  = less(t, splat<V>(2.0f / d1));
+    offset = select(piece, splat<V>(1.5f / d1), offset);
+    lift   = select(piece, splat<V>(0.75f), lift);
+
+    piece  = less(t, splat<V>(1.0f / d1));
+    offset = select(piece, splat<V>(0.0f), offset);
+    lift   = select(piece, splat<V>(0.0f), lift);
+
+    V u = t - offset;
+    return splat<V>(n1) * u * u + lift;
+}
+
+template <typename V>
+V
+inBounce(V t)
+{
+    return splat<V>(1.0f) - outBounce(splat<V>(1.0f) - t);
+}
+
+template <typename V>
+V
+inOutBounce(V t)
+{
+    auto lower = less(t, splat<V>(0.5f));
+    V bounce   = outBounce(select(lower, splat<V>(1.0f) - splat<V>(2.0f) * t,
+                                  splat<V>(2.0f) * t - splat<V>(1.0f)));
+    return select(lower, half(splat<V>(1.0f) - bounce), half(splat<V>(1.0f) + bounce));
+}
+
+// ============================================================================
+// DRIVER
+// ============================================================================
+
+/**
+ * @brief Apply a curve over a run, full vectors first, then the tail
+ *
+ * @param curve Generic callable, instantiated for WideLanes and ScalarLanes
+ */
+template <typename Curve>
+void
+runCurve(const float32* t, float32* out, uint32 count, Curve curve)
+{
+    uint32 i = 0;
+    for (; i + WideLanes::WIDTH <= count; i += WideLanes::WIDTH)
+    {
+        curve(WideLanes::load(t + i)).store(out + i);
+    }
+    for (; i < count; ++i)
+    {
+        curve(ScalarLanes::load(t + i)).store(out + i);
+    }
+}
+}  // namespace
+
+namespace Easing
+{
+
+void
+evaluateBatch(EasingType type, const float32* t, float32* out, uint32 count)
+{
+    switch (type)
+    {
+        case EasingType::Linear:
+            std::copy_n(t, count, out);
+            return;
+        case EasingType::InQuad:
+            return runCurve(t, out, count, [](auto x) { return inPower(x, 2); });
+        case EasingType::OutQuad:
+            return runCurve(t, out, count, [](auto x) { return outPower(x, 2); });
+        case EasingType::InOutQuad:
+            return runCurve(t, out, count, [](auto x) { return inOutPower(x, 2); });
+        case EasingType::InCubic:
+            return runCurve(t, out, count, [](auto x) { return inPower(x, 3); });
+        case EasingType::OutCubic:
+            return runCurve(t, out, count, [](auto x) { return outPower(x, 3); });
+        case EasingType::InOutCubic:
+            return runCurve(t, out, count, [](auto x) { return inOutPower(x, 3); });
+        case EasingType::InQuart:
+            return runCurve(t, out, count, [](auto x) { return inPower(x, 4); });
+        case EasingType::OutQuart:
+            return runCurve(t, out, count, [](auto x) { return outPower(x, 4); });
+        case EasingType::InOutQuart:
+            return runCurve(t, out, count, [](auto x) { return inOutPower(x, 4); });
+        case EasingType::InQuint:
+            return runCurve(t, out, count, [](auto x) { return inPower(x, 5); });
+        case EasingType::OutQuint:
+            return runCurve(t, out, count, [](auto x) { return outPower(x, 5); });
+        case EasingType::InOutQuint:
+            return runCurve(t, out, count, [](auto x) { return inOutPower(x, 5); });
+        case EasingType::InSine:
+            return runCurve(t, out, count, [](auto x) { return inSine(x); });
+        case EasingType::OutSine:
+            return runCurve(t, out, count, [](auto x) { return outSine(x); });
+        case EasingType::InOutSine:
+            return runCurve(t, out, count, [](auto x) { return inOutSine(x); });
+        case EasingType::InExpo:
+            return runCurve(t, out, count, [](auto x) { return inExpo(x); });
+        case EasingType::OutExpo:
+            return runCurve(t, out, count, [](auto x) { return outExpo(x); });
+        case EasingType::InOutExpo:
+            return runCurve(t, out, count, [](auto x) { return inOutExpo(x); });
+        case EasingType::InCirc:
+            return runCurve(t, out, count, [](auto x) { return inCirc(x); });
+        case EasingType::OutCirc:
+            return runCurve(t, out, count, [](auto x) { return outCirc(x); });
+        case EasingType::InOutCirc:
+            return runCurve(t, out, count, [](auto x) { return inOutCirc(x); });
+        case EasingType::InElastic:
+            return runCurve(t, out, count, [](auto x) { return inElastic(x); });
+        case EasingType::OutElastic:
+            return runCurve(t, out, count, [](auto x) { return outElastic(x); });
+        case EasingType::InOutElastic:
+            return runCurve(t, out, count, [](auto x) { return inOutElastic(x); });
+        case EasingType::InBack:
+            return runCurve(t, out, count, [](auto x) { return inBack(x); });
+        case EasingType::OutBack:
+            return runCurve(t, out, count, [](auto x) { return outBack(x); });
+        case EasingType::InOutBack:
+            return runCurve(t, out, count, [](auto x) { return inOutBack(x); });
+        case EasingType::OutBounce:
+            return runCurve(t, out, count, [](auto x) { return outBounce(x); });
+        case EasingType::InBounce:
+            return runCurve(t, out, count, [](auto x) { return inBounce(x); });
+        case EasingType::InOutBounce:
+            return runCurve(t, out, count, [](auto x) { return inOutBounce(x); });
+        case EasingType::Count:
+            break;
+    }
+    std::copy_n(t, count, out);
+}
+
+void
+evaluateBatch(const EasingType* types, const float32* t, float32* out, uint32 count)
+{
+    uint32 runStart = 0;
+    while (runStart < count)
+    {
+        uint32 runEnd = runStart + 1;
+        while (runEnd < count && types[runEnd] == types[runStart])
+        {
+            ++runEnd;
+        }
+
+        evaluateBatch(types[runStart], t + runStart, out + runStart, runEnd - runStart);
+        runStart = runEnd;
+    }
+}
+
+void
+interpolateBatch(EasingType type, const float32* t, const float32* start, const float32* end,
+                 float32* out, uint32 count)
+{
+    evaluateBatch(type, t, out, count);
+    for (uint32 i = 0; i < count; ++i)
+    {
+        out[i] = start[i] + (end[i] - start[i]) * out[i];
+    }
+}
+
+const char*
+getBatchBackend()
+{
+#if defined(DEADCODE_EASING_AVX2)
+    return "AVX2";
+#elif defined(DEADCODE_EASING_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+}  // namespace Easing
+
+}  // namespace deadcode
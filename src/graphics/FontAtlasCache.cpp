@@ -0,0 +1,414 @@
+/**
+ * @file FontAtlasCache.cpp
+ * @brief Implementation of baked font atlas files
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-17
+ */
+
+#include "deadcode/graphics/FontAtlasCache.hpp"
+
+#include "deadcode/core/Hash.hpp"
+#include "deadcode/core/Logger.hpp"
+#include "deadcode/core/MappedFile.hpp"
+#include "deadcode/graphics/RenderBackend.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace deadcode
+{
+namespace FontAtlasCache
+{
+
+namespace
+{
+constexpr char FILE_MAGIC[4] = {'D', 'C', 'F', 'A'};
+
+constexpr int BITMAP_ATLAS_PADDING = 4;  ///< Same as LoadFontEx (FONT_TTF_DEFAULT_CHARS_PADDING)
+constexpr int BITMAP_ATLAS_PACKING = 0;  ///< GenImageFontAtlas default packing
+constexpr int SDF_ATLAS_PADDING    = 0;  ///< Distance fields already carry their own padding
+constexpr int SDF_ATLAS_PACKING    = 1;  ///< GenImageFontAtlas skyline packing
+
+struct FileHeader
+{
+    char magic[4];
+    uint32 version;
+    uint64 fontHash;
+    uint64 codepointHash;
+    uint32 fontSize;
+    uint32 atlasMode;
+    uint32 glyphCount;
+    int32 glyphPadding;
+    int32 atlasWidth;
+    int32 atlasHeight;
+    int32 atlasFormat;
+    uint32 reserved;
+};
+static_assert(sizeof(FileHeader) == 56, "FileHeader layout must not change silently");
+
+struct GlyphRecord
+{
+    int32 value;
+    int32 offsetX;
+    int32 offsetY;
+    int32 advanceX;
+    float32 recX;
+    float32 recY;
+    float32 recWidth;
+    float32 recHeight;
+};
+static_assert(sizeof(GlyphRecord) == 32, "GlyphRecord layout must not change silently");
+
+/**
+ * @brief Check a mapped cache file against the expected key
+ *
+ * @return true if the header matches and the file holds all the data it announces
+ */
+bool
+validate(const MappedFile& file, const FontAtlasKey& key, FileHeader& header)
+{
+    if (file.getSize() < sizeof(FileHeader))
+        return false;
+
+    std::memcpy(&header, file.getData(), sizeof(FileHeader));
+
+    if (std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 ||
+        header.version != FORMAT_VERSION || header.fontHash != key.fontHash ||
+        header.codepointHash != key.codepointHash || header.fontSize != key.fontSize ||
+        header.glyphCount != key.glyphCount ||
+        header.atlasMode != static_cast<uint32>(key.mode) || header.atlasWidth <= 0 ||
+        header.atlasHeight <= 0)
+    {
+        return false;
+    }
+
+    int32 pixelBytes =
+        GetPixelDataSize(header.atlasWidth, header.atlasHeight, header.atlasFormat);
+    if (pixelBytes <= 0)
+        return false;
+
+    size_t expected = sizeof(FileHeader) + header.glyphCount * sizeof(GlyphRecord) +
+                      static_cast<size_t>(pixelBytes);
+    return file.getSize() == expected;
+}
+
+/**
+ * @brief Release glyph data of a font that has no texture yet
+ */
+void
+releaseGlyphs(Font& font)
+{
+    UnloadFontData(font.glyphs, font.glyphCount);
+    MemFree(font.recs);
+    font = Font{};
+}
+
+/**
+ * @brief Upload the atlas image as the font texture
+ */
+bool
+uploadAtlas(Font& font, const Image& atlas, FontAtlasMode mode, RenderBackend& backend)
+{
+    // The SDF shader reconstructs edges from interpolated distances, so sample bilinearly
+    font.texture = backend.loadTexture(atlas, mode == FontAtlasMode::SDF);
+    return font.texture.id != 0;
+}
+}  // namespace
+
+std::vector<int32>
+getDefaultCodepoints()
+{
+    std::vector<int32> codepoints;
+    codepoints.reserve(95);
+    for (int32 c = 32; c < 127; ++c)
+    {
+        codepoints.push_back(c);
+    }
+    return codepoints;
+}
+
+String
+getCachePath(const String& fontPath, uint32 fontSize, FontAtlasMode mode)
+{
+    std::filesystem::path path(fontPath);
+    String suffix = "." + std::to_string(fontSize);
+    if (mode == FontAtlasMode::SDF)
+    {
+        suffix += ".sdf";
+    }
+    path.replace_extension(suffix + FILE_EXTENSION);
+    return path.string();
+}
+
+FontAtlasKey
+makeKey(const uint8* fontData, size_t fontDataSize, uint32 fontSize, FontAtlasMode mode,
+        const std::vector<int32>& codepoints)
+{
+    FontAtlasKey key;
+    key.fontHash      = Hash::fnv1a(fontData, fontDataSize);
+    key.codepointHash = Hash::fnv1a(codepoints.data(), codepoints.size() * sizeof(int32));
+    key.fontSize      = fontSize;
+    key.glyphCount    = static_cast<uint32>(codepoints.size());
+    key.mode          = mode;
+    return key;
+}
+
+bool
+rasterize(const uint8* fontData, size_t fontDataSize, uint32 fontSize, FontAtlasMode mode,
+          const std::vector<int32>& codepoints, Font& font, Image& atlas)
+{
+    bool sdf    = (mode == FontAtlasMode::SDF);
+    int padding = sdf ? SDF_ATLAS_PADDING : BITMAP_ATLAS_PADDING;
+
+    // LoadFontData takes a mutable codepoint array
+    std::vector<int32> requested = codepoints;
+
+    font              = Font{};
+    font.baseSize     = static_cast<int>(fontSize);
+    font.glyphCount   = static_cast<int>(requested.size());
+    font.glyphPadding = padding;
+    font.glyphs       = LoadFontData(fontData, static_cast<int>(fontDataSize), font.baseSize,
+                                     requested.data(), font.glyphCount,
+                                     sdf ? FONT_SDF : FONT_DEFAULT);
+    if (font.glyphs == nullptr)
+    {
+        font = Font{};
+        return false;
+    }
+
+    atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, padding,
+                              sdf ? SDF_ATLAS_PACKING : BITMAP_ATLAS_PACKING);
+    if (atlas.data == nullptr)
+    {
+        releaseGlyphs(font);
+        return false;
+    }
+
+    return true;
+}
+
+bool
+write(const String& cachePath, const FontAtlasKey& key, const Font& font, const Image& atlas)
+{
+    FileHeader header{};
+    std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.version       = FORMAT_VERSION;
+    header.fontHash      = key.fontHash;
+    header.codepointHash = key.codepointHash;
+    header.fontSize      = key.fontSize;
+    header.atlasMode     = static_cast<uint32>(key.mode);
+    header.glyphCount    = static_cast<uint32>(font.glyphCount);
+    header.glyphPadding  = font.glyphPadding;
+    header.atlasWidth    = atlas.width;
+    header.atlasHeight   = atlas.height;
+    header.atlasFormat   = atlas.format;
+
+    std::vector<GlyphRecord> records(header.glyphCount);
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const GlyphInfo& glyph = font.glyphs[i];
+        const Rectangle& rec   = font.recs[i];
+        records[i] = {glyph.value, glyph.offsetX, glyph.offsetY, glyph.advanceX,
+                      rec.x,       rec.y,         rec.width,     rec.height};
+    }
+
+    int32 pixelBytes = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+    String tempPath  = cachePath + ".tmp";
+
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            Logger::warn("Cannot write font atlas cache: {}", cachePath);
+            return false;
+        }
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(records.data()),
+                  static_cast<std::streamsize>(records.size() * sizeof(GlyphRecord)));
+        out.write(static_cast<const char*>(atlas.data), pixelBytes);
+
+        if (!out)
+        {
+            Logger::warn("Failed writing font atlas cache: {}", cachePath);
+            out.close();
+            std::error_code ignored;
+            std::filesystem::remove(tempPath, ignored);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, cachePath, error);
+    if (error)
+    {
+        Logger::warn("Failed to move font atlas cache into place: {} ({})", cachePath,
+                     error.message());
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+
+    Logger::debug("Font atlas cache written: {} ({}x{}, {} glyphs)", cachePath, atlas.width,
+                  atlas.height, font.glyphCount);
+    return true;
+}
+
+bool
+read(const String& cachePath, const FontAtlasKey& key, RenderBackend& backend, Font& font)
+{
+    MappedFile file;
+    if (!file.open(cachePath))
+        return false;
+
+    FileHeader header;
+    if (!validate(file, key, header))
+    {
+        Logger::debug("Font atlas cache is stale: {}", cachePath);
+        return false;
+    }
+
+    const uint8* records = file.getData() + sizeof(FileHeader);
+    const uint8* pixels  = records + header.glyphCount * sizeof(GlyphRecord);
+
+    // Allocated with Raylib's allocator so unloadFont (and UnloadFont) can free them
+    Font loaded{};
+    loaded.baseSize     = static_cast<int>(header.fontSize);
+    loaded.glyphCount   = static_cast<int>(header.glyphCount);
+    loaded.glyphPadding = header.glyphPadding;
+    loaded.glyphs =
+        static_cast<GlyphInfo*>(MemAlloc(static_cast<unsigned int>(header.glyphCount *
+                                                                   sizeof(GlyphInfo))));
+    loaded.recs =
+        static_cast<Rectangle*>(MemAlloc(static_cast<unsigned int>(header.glyphCount *
+                                                                   sizeof(Rectangle))));
+    loaded.texture = Texture2D{};
+
+    for (uint32 i = 0; i < header.glyphCount; ++i)
+    {
+        GlyphRecord record;
+        std::memcpy(&record, records + i * sizeof(GlyphRecord), sizeof(GlyphRecord));
+
+        loaded.glyphs[i].value    = record.value;
+        loaded.glyphs[i].offsetX  = record.offsetX;
+        loaded.glyphs[i].offsetY  = record.offsetY;
+        loaded.glyphs[i].advanceX = record.advanceX;
+        loaded.recs[i] = Rectangle{record.recX, record.recY, record.recWidth, record.recHeight};
+    }
+
+    // Upload straight from the mapping, the pixels are never copied on the CPU side
+    Image atlas;
+    atlas.data    = const_cast<uint8*>(pixels);
+    atlas.width   = header.atlasWidth;
+    atlas.height  = header.atlasHeight;
+    atlas.mipmaps = 1;
+    atlas.format  = header.atlasFormat;
+
+    if (!uploadAtlas(loaded, atlas, key.mode, backend))
+    {
+        releaseGlyphs(loaded);
+        return false;
+    }
+
+    font = loaded;
+    return true;
+}
+
+bool
+bake(const String& fontPath, uint32 fontSize, FontAtlasMode mode)
+{
+    MappedFile fontFile;
+    if (!fontFile.open(fontPath))
+    {
+        Logger::error("Cannot open font: {}", fontPath);
+        return false;
+    }
+
+    std::vector<int32> codepoints = getDefaultCodepoints();
+    FontAtlasKey key =
+        makeKey(fontFile.getData(), fontFile.getSize(), fontSize, mode, codepoints);
+    String cachePath = getCachePath(fontPath, fontSize, mode);
+
+    MappedFile existing;
+    FileHeader header;
+    if (existing.open(cachePath) && validate(existing, key, header))
+    {
+        Logger::info("Font atlas up to date: {}", cachePath);
+        return true;
+    }
+    existing.close();
+
+    Font font;
+    Image atlas;
+    if (!rasterize(fontFile.getData(), fontFile.getSize(), fontSize, mode, codepoints, font,
+                   atlas))
+    {
+        Logger::error("Failed to rasterize font: {}", fontPath);
+        return false;
+    }
+
+    bool written = write(cachePath, key, font, atlas);
+    UnloadImage(atlas);
+    releaseGlyphs(font);
+
+    if (written)
+    {
+        Logger::info("Font atlas baked: {}", cachePath);
+    }
+    return written;
+}
+
+Font
+loadFont(const String& fontPath, uint32 fontSize, FontAtlasMode mode, RenderBackend& backend)
+{
+    MappedFile fontFile;
+    if (!fontFile.open(fontPath))
+    {
+        Logger::error("Cannot open font: {}", fontPath);
+        return Font{};
+    }
+
+    std::vector<int32> codepoints = getDefaultCodepoints();
+    FontAtlasKey key =
+        makeKey(fontFile.getData(), fontFile.getSize(), fontSize, mode, codepoints);
+    String cachePath = getCachePath(fontPath, fontSize, mode);
+
+    Font font;
+    if (read(cachePath, key, backend, font))
+    {
+        Logger::debug("Font loaded from baked atlas: {}", cachePath);
+        return font;
+    }
+
+    Image atlas;
+    if (!rasterize(fontFile.getData(), fontFile.getSize(), fontSize, mode, codepoints, font,
+                   atlas))
+    {
+        return Font{};
+    }
+
+    // A read-only install directory only costs the cache, not the font
+    write(cachePath, key, font, atlas);
+
+    bool uploaded = uploadAtlas(font, atlas, mode, backend);
+    UnloadImage(atlas);
+
+    if (!uploaded)
+    {
+        releaseGlyphs(font);
+        return Font{};
+    }
+
+    return font;
+}
+
+void
+unloadFont(Font& font, RenderBackend& backend)
+{
+    backend.unloadTexture(font.texture);
+    releaseGlyphs(font);
+}
+
+}  // namespace FontAtlasCache
+}  // namespace deadcode
@@ -10,6 +10,7 @@
 
 #include "deadcode/core/Logger.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <random>
 
@@ -18,12 +19,15 @@ namespace deadcode
 
 GlitchEffect::GlitchEffect()
     : m_config(),
+      m_requestedConfig(),
+      m_quality(EffectQuality::High),
       m_initialized(false),
       m_isGlitching(false),
       m_glitchTimer(0.0f),
       m_idleTimer(0.0f),
       m_currentIntensity(0.0f),
       m_elapsedTime(0.0f),
+      m_renderTimeOffset(0.0f),
       m_distribution(0.0f, 1.0f),
       m_noiseSeed(0),
       m_screenWidth(1920),
@@ -34,12 +38,15 @@ GlitchEffect::GlitchEffect()
 
 GlitchEffect::GlitchEffect(const GlitchConfig& config)
     : m_config(config),
+      m_requestedConfig(config),
+      m_quality(EffectQuality::High),
       m_initialized(false),
       m_isGlitching(false),
       m_glitchTimer(0.0f),
       m_idleTimer(0.0f),
       m_currentIntensity(0.0f),
       m_elapsedTime(0.0f),
+      m_renderTimeOffset(0.0f),
       m_distribution(0.0f, 1.0f),
       m_noiseSeed(0),
       m_screenWidth(1920),
@@ -120,6 +127,48 @@ GlitchEffect::update(float32 deltaTime)
     }
 }
 
+void
+GlitchEffect::setRenderTimeOffset(float32 offset)
+{
+    m_renderTimeOffset = std::max(offset, 0.0f);
+}
+
+GlitchState
+GlitchEffect::getState() const
+{
+    GlitchState state;
+    state.glitching   = m_isGlitching;
+    state.glitchTimer = m_glitchTimer;
+    state.idleTimer   = m_idleTimer;
+    state.intensity   = m_currentIntensity;
+    state.elapsedTime = m_elapsedTime;
+    state.noiseSeed   = m_noiseSeed;
+    return state;
+}
+
+void
+GlitchEffect::setState(const GlitchState& state)
+{
+    m_isGlitching      = state.glitching;
+    m_glitchTimer      = state.glitchTimer;
+    m_idleTimer        = state.idleTimer;
+    m_currentIntensity = state.intensity;
+    m_elapsedTime      = state.elapsedTime;
+    m_noiseSeed        = state.noiseSeed;
+}
+
+float32
+GlitchEffect::getTimeUntilNextChange() const
+{
+    if (!m_initialized || !m_config.enabled)
+        return -1.0f;
+
+    if (m_isGlitching)
+        return 0.0f;
+
+    return std::max(0.0f, m_idleTimer);
+}
+
 void
 GlitchEffect::reset()
 {
@@ -128,9 +177,18 @@ GlitchEffect::reset()
     m_idleTimer        = m_config.idleTime;
     m_currentIntensity = 0.0f;
     m_elapsedTime      = 0.0f;
+    m_renderTimeOffset = 0.0f;
     m_noiseSeed        = m_distribution(m_randomEngine) * 10000;
 }
 
+void
+GlitchEffect::setRandomSeed(uint32 seed)
+{
+    m_randomEngine.seed(seed);
+    m_distribution.reset();
+    m_noiseSeed = static_cast<uint32>(m_distribution(m_randomEngine) * 10000.0f);
+}
+
 CharacterGlitchState
 GlitchEffect::getCharacterState(uint32 charIndex, uint32 characterCount) const
 {
@@ -260,13 +318,110 @@ GlitchEffect::getCharacterState(uint32 charIndex, uint32 characterCount) const
     // Scanline effect
     if (m_config.scanlines)
     {
-        state.scanlinePhase = std::fmod(m_elapsedTime * m_config.scanlineSpeed,
+        state.scanlinePhase = std::fmod(getRenderTime() * m_config.scanlineSpeed,
                                         m_config.scanlineHeight * 10.0f);
     }
 
     return state;
 }
 
+GlitchShaderParams
+GlitchEffect::getShaderParams() const
+{
+    bool glitching = m_initialized && m_config.enabled && m_isGlitching;
+
+    GlitchShaderParams params;
+    params.time        = getRenderTime();
+    params.seed        = static_cast<float32>(m_noiseSeed);
+    params.intensity   = glitching ? m_currentIntensity : 0.0f;
+    params.blockSize   = m_config.blockSize;
+    params.glitchColor = m_config.glitchColor;
+
+    if (m_config.characterDisplacement)
+    {
+        params.jitter = glm::vec2(m_config.maxJitter, m_config.verticalJitter) *
+                        m_resolutionScale;
+    }
+    if (m_config.textSlicing)
+    {
+        params.slice = glm::vec2(m_config.sliceHeight, m_config.maxSliceOffset * m_resolutionScale);
+    }
+    if (m_config.blockDisplacement)
+    {
+        params.blockOffset = m_config.maxBlockOffset * m_resolutionScale;
+    }
+    if (m_config.textDuplication)
+    {
+        // Same ranges as calculateDuplication()
+        params.duplicate = glm::vec3(m_config.duplicationChance, 5.0f * m_resolutionScale,
+                                     2.5f * m_resolutionScale);
+    }
+    if (m_config.chromaticAberration)
+    {
+        params.tint.x = m_config.chromaticIntensity;
+    }
+    if (m_config.rgbSeparation)
+    {
+        params.tint.y       = 1.0f;
+        params.channelSplit = m_config.rgbSeparationAmount * m_resolutionScale;
+    }
+    if (m_config.randomCorruption)
+    {
+        params.corruptionChance = m_config.corruptionChance;
+    }
+
+    return params;
+}
+
+void
+GlitchEffect::setConfig(const GlitchConfig& config)
+{
+    m_requestedConfig = config;
+    applyQuality();
+}
+
+void
+GlitchEffect::setQuality(EffectQuality quality)
+{
+    if (quality == m_quality)
+        return;
+
+    m_quality = quality;
+    applyQuality();
+}
+
+void
+GlitchEffect::applyQuality()
+{
+    m_config = m_requestedConfig;
+
+    // Ghost quads double the glyph count, per-glyph scanlines are pure fill
+    if (m_quality <= EffectQuality::Medium)
+    {
+        m_config.textDuplication = false;
+        m_config.scanlines       = false;
+    }
+
+    if (m_quality <= EffectQuality::Low)
+    {
+        m_config.textSlicing         = false;
+        m_config.blockDisplacement   = false;
+        m_config.chromaticAberration = false;
+    }
+
+    if (m_quality == EffectQuality::Minimal)
+    {
+        m_config.rgbSeparation    = false;
+        m_config.randomCorruption = false;
+    }
+}
+
+float32
+GlitchEffect::getRenderTime() const
+{
+    return m_elapsedTime + m_renderTimeOffset;
+}
+
 void
 GlitchEffect::triggerGlitch()
 {
@@ -308,7 +463,7 @@ GlitchEffect::generateRandomOffset() const
 }
 
 float32
-GlitchEffect::generateNoise(uint32 charIndex, uint32 seed) const
+GlitchEffect::generateNoise(uint32 charIndex, uint32 seed)
 {
     // Simple pseudo-random noise using sine waves
     uint32 n    = charIndex * 374761393 + seed * 668265263;
@@ -326,9 +481,10 @@ GlitchEffect::calculateWaveDisplacement(uint32 charIndex, uint32 characterCount)
     float32 normalizedPos = static_cast<float32>(charIndex) / static_cast<float32>(characterCount);
 
     // Multiple sine waves for complex motion
-    float32 wave1 = std::sin(m_elapsedTime * 10.0f + normalizedPos * 20.0f);
-    float32 wave2 = std::sin(m_elapsedTime * 7.3f + normalizedPos * 15.0f + 1.5f);
-    float32 wave3 = std::cos(m_elapsedTime * 13.7f - normalizedPos * 10.0f);
+    float32 time  = getRenderTime();
+    float32 wave1 = std::sin(time * 10.0f + normalizedPos * 20.0f);
+    float32 wave2 = std::sin(time * 7.3f + normalizedPos * 15.0f + 1.5f);
+    float32 wave3 = std::cos(time * 13.7f - normalizedPos * 10.0f);
 
     float32 x = (wave1 * 0.5f + wave2 * 0.3f) * m_config.maxJitter * m_resolutionScale;
     float32 y = wave3 * 0.2f * m_config.verticalJitter * m_resolutionScale;
@@ -346,7 +502,7 @@ GlitchEffect::calculateSliceDisplacement(uint32 charIndex, uint32 characterCount
 
     // Create multiple horizontal "slices" that can move independently
     // Use time-based noise to create moving slice zones
-    float32 sliceNoise = generateNoise(static_cast<uint32>(m_elapsedTime * 10.0f), m_noiseSeed);
+    float32 sliceNoise = generateNoise(static_cast<uint32>(getRenderTime() * 10.0f), m_noiseSeed);
     float32 sliceZoneCenter = sliceNoise;  // 0-1 range
 
     // Check if character is in a slice zone
@@ -0,0 +1,507 @@
+/**
+ * @file GlyphAtlas.cpp
+ * @brief Implementation of GlyphAtlas class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-18
+ */
+
+#include "deadcode/graphics/GlyphAtlas.hpp"
+
+#include "deadcode/core/Logger.hpp"
+#include "deadcode/graphics/RenderBackend.hpp"
+
+#include <algorithm>
+
+// Raylib builds its stb_truetype with STBTT_STATIC, so keep a private copy for font lookups
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <stb_truetype.h>
+
+namespace deadcode
+{
+
+namespace
+{
+constexpr int32 BYTES_PER_PIXEL = 2;      ///< Pages are GRAY_ALPHA, like Raylib font atlases
+constexpr size_t MAX_MISSING    = 4096;  ///< Bound on remembered missing codepoints
+constexpr size_t MAX_COVERAGE   = 4096;  ///< Bound on remembered covers() answers
+constexpr size_t MAX_BLANK      = 1024;  ///< Bound on resident glyphs without an image
+
+/// Parse the tables of a mapped font
+bool
+initFontInfo(const MappedFile& font, stbtt_fontinfo& info)
+{
+    if (!font.isOpen())
+        return false;
+
+    const uint8* data = font.getData();
+    int offset        = stbtt_GetFontOffsetForIndex(data, 0);
+    return offset >= 0 && stbtt_InitFont(&info, data, offset) != 0;
+}
+
+/// Whether a font's character map has a glyph for a codepoint
+bool
+fontHasCodepoint(const MappedFile& font, int32 codepoint)
+{
+    stbtt_fontinfo info;
+    return initFontInfo(font, info) && stbtt_FindGlyphIndex(&info, codepoint) != 0;
+}
+}  // namespace
+
+GlyphAtlas::GlyphAtlas(int32 pageSize, uint32 maxPages)
+    : m_backend(nullptr),
+      m_pageSize(std::max(64, pageSize)),
+      m_maxPages(std::max(1u, maxPages)),
+      m_fontSize(0),
+      m_glyphPadding(0),
+      m_mode(FontAtlasMode::Bitmap),
+      m_frame(0)
+{
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+    release();
+}
+
+void
+GlyphAtlas::setBackend(RenderBackend* backend)
+{
+    if (backend == m_backend)
+        return;
+
+    releasePages();
+    m_backend = backend;
+}
+
+bool
+GlyphAtlas::configure(const String& fontPath, uint32 fontSize, int32 glyphPadding,
+                      FontAtlasMode mode)
+{
+    // Resident glyphs were rasterized with the old parameters
+    releasePages();
+    m_missing.clear();
+    m_coverage.clear();
+    m_advances.clear();
+    m_stats = GlyphAtlasStats{};
+
+    m_fontSize     = fontSize;
+    m_glyphPadding = std::max(0, glyphPadding);
+    m_mode         = mode;
+
+    MappedFile primary;
+    if (!primary.open(fontPath))
+    {
+        Logger::warn("GlyphAtlas cannot open primary font: {}", fontPath);
+        return false;
+    }
+
+    if (m_fonts.empty())
+    {
+        m_fonts.push_back(std::move(primary));
+    }
+    else
+    {
+        m_fonts[0] = std::move(primary);
+    }
+    return true;
+}
+
+bool
+GlyphAtlas::addFallbackFont(const String& fontPath)
+{
+    MappedFile font;
+    if (!font.open(fontPath))
+    {
+        Logger::warn("GlyphAtlas cannot open fallback font: {}", fontPath);
+        return false;
+    }
+
+    // Keep slot 0 for the primary font even if configure() has not run yet
+    if (m_fonts.empty())
+    {
+        m_fonts.emplace_back();
+    }
+    m_fonts.push_back(std::move(font));
+
+    // The new font may have what the others lacked
+    m_missing.clear();
+    m_coverage.clear();
+    m_advances.clear();
+
+    Logger::debug("GlyphAtlas fallback font added: {}", fontPath);
+    return true;
+}
+
+void
+GlyphAtlas::beginFrame()
+{
+    m_frame++;
+}
+
+const AtlasGlyph*
+GlyphAtlas::acquire(int32 codepoint)
+{
+    auto it = m_glyphs.find(codepoint);
+    if (it == m_glyphs.end())
+    {
+        if (m_fontSize == 0 || !m_backend || m_missing.count(codepoint) > 0)
+            return nullptr;
+
+        if (!rasterize(codepoint))
+        {
+            if (m_missing.size() >= MAX_MISSING)
+            {
+                m_missing.clear();
+            }
+            m_missing.insert(codepoint);
+            return nullptr;
+        }
+
+        it = m_glyphs.find(codepoint);
+    }
+
+    AtlasGlyph& glyph = it->second;
+    if (glyph.rec.width > 0.0f)
+    {
+        m_pages[glyph.page].lastUsedFrame = m_frame;
+    }
+    return &glyph;
+}
+
+bool
+GlyphAtlas::covers(int32 codepoint) const
+{
+    if (m_fontSize == 0)
+        return false;
+    if (m_glyphs.count(codepoint) > 0)
+        return true;
+    if (m_missing.count(codepoint) > 0)
+        return false;
+
+    auto it = m_coverage.find(codepoint);
+    if (it != m_coverage.end())
+        return it->second;
+
+    bool found = std::any_of(m_fonts.begin(), m_fonts.end(), [codepoint](const MappedFile& font)
+                             { return fontHasCodepoint(font, codepoint); });
+
+    if (m_coverage.size() >= MAX_COVERAGE)
+    {
+        m_coverage.clear();
+    }
+    m_coverage[codepoint] = found;
+    return found;
+}
+
+bool
+GlyphAtlas::measure(int32 codepoint, float32& outAdvance) const
+{
+    auto resident = m_glyphs.find(codepoint);
+    if (resident != m_glyphs.end())
+    {
+        outAdvance = resident->second.advance;
+        return true;
+    }
+
+    auto cached = m_advances.find(codepoint);
+    if (cached != m_advances.end())
+    {
+        outAdvance = cached->second;
+        return true;
+    }
+
+    if (!covers(codepoint))
+        return false;
+
+    for (const auto& font : m_fonts)
+    {
+        stbtt_fontinfo info;
+        if (!initFontInfo(font, info) || stbtt_FindGlyphIndex(&info, codepoint) == 0)
+            continue;
+
+        // Same rounding as LoadFontData, so the advance matches the rasterized glyph
+        float32 scale = stbtt_ScaleForPixelHeight(&info, static_cast<float32>(m_fontSize));
+        int advance   = 0;
+        stbtt_GetCodepointHMetrics(&info, codepoint, &advance, nullptr);
+        advance = static_cast<int>(static_cast<float32>(advance) * scale);
+        if (advance == 0)
+        {
+            int x0 = 0;
+            int x1 = 0;
+            stbtt_GetCodepointBitmapBox(&info, codepoint, scale, scale, &x0, nullptr, &x1,
+                                        nullptr);
+            advance = x1 - x0;
+        }
+
+        if (m_advances.size() >= MAX_COVERAGE)
+        {
+            m_advances.clear();
+        }
+        outAdvance            = static_cast<float32>(advance);
+        m_advances[codepoint] = outAdvance;
+        return true;
+    }
+    return false;
+}
+
+const Texture2D&
+GlyphAtlas::getPageTexture(uint32 page) const
+{
+    return m_pages[page].texture;
+}
+
+void
+GlyphAtlas::setEvictionCallback(std::function<void()> callback)
+{
+    m_evictionCallback = std::move(callback);
+}
+
+void
+GlyphAtlas::release()
+{
+    releasePages();
+    m_missing.clear();
+    m_coverage.clear();
+    m_advances.clear();
+    m_fonts.clear();
+    m_fontSize = 0;
+}
+
+GlyphAtlasStats
+GlyphAtlas::getStats() const
+{
+    GlyphAtlasStats stats = m_stats;
+    stats.pages           = static_cast<uint32>(m_pages.size());
+    stats.glyphs          = static_cast<uint32>(m_glyphs.size());
+    return stats;
+}
+
+bool
+GlyphAtlas::rasterize(int32 codepoint)
+{
+    int type = (m_mode == FontAtlasMode::SDF) ? FONT_SDF : FONT_DEFAULT;
+
+    for (const auto& font : m_fonts)
+    {
+        if (!font.isOpen())
+            continue;
+
+        int32 requested  = codepoint;
+        GlyphInfo* info  = LoadFontData(font.getData(), static_cast<int>(font.getSize()),
+                                        static_cast<int>(m_fontSize), &requested, 1, type);
+        if (info == nullptr)
+            continue;
+
+        // Raylib leaves both empty when the font has no glyph for the codepoint
+        if (info->image.data == nullptr && info->advanceX == 0)
+        {
+            UnloadFontData(info, 1);
+            continue;
+        }
+
+        AtlasGlyph glyph{};
+        glyph.offsetX = static_cast<float32>(info->offsetX);
+        glyph.offsetY = static_cast<float32>(info->offsetY);
+        glyph.advance = static_cast<float32>(info->advanceX != 0 ? info->advanceX
+                                                                  : info->image.width);
+
+        int32 width  = info->image.width;
+        int32 height = info->image.height;
+        if (info->image.data != nullptr && width > 0 && height > 0)
+        {
+            int32 paddedWidth  = width + 2 * m_glyphPadding;
+            int32 paddedHeight = height + 2 * m_glyphPadding;
+
+            uint32 page = 0;
+            int32 x     = 0;
+            int32 y     = 0;
+            if (!allocate(paddedWidth, paddedHeight, page, x, y))
+            {
+                Logger::warn("Glyph U+{:04X} does not fit in a {}px atlas page", codepoint,
+                             m_pageSize);
+                UnloadFontData(info, 1);
+                return false;
+            }
+
+            // Expand grayscale coverage to GRAY_ALPHA, leaving the padding transparent
+            std::vector<uint8> pixels(
+                static_cast<size_t>(paddedWidth * paddedHeight * BYTES_PER_PIXEL), 0);
+            const auto* source = static_cast<const uint8*>(info->image.data);
+            for (int32 row = 0; row < height; ++row)
+            {
+                for (int32 col = 0; col < width; ++col)
+                {
+                    size_t dst = static_cast<size_t>(
+                        ((row + m_glyphPadding) * paddedWidth + col + m_glyphPadding) *
+                        BYTES_PER_PIXEL);
+                    pixels[dst]     = 255;
+                    pixels[dst + 1] = source[row * width + col];
+                }
+            }
+
+            Rectangle region = {static_cast<float32>(x), static_cast<float32>(y),
+                                static_cast<float32>(paddedWidth),
+                                static_cast<float32>(paddedHeight)};
+            m_backend->updateTexture(m_pages[page].texture, region, pixels.data());
+
+            glyph.page = page;
+            glyph.rec  = {region.x + static_cast<float32>(m_glyphPadding),
+                          region.y + static_cast<float32>(m_glyphPadding),
+                          static_cast<float32>(width), static_cast<float32>(height)};
+            m_pages[page].codepoints.push_back(codepoint);
+        }
+        else
+        {
+            // Blank glyphs live in no page, so no eviction would ever drop them
+            if (m_blankGlyphs.size() >= MAX_BLANK)
+            {
+                for (int32 blank : m_blankGlyphs)
+                {
+                    m_glyphs.erase(blank);
+                }
+                m_blankGlyphs.clear();
+            }
+            m_blankGlyphs.push_back(codepoint);
+        }
+
+        UnloadFontData(info, 1);
+
+        m_glyphs[codepoint] = glyph;
+        m_stats.rasterized++;
+        Logger::trace("GlyphAtlas rasterized U+{:04X}", codepoint);
+        return true;
+    }
+
+    return false;
+}
+
+bool
+GlyphAtlas::allocate(int32 width, int32 height, uint32& outPage, int32& outX, int32& outY)
+{
+    if (width > m_pageSize || height > m_pageSize)
+        return false;
+
+    for (uint32 i = 0; i < m_pages.size(); ++i)
+    {
+        if (placeOnPage(m_pages[i], width, height, outX, outY))
+        {
+            outPage = i;
+            return true;
+        }
+    }
+
+    if (m_pages.size() < m_maxPages)
+    {
+        addPage();
+    }
+    else
+    {
+        auto lru = std::min_element(m_pages.begin(), m_pages.end(),
+                                    [](const Page& a, const Page& b) {
+                                        return a.lastUsedFrame < b.lastUsedFrame;
+                                    });
+        recyclePage(static_cast<uint32>(lru - m_pages.begin()));
+    }
+
+    // The page just added or recycled is empty, find it again by trying them all
+    for (uint32 i = 0; i < m_pages.size(); ++i)
+    {
+        if (placeOnPage(m_pages[i], width, height, outX, outY))
+        {
+            outPage = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+GlyphAtlas::placeOnPage(Page& page, int32 width, int32 height, int32& outX, int32& outY) const
+{
+    // Start a new shelf when the current one is out of width
+    if (page.cursorX + width > m_pageSize)
+    {
+        page.shelfY += page.shelfHeight;
+        page.cursorX     = 0;
+        page.shelfHeight = 0;
+    }
+
+    if (page.shelfY + height > m_pageSize)
+        return false;
+
+    outX = page.cursorX;
+    outY = page.shelfY;
+    page.cursorX += width;
+    page.shelfHeight = std::max(page.shelfHeight, height);
+    return true;
+}
+
+void
+GlyphAtlas::addPage()
+{
+    std::vector<uint8> blank(
+        static_cast<size_t>(m_pageSize * m_pageSize * BYTES_PER_PIXEL), 0);
+
+    Image image;
+    image.data    = blank.data();
+    image.width   = m_pageSize;
+    image.height  = m_pageSize;
+    image.mipmaps = 1;
+    image.format  = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+
+    Page page;
+    page.texture       = m_backend->loadTexture(image, m_mode == FontAtlasMode::SDF);
+    page.lastUsedFrame = m_frame;
+
+    m_pages.push_back(std::move(page));
+    Logger::debug("GlyphAtlas page {} allocated ({}x{})", m_pages.size() - 1, m_pageSize,
+                  m_pageSize);
+}
+
+void
+GlyphAtlas::recyclePage(uint32 pageIndex)
+{
+    Page& page = m_pages[pageIndex];
+
+    // Quads queued this frame still sample the old contents
+    if (page.lastUsedFrame == m_frame && m_evictionCallback)
+    {
+        m_evictionCallback();
+    }
+
+    for (int32 codepoint : page.codepoints)
+    {
+        m_glyphs.erase(codepoint);
+    }
+    page.codepoints.clear();
+    page.cursorX       = 0;
+    page.shelfY        = 0;
+    page.shelfHeight   = 0;
+    page.lastUsedFrame = m_frame;
+
+    std::vector<uint8> blank(
+        static_cast<size_t>(m_pageSize * m_pageSize * BYTES_PER_PIXEL), 0);
+    m_backend->updateTexture(page.texture,
+                             Rectangle{0.0f, 0.0f, static_cast<float32>(m_pageSize),
+                                       static_cast<float32>(m_pageSize)},
+                             blank.data());
+
+    m_stats.evictions++;
+    Logger::debug("GlyphAtlas page {} recycled", pageIndex);
+}
+
+void
+GlyphAtlas::releasePages()
+{
+    for (auto& page : m_pages)
+    {
+        m_backend->unloadTexture(page.texture);
+    }
+    m_pages.clear();
+    m_glyphs.clear();
+    m_blankGlyphs.clear();
+}
+
+}  // namespace deadcode
@@ -0,0 +1,205 @@
+/**
+ * @file GlyphBatch.cpp
+ * @brief Implementation of GlyphBatch class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-14
+ */
+
+#include "deadcode/graphics/GlyphBatch.hpp"
+
+#include "deadcode/core/Logger.hpp"
+
+#include <algorithm>
+
+#include <raylib.h>
+#include <rlgl.h>
+
+namespace deadcode
+{
+
+namespace
+{
+constexpr uint32 VERTICES_PER_QUAD = 4;
+constexpr uint32 MIN_BATCH_QUADS   = 4096;
+}  // namespace
+
+struct GlyphBatch::BatchStorage
+{
+    rlRenderBatch batch{};
+    uint32 capacity{0};
+};
+
+GlyphBatch::GlyphBatch() : m_quadCount(0), m_storage(std::make_unique<BatchStorage>()) {}
+
+GlyphBatch::~GlyphBatch()
+{
+    release();
+}
+
+void
+GlyphBatch::addQuad(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                    Color color, const ::Shader& shader)
+{
+    if (texture.width <= 0 || texture.height <= 0)
+        return;
+
+    float32 texWidth  = static_cast<float32>(texture.width);
+    float32 texHeight = static_cast<float32>(texture.height);
+
+    float32 u0 = source.x / texWidth;
+    float32 v0 = source.y / texHeight;
+    float32 u1 = (source.x + source.width) / texWidth;
+    float32 v1 = (source.y + source.height) / texHeight;
+
+    float32 x0 = dest.x;
+    float32 y0 = dest.y;
+    float32 x1 = dest.x + dest.width;
+    float32 y1 = dest.y + dest.height;
+
+    // Same winding as raylib's DrawTexturePro: top-left, bottom-left, bottom-right, top-right
+    auto& vertices = getStream(texture.id, shader).vertices;
+    vertices.push_back({x0, y0, u0, v0, color});
+    vertices.push_back({x0, y1, u0, v1, color});
+    vertices.push_back({x1, y1, u1, v1, color});
+    vertices.push_back({x1, y0, u1, v0, color});
+
+    m_quadCount++;
+}
+
+GlyphBatchStats
+GlyphBatch::flush()
+{
+    GlyphBatchStats stats;
+    if (m_quadCount == 0)
+        return stats;
+
+    reserveBatch(m_quadCount);
+
+    // The shader is bound for a whole batch submission, so submit once per distinct shader
+    for (size_t first = 0; first < m_streams.size(); ++first)
+    {
+        if (m_streams[first].vertices.empty())
+            continue;
+
+        ::Shader shader = m_streams[first].shader;
+        if (shader.id != 0)
+        {
+            BeginShaderMode(shader);
+        }
+
+        // Switching batches draws whatever raylib queued before us, keeping draw order intact
+        rlSetRenderBatchActive(&m_storage->batch);
+
+        for (size_t i = first; i < m_streams.size(); ++i)
+        {
+            Stream& stream = m_streams[i];
+            if (stream.vertices.empty() || stream.shader.id != shader.id)
+                continue;
+
+            rlSetTexture(stream.textureId);
+            rlBegin(RL_QUADS);
+            for (const auto& vertex : stream.vertices)
+            {
+                rlColor4ub(vertex.color.r, vertex.color.g, vertex.color.b, vertex.color.a);
+                rlTexCoord2f(vertex.u, vertex.v);
+                rlVertex2f(vertex.x, vertex.y);
+            }
+            rlEnd();
+
+            stats.quads += static_cast<uint32>(stream.vertices.size()) / VERTICES_PER_QUAD;
+            stats.drawCalls++;
+            stream.vertices.clear();
+        }
+
+        rlSetTexture(0);
+
+        // Restoring the default batch submits ours: one draw per texture stream
+        rlSetRenderBatchActive(nullptr);
+
+        if (shader.id != 0)
+        {
+            EndShaderMode();
+        }
+    }
+
+    m_quadCount = 0;
+
+    Logger::trace("GlyphBatch flushed {} quads in {} draw calls", stats.quads, stats.drawCalls);
+    return stats;
+}
+
+void
+GlyphBatch::clear()
+{
+    for (auto& stream : m_streams)
+    {
+        stream.vertices.clear();
+    }
+    m_quadCount = 0;
+}
+
+void
+GlyphBatch::release()
+{
+    clear();
+    m_streams.clear();
+
+    if (m_storage && m_storage->capacity > 0)
+    {
+        rlUnloadRenderBatch(m_storage->batch);
+        m_storage->batch    = rlRenderBatch{};
+        m_storage->capacity = 0;
+    }
+}
+
+bool
+GlyphBatch::isEmpty() const
+{
+    return m_quadCount == 0;
+}
+
+uint32
+GlyphBatch::getQuadCount() const
+{
+    return m_quadCount;
+}
+
+GlyphBatch::Stream&
+GlyphBatch::getStream(uint32 textureId, const ::Shader& shader)
+{
+    // Only a handful of atlases are ever live, a linear scan beats hashing here
+    auto it = std::find_if(m_streams.begin(), m_streams.end(), [&](const Stream& s) {
+        return s.textureId == textureId && s.shader.id == shader.id;
+    });
+    if (it != m_streams.end())
+        return *it;
+
+    m_streams.push_back(Stream{textureId, shader, {}});
+    return m_streams.back();
+}
+
+void
+GlyphBatch::reserveBatch(uint32 quadCount)
+{
+    if (quadCount <= m_storage->capacity)
+        return;
+
+    uint32 capacity = std::max(m_storage->capacity, MIN_BATCH_QUADS);
+    while (capacity < quadCount)
+    {
+        capacity *= 2;
+    }
+
+    if (m_storage->capacity > 0)
+    {
+        rlUnloadRenderBatch(m_storage->batch);
+    }
+
+    m_storage->batch    = rlLoadRenderBatch(1, static_cast<int>(capacity));
+    m_storage->capacity = capacity;
+
+    Logger::debug("GlyphBatch capacity grown to {} quads", capacity);
+}
+
+}  // namespace deadcode
@@ -0,0 +1,259 @@
+/**
+ * @file GlyphEffectBatch.cpp
+ * @brief Implementation of GlyphEffectBatch class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-23
+ */
+
+#include "deadcode/graphics/GlyphEffectBatch.hpp"
+
+#include "deadcode/core/Logger.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+#include <raylib.h>
+#include <raymath.h>
+#include <rlgl.h>
+
+namespace deadcode
+{
+
+namespace
+{
+constexpr uint32 VERTICES_PER_QUAD = 6;  ///< Two triangles, no index buffer
+constexpr uint32 MIN_BUFFER_QUADS  = 1024;
+
+// Attribute locations, fixed with layout qualifiers in the effect shaders
+constexpr uint32 ATTRIB_POSITION   = 0;
+constexpr uint32 ATTRIB_TEXCOORD   = 1;
+constexpr uint32 ATTRIB_COLOR      = 3;
+constexpr uint32 ATTRIB_GLYPH      = 6;
+constexpr uint32 ATTRIB_GLYPH_TIME = 7;
+constexpr uint32 ATTRIB_MOTION     = 8;
+constexpr uint32 ATTRIB_DUPLICATE  = 9;
+constexpr uint32 ATTRIB_CORRUPTION = 10;
+constexpr uint32 ATTRIB_TINT       = 11;
+
+constexpr int32 STRIDE = static_cast<int32>(sizeof(GlyphEffectVertex));
+
+/// Byte offset of an effect attribute within a vertex
+constexpr int32
+attributeOffset(size_t member)
+{
+    return static_cast<int32>(offsetof(GlyphEffectVertex, attributes) + member);
+}
+}  // namespace
+
+GlyphEffectBatch::GlyphEffectBatch()
+    : m_quadCount(0),
+      m_vertexArray(0),
+      m_vertexBuffer(0),
+      m_capacity(0)
+{
+}
+
+GlyphEffectBatch::~GlyphEffectBatch()
+{
+    release();
+}
+
+void
+GlyphEffectBatch::addQuad(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                          Color color, const ::Shader& shader,
+                          const GlyphEffectAttributes& attributes)
+{
+    if (texture.width <= 0 || texture.height <= 0 || shader.id == 0)
+        return;
+
+    float32 texWidth  = static_cast<float32>(texture.width);
+    float32 texHeight = static_cast<float32>(texture.height);
+
+    float32 u0 = source.x / texWidth;
+    float32 v0 = source.y / texHeight;
+    float32 u1 = (source.x + source.width) / texWidth;
+    float32 v1 = (source.y + source.height) / texHeight;
+
+    float32 x0 = dest.x;
+    float32 y0 = dest.y;
+    float32 x1 = dest.x + dest.width;
+    float32 y1 = dest.y + dest.height;
+
+    // Same corners and winding as GlyphBatch's quads, split into two triangles
+    auto& vertices = getStream(texture.id, shader).vertices;
+    vertices.push_back({x0, y0, u0, v0, color, attributes});
+    vertices.push_back({x0, y1, u0, v1, color, attributes});
+    vertices.push_back({x1, y1, u1, v1, color, attributes});
+    vertices.push_back({x0, y0, u0, v0, color, attributes});
+    vertices.push_back({x1, y1, u1, v1, color, attributes});
+    vertices.push_back({x1, y0, u1, v0, color, attributes});
+
+    m_quadCount++;
+}
+
+GlyphBatchStats
+GlyphEffectBatch::flush()
+{
+    GlyphBatchStats stats;
+    if (m_quadCount == 0)
+        return stats;
+
+    // Whatever raylib queued before us goes first, keeping draw order intact
+    rlDrawRenderBatchActive();
+
+    m_upload.clear();
+    for (const Stream& stream : m_streams)
+    {
+        m_upload.insert(m_upload.end(), stream.vertices.begin(), stream.vertices.end());
+    }
+
+    uint32 vertexCount = static_cast<uint32>(m_upload.size());
+    reserveBuffer(vertexCount);
+
+    rlEnableVertexArray(m_vertexArray);
+    rlUpdateVertexBuffer(m_vertexBuffer, m_upload.data(),
+                         static_cast<int32>(vertexCount * sizeof(GlyphEffectVertex)), 0);
+
+    Matrix mvp      = MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection());
+    int32 atlasSlot = 0;
+
+    int32 first = 0;
+    for (Stream& stream : m_streams)
+    {
+        int32 count = static_cast<int32>(stream.vertices.size());
+        if (count == 0)
+            continue;
+
+        rlEnableShader(stream.shader.id);
+        rlSetUniformMatrix(stream.shader.locs[SHADER_LOC_MATRIX_MVP], mvp);
+        rlSetUniform(stream.shader.locs[SHADER_LOC_MAP_DIFFUSE], &atlasSlot,
+                     RL_SHADER_UNIFORM_SAMPLER2D, 1);
+
+        rlActiveTextureSlot(atlasSlot);
+        rlEnableTexture(stream.textureId);
+        rlDrawVertexArray(first, count);
+
+        first += count;
+        stats.quads += static_cast<uint32>(count) / VERTICES_PER_QUAD;
+        stats.drawCalls++;
+        stream.vertices.clear();
+    }
+
+    rlDisableTexture();
+    rlDisableVertexArray();
+    rlDisableShader();
+
+    m_quadCount = 0;
+
+    Logger::trace("GlyphEffectBatch flushed {} quads in {} draw calls", stats.quads,
+                  stats.drawCalls);
+    return stats;
+}
+
+void
+GlyphEffectBatch::clear()
+{
+    for (auto& stream : m_streams)
+    {
+        stream.vertices.clear();
+    }
+    m_quadCount = 0;
+}
+
+void
+GlyphEffectBatch::release()
+{
+    clear();
+    m_streams.clear();
+
+    if (m_capacity > 0)
+    {
+        rlUnloadVertexBuffer(m_vertexBuffer);
+        rlUnloadVertexArray(m_vertexArray);
+        m_vertexBuffer = 0;
+        m_vertexArray  = 0;
+        m_capacity     = 0;
+    }
+}
+
+bool
+GlyphEffectBatch::isEmpty() const
+{
+    return m_quadCount == 0;
+}
+
+uint32
+GlyphEffectBatch::getQuadCount() const
+{
+    return m_quadCount;
+}
+
+GlyphEffectBatch::Stream&
+GlyphEffectBatch::getStream(uint32 textureId, const ::Shader& shader)
+{
+    auto it = std::find_if(m_streams.begin(), m_streams.end(), [&](const Stream& s) {
+        return s.textureId == textureId && s.shader.id == shader.id;
+    });
+    if (it != m_streams.end())
+        return *it;
+
+    m_streams.push_back(Stream{textureId, shader, {}});
+    return m_streams.back();
+}
+
+void
+GlyphEffectBatch::reserveBuffer(uint32 vertexCount)
+{
+    if (vertexCount <= m_capacity)
+        return;
+
+    uint32 capacity = std::max(m_capacity, MIN_BUFFER_QUADS * VERTICES_PER_QUAD);
+    while (capacity < vertexCount)
+    {
+        capacity *= 2;
+    }
+
+    if (m_capacity > 0)
+    {
+        rlUnloadVertexBuffer(m_vertexBuffer);
+        rlUnloadVertexArray(m_vertexArray);
+    }
+
+    m_vertexArray = rlLoadVertexArray();
+    rlEnableVertexArray(m_vertexArray);
+    m_vertexBuffer = rlLoadVertexBuffer(
+        nullptr, static_cast<int32>(capacity * sizeof(GlyphEffectVertex)), true);
+
+    rlSetVertexAttribute(ATTRIB_POSITION, 2, RL_FLOAT, false, STRIDE,
+                         static_cast<int32>(offsetof(GlyphEffectVertex, x)));
+    rlSetVertexAttribute(ATTRIB_TEXCOORD, 2, RL_FLOAT, false, STRIDE,
+                         static_cast<int32>(offsetof(GlyphEffectVertex, u)));
+    rlSetVertexAttribute(ATTRIB_COLOR, 4, RL_UNSIGNED_BYTE, true, STRIDE,
+                         static_cast<int32>(offsetof(GlyphEffectVertex, color)));
+    rlSetVertexAttribute(ATTRIB_GLYPH, 4, RL_FLOAT, false, STRIDE,
+                         attributeOffset(offsetof(GlyphEffectAttributes, glyphIndex)));
+    rlSetVertexAttribute(ATTRIB_GLYPH_TIME, 4, RL_FLOAT, false, STRIDE,
+                         attributeOffset(offsetof(GlyphEffectAttributes, time)));
+    rlSetVertexAttribute(ATTRIB_MOTION, 4, RL_FLOAT, false, STRIDE,
+                         attributeOffset(offsetof(GlyphEffectAttributes, jitterX)));
+    rlSetVertexAttribute(ATTRIB_DUPLICATE, 4, RL_FLOAT, false, STRIDE,
+                         attributeOffset(offsetof(GlyphEffectAttributes, duplicateChance)));
+    rlSetVertexAttribute(ATTRIB_CORRUPTION, 4, RL_FLOAT, false, STRIDE,
+                         attributeOffset(offsetof(GlyphEffectAttributes, glitchR)));
+    rlSetVertexAttribute(ATTRIB_TINT, 4, RL_FLOAT, false, STRIDE,
+                         attributeOffset(offsetof(GlyphEffectAttributes, aberration)));
+    for (uint32 attribute : {ATTRIB_POSITION, ATTRIB_TEXCOORD, ATTRIB_COLOR, ATTRIB_GLYPH,
+                             ATTRIB_GLYPH_TIME, ATTRIB_MOTION, ATTRIB_DUPLICATE,
+                             ATTRIB_CORRUPTION, ATTRIB_TINT})
+    {
+        rlEnableVertexAttribute(attribute);
+    }
+
+    rlDisableVertexArray();
+    m_capacity = capacity;
+
+    Logger::debug("GlyphEffectBatch capacity grown to {} quads", capacity / VERTICES_PER_QUAD);
+}
+
+}  // namespace deadcode
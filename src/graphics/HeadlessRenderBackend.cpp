@@ -0,0 +1,394 @@
+/**
+ * @file HeadlessRenderBackend.cpp
+ * @brief Implementation of HeadlessRenderBackend class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-21
+ */
+
+#include "deadcode/graphics/HeadlessRenderBackend.hpp"
+
+#include "deadcode/core/Hash.hpp"
+#include "deadcode/core/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <fstream>
+
+namespace deadcode
+{
+
+namespace
+{
+constexpr float32 CHECKSUM_QUANTUM = 64.0f;  ///< Checksum position resolution (1/64 px)
+
+inline uint64
+quantize(float32 value)
+{
+    return static_cast<uint64>(std::lround(value * CHECKSUM_QUANTUM));
+}
+
+inline uint64
+packColor(Color color)
+{
+    return (static_cast<uint64>(color.r) << 24) | (static_cast<uint64>(color.g) << 16) |
+           (static_cast<uint64>(color.b) << 8) | static_cast<uint64>(color.a);
+}
+}  // namespace
+
+HeadlessRenderBackend::HeadlessRenderBackend()
+    : m_nextTextureId(1),
+      m_nextShaderId(1),
+      m_commandCount(0),
+      m_recording(true),
+      m_inFrame(false)
+{
+}
+
+RenderBackendType
+HeadlessRenderBackend::getType() const
+{
+    return RenderBackendType::Headless;
+}
+
+bool
+HeadlessRenderBackend::supportsRenderTargets() const
+{
+    return false;
+}
+
+Texture2D
+HeadlessRenderBackend::loadTexture(const Image& image, bool bilinear)
+{
+    (void) bilinear;
+
+    // Only the metadata matters, glyph placement reads width/height from it
+    Texture2D texture{};
+    texture.id      = m_nextTextureId++;
+    texture.width   = image.width;
+    texture.height  = image.height;
+    texture.mipmaps = image.mipmaps;
+    texture.format  = image.format;
+    return texture;
+}
+
+void
+HeadlessRenderBackend::updateTexture(const Texture2D& texture, const Rectangle& region,
+                                     const void* pixels)
+{
+    (void) texture;
+    (void) region;
+    (void) pixels;
+}
+
+void
+HeadlessRenderBackend::unloadTexture(const Texture2D& texture)
+{
+    (void) texture;
+}
+
+RenderTexture2D
+HeadlessRenderBackend::loadRenderTarget(int32 width, int32 height, bool bilinear)
+{
+    (void) bilinear;
+
+    // supportsRenderTargets() is false; hand out ids anyway so callers stay consistent
+    RenderTexture2D target{};
+    target.id             = m_nextTextureId++;
+    target.texture.id     = m_nextTextureId++;
+    target.texture.width  = width;
+    target.texture.height = height;
+    return target;
+}
+
+void
+HeadlessRenderBackend::unloadRenderTarget(const RenderTexture2D& target)
+{
+    (void) target;
+}
+
+::Shader
+HeadlessRenderBackend::loadShader(const char* vertexPath, const char* fragmentPath)
+{
+    (void) vertexPath;
+    (void) fragmentPath;
+
+    ::Shader shader{};
+    shader.id = m_nextShaderId++;
+    return shader;
+}
+
+void
+HeadlessRenderBackend::unloadShader(const ::Shader& shader)
+{
+    (void) shader;
+}
+
+void
+HeadlessRenderBackend::beginFrame(Color clearColor)
+{
+    (void) clearColor;
+
+    // A frame that was never ended still counts, so frame boundaries stay aligned
+    if (m_inFrame)
+    {
+        endFrame();
+    }
+    m_inFrame = true;
+}
+
+void
+HeadlessRenderBackend::endFrame()
+{
+    flush();
+    if (m_recording)
+    {
+        m_frameEnds.push_back(m_commands.size());
+    }
+    m_inFrame = false;
+}
+
+void
+HeadlessRenderBackend::beginRenderTarget(const RenderTexture2D& target, float32 viewWidth,
+                                         float32 viewHeight)
+{
+    // supportsRenderTargets() is false, callers draw to the screen instead
+    (void) target;
+    (void) viewWidth;
+    (void) viewHeight;
+}
+
+void
+HeadlessRenderBackend::endRenderTarget()
+{
+}
+
+void
+HeadlessRenderBackend::clearRenderTarget(Color color)
+{
+    (void) color;
+}
+
+void
+HeadlessRenderBackend::setBlendMode(RenderBlend blend)
+{
+    (void) blend;
+}
+
+void
+HeadlessRenderBackend::drawGlyph(const Texture2D& texture, const Rectangle& dest,
+                                 const Rectangle& source, Color color, const ::Shader& shader,
+                                 int32 codepoint)
+{
+    (void) source;
+
+    auto stream = std::make_pair(texture.id, shader.id);
+    if (std::find(m_pendingStreams.begin(), m_pendingStreams.end(), stream) ==
+        m_pendingStreams.end())
+    {
+        m_pendingStreams.push_back(stream);
+    }
+
+    record({RenderCommandType::Glyph, color, codepoint, texture.id, shader.id, dest.x, dest.y,
+            dest.width, dest.height});
+}
+
+void
+HeadlessRenderBackend::drawEffectGlyph(const Texture2D& texture, const Rectangle& dest,
+                                       const Rectangle& source, Color color,
+                                       const ::Shader& shader,
+                                       const GlyphEffectAttributes& attributes, int32 codepoint)
+{
+    // Displacement happens in the vertex stage, the recording shows the undisplaced quad
+    (void) attributes;
+
+    drawGlyph(texture, dest, source, color, shader, codepoint);
+}
+
+void
+HeadlessRenderBackend::drawTexture(const Texture2D& texture, const Rectangle& dest,
+                                   const Rectangle& source, Color color, RenderBlend blend)
+{
+    (void) source;
+    (void) blend;
+
+    record({RenderCommandType::Texture, color, 0, texture.id, 0, dest.x, dest.y, dest.width,
+            dest.height});
+}
+
+void
+HeadlessRenderBackend::drawShadedTexture(const Texture2D& texture, const Rectangle& dest,
+                                         const Rectangle& source, const ::Shader& shader)
+{
+    (void) source;
+
+    record({RenderCommandType::Texture, WHITE, 0, texture.id, shader.id, dest.x, dest.y,
+            dest.width, dest.height});
+}
+
+int32
+HeadlessRenderBackend::getShaderLocation(const ::Shader& shader, const char* uniformName)
+{
+    (void) shader;
+    (void) uniformName;
+    return -1;
+}
+
+void
+HeadlessRenderBackend::setShaderValue(const ::Shader& shader, int32 location, const void* value,
+                                      int32 uniformType, int32 count)
+{
+    (void) shader;
+    (void) location;
+    (void) value;
+    (void) uniformType;
+    (void) count;
+}
+
+void
+HeadlessRenderBackend::drawRectangle(const Rectangle& rect, Color color)
+{
+    record({RenderCommandType::Rectangle, color, 0, 0, 0, rect.x, rect.y, rect.width,
+            rect.height});
+}
+
+uint32
+HeadlessRenderBackend::flush()
+{
+    uint32 drawCalls = static_cast<uint32>(m_pendingStreams.size());
+    m_pendingStreams.clear();
+    return drawCalls;
+}
+
+uint32
+HeadlessRenderBackend::flushAll()
+{
+    return flush();
+}
+
+void
+HeadlessRenderBackend::setRecording(bool recording)
+{
+    m_recording = recording;
+}
+
+void
+HeadlessRenderBackend::clear()
+{
+    m_commands.clear();
+    m_frameEnds.clear();
+    m_commandCount = 0;
+}
+
+const std::vector<RenderCommand>&
+HeadlessRenderBackend::getCommands() const
+{
+    return m_commands;
+}
+
+uint32
+HeadlessRenderBackend::getFrameCount() const
+{
+    return static_cast<uint32>(m_frameEnds.size());
+}
+
+const RenderCommand*
+HeadlessRenderBackend::getFrame(uint32 frame, size_t& outCount) const
+{
+    outCount = 0;
+    if (frame >= m_frameEnds.size())
+        return nullptr;
+
+    size_t begin = frame == 0 ? 0 : m_frameEnds[frame - 1];
+    outCount     = m_frameEnds[frame] - begin;
+    return m_commands.data() + begin;
+}
+
+uint64
+HeadlessRenderBackend::getCommandCount() const
+{
+    return m_commandCount;
+}
+
+uint64
+HeadlessRenderBackend::getChecksum() const
+{
+    uint64 hash = Hash::FNV_OFFSET_BASIS;
+    for (const auto& command : m_commands)
+    {
+        hash = Hash::fnv1aMix(hash, static_cast<uint64>(command.type));
+        hash = Hash::fnv1aMix(hash, static_cast<uint64>(static_cast<uint32>(command.codepoint)));
+        hash = Hash::fnv1aMix(hash, packColor(command.color));
+        hash = Hash::fnv1aMix(hash, (static_cast<uint64>(command.textureId) << 32) |
+                                        command.shaderId);
+        hash = Hash::fnv1aMix(hash, quantize(command.x));
+        hash = Hash::fnv1aMix(hash, quantize(command.y));
+        hash = Hash::fnv1aMix(hash, quantize(command.width));
+        hash = Hash::fnv1aMix(hash, quantize(command.height));
+    }
+
+    // Frame boundaries are part of what was drawn
+    for (size_t end : m_frameEnds)
+    {
+        hash = Hash::fnv1aMix(hash, end);
+    }
+    return hash;
+}
+
+bool
+HeadlessRenderBackend::dump(const String& path) const
+{
+    std::ofstream out(path, std::ios::trunc);
+    if (!out)
+    {
+        Logger::error("Cannot write render recording: {}", path);
+        return false;
+    }
+
+    out << "# deadcode render recording v1\n";
+    for (uint32 frame = 0; frame < getFrameCount(); ++frame)
+    {
+        size_t count                  = 0;
+        const RenderCommand* commands = getFrame(frame, count);
+        out << std::format("frame {} commands {}\n", frame, count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const RenderCommand& command = commands[i];
+            if (command.type == RenderCommandType::Glyph)
+            {
+                out << std::format("G U+{:04X} tex={} shader={} ", command.codepoint,
+                                   command.textureId, command.shaderId);
+            }
+            else if (command.type == RenderCommandType::Texture)
+            {
+                out << std::format("T tex={} ", command.textureId);
+            }
+            else
+            {
+                out << "R ";
+            }
+
+            // Two decimals are stable across compilers and still catch sub-pixel drift
+            out << std::format("{:.2f} {:.2f} {:.2f} {:.2f} #{:08X}\n", command.x, command.y,
+                               command.width, command.height, packColor(command.color));
+        }
+    }
+
+    Logger::info("Render recording written: {} ({} frames, {} commands)", path, getFrameCount(),
+                 m_commands.size());
+    return static_cast<bool>(out);
+}
+
+void
+HeadlessRenderBackend::record(const RenderCommand& command)
+{
+    m_commandCount++;
+    if (m_recording)
+    {
+        m_commands.push_back(command);
+    }
+}
+
+}  // namespace deadcode
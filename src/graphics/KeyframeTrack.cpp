@@ -0,0 +1,232 @@
+/**
+ * @file KeyframeTrack.cpp
+ * @brief Implementation of KeyframeTrack for the four animated value types
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-06
+ */
+
+#include "deadcode/graphics/KeyframeTrack.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace deadcode
+{
+
+namespace
+{
+constexpr uint32 BEZIER_NEWTON_STEPS    = 8;
+constexpr uint32 BEZIER_BISECTION_STEPS = 24;
+constexpr float32 BEZIER_EPSILON        = 1.0e-6f;
+
+/// One coordinate of a cubic bezier from 0 to 1 with control points p1 and p2
+float32
+bezierCurve(float32 p1, float32 p2, float32 s)
+{
+    float32 c = 3.0f * p1;
+    float32 b = 3.0f * (p2 - p1) - c;
+    float32 a = 1.0f - c - b;
+    return ((a * s + b) * s + c) * s;
+}
+
+float32
+bezierSlope(float32 p1, float32 p2, float32 s)
+{
+    float32 c = 3.0f * p1;
+    float32 b = 3.0f * (p2 - p1) - c;
+    float32 a = 1.0f - c - b;
+    return (3.0f * a * s + 2.0f * b) * s + c;
+}
+
+/**
+ * @brief Progress along a bezier ease at a fraction of the segment's time
+ *
+ * Solves x(s) = x with Newton's method, which converges in a few steps
+ * for ordinary handles, and falls back to bisection where the curve is
+ * too flat for it.
+ */
+float32
+evaluateBezier(const glm::vec4& handles, float32 x)
+{
+    float32 x1 = std::clamp(handles.x, 0.0f, 1.0f);
+    float32 x2 = std::clamp(handles.z, 0.0f, 1.0f);
+
+    float32 s = x;
+    for (uint32 i = 0; i < BEZIER_NEWTON_STEPS; ++i)
+    {
+        float32 error = bezierCurve(x1, x2, s) - x;
+        if (std::fabs(error) < BEZIER_EPSILON)
+            return bezierCurve(handles.y, handles.w, s);
+
+        float32 slope = bezierSlope(x1, x2, s);
+        if (std::fabs(slope) < BEZIER_EPSILON)
+            break;
+        s -= error / slope;
+    }
+
+    float32 low  = 0.0f;
+    float32 high = 1.0f;
+    s            = x;
+    for (uint32 i = 0; i < BEZIER_BISECTION_STEPS; ++i)
+    {
+        float32 error = bezierCurve(x1, x2, s) - x;
+        if (std::fabs(error) < BEZIER_EPSILON)
+            break;
+        if (error > 0.0f)
+        {
+            high = s;
+        }
+        else
+        {
+            low = s;
+        }
+        s = 0.5f * (low + high);
+    }
+    return bezierCurve(handles.y, handles.w, s);
+}
+}  // namespace
+
+template <typename T>
+void
+KeyframeTrack<T>::addKey(float32 time, const T& value, KeyInterpolation interpolation)
+{
+    Keyframe<T> key;
+    key.value         = value;
+    key.interpolation = interpolation;
+    addKey(time, key);
+}
+
+template <typename T>
+void
+KeyframeTrack<T>::addKey(float32 time, const Keyframe<T>& key)
+{
+    auto position = std::upper_bound(m_times.begin(), m_times.end(), time);
+    auto index    = position - m_times.begin();
+    m_times.insert(position, time);
+    m_keys.insert(m_keys.begin() + index, key);
+}
+
+template <typename T>
+void
+KeyframeTrack<T>::computeTangents()
+{
+    size_t count = m_keys.size();
+    if (count < 2)
+        return;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t previous = i > 0 ? i - 1 : i;
+        size_t next     = i + 1 < count ? i + 1 : i;
+        float32 span    = m_times[next] - m_times[previous];
+
+        T tangent{};
+        if (span > 0.0f)
+        {
+            tangent = (m_keys[next].value - m_keys[previous].value) * (1.0f / span);
+        }
+        m_keys[i].inTangent  = tangent;
+        m_keys[i].outTangent = tangent;
+    }
+}
+
+template <typename T>
+void
+KeyframeTrack<T>::clear()
+{
+    m_times.clear();
+    m_keys.clear();
+}
+
+template <typename T>
+T
+KeyframeTrack<T>::sample(float32 time, uint32& cursor) const
+{
+    if (m_keys.empty())
+        return T{};
+
+    cursor = findSegment(time, cursor);
+
+    uint32 last = getKeyCount() - 1;
+    if (cursor == last || time <= m_times[cursor])
+        return m_keys[cursor].value;
+
+    const Keyframe<T>& from = m_keys[cursor];
+    const Keyframe<T>& to   = m_keys[cursor + 1];
+    float32 span            = m_times[cursor + 1] - m_times[cursor];
+    float32 u               = (time - m_times[cursor]) / span;
+
+    switch (from.interpolation)
+    {
+        case KeyInterpolation::Step:
+            return from.value;
+        case KeyInterpolation::Linear:
+            return from.value + (to.value - from.value) * u;
+        case KeyInterpolation::Hermite:
+        {
+            float32 u2  = u * u;
+            float32 u3  = u2 * u;
+            float32 h00 = 2.0f * u3 - 3.0f * u2 + 1.0f;
+            float32 h10 = u3 - 2.0f * u2 + u;
+            float32 h01 = -2.0f * u3 + 3.0f * u2;
+            float32 h11 = u3 - u2;
+            return from.value * h00 + from.outTangent * (h10 * span) + to.value * h01 +
+                   to.inTangent * (h11 * span);
+        }
+        case KeyInterpolation::Bezier:
+            return from.value + (to.value - from.value) * evaluateBezier(from.bezier, u);
+    }
+    return from.value;
+}
+
+template <typename T>
+uint32
+KeyframeTrack<T>::findSegment(float32 time, uint32 cursor) const
+{
+    uint32 count = getKeyCount();
+    if (count < 2 || time < m_times[1])
+        return 0;
+    if (time >= m_times[count - 1])
+        return count - 1;
+
+    // Playing forward: still in the cursor's segment, or in the next one
+    if (cursor < count - 1 && m_times[cursor] <= time)
+    {
+        if (time < m_times[cursor + 1])
+            return cursor;
+        if (cursor + 2 < count && time < m_times[cursor + 2])
+            return cursor + 1;
+    }
+
+    auto next = std::upper_bound(m_times.begin(), m_times.end(), time);
+    return static_cast<uint32>(next - m_times.begin()) - 1;
+}
+
+template <typename T>
+float32
+KeyframeTrack<T>::getDuration() const
+{
+    return m_times.empty() ? 0.0f : m_times.back();
+}
+
+template <typename T>
+uint32
+KeyframeTrack<T>::getKeyCount() const
+{
+    return static_cast<uint32>(m_keys.size());
+}
+
+template <typename T>
+bool
+KeyframeTrack<T>::isEmpty() const
+{
+    return m_keys.empty();
+}
+
+template class KeyframeTrack<float32>;
+template class KeyframeTrack<glm::vec2>;
+template class KeyframeTrack<glm::vec3>;
+template class KeyframeTrack<glm::vec4>;
+
+}  // namespace deadcode
@@ -0,0 +1,299 @@
+/**
+ * @file PostProcess.cpp
+ * @brief Implementation of PostProcessChain class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-24
+ */
+
+#include "deadcode/graphics/PostProcess.hpp"
+
+#include "deadcode/core/Logger.hpp"
+#include "deadcode/graphics/RenderBackend.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <raylib.h>
+
+namespace deadcode
+{
+
+namespace
+{
+constexpr float32 MIN_RESOLUTION_SCALE = 0.25f;
+constexpr float32 MAX_RESOLUTION_SCALE = 1.0f;
+}  // namespace
+
+PostProcessChain::PostProcessChain()
+    : m_backend(nullptr),
+      m_effectQuality(EffectQuality::High),
+      m_targets{},
+      m_screenWidth(0),
+      m_screenHeight(0),
+      m_sceneBound(false)
+{
+}
+
+PostProcessChain::~PostProcessChain()
+{
+    shutdown();
+}
+
+bool
+PostProcessChain::initialize(RenderBackend* backend, const PostProcessSettings& settings)
+{
+    if (!backend)
+    {
+        Logger::error("Cannot initialize post-process chain without a backend");
+        return false;
+    }
+
+    shutdown();
+
+    m_backend  = backend;
+    m_settings = settings;
+    setResolutionScale(settings.resolutionScale);
+
+    // Nothing to load if frames can never go through the chain
+    if (!m_backend->supportsRenderTargets())
+        return true;
+
+    for (const auto& passSettings : settings.passes)
+    {
+        Pass pass;
+        pass.settings = passSettings;
+        pass.shader   = m_backend->loadShader(nullptr, passSettings.shaderPath.c_str());
+        if (pass.shader.id == 0)
+        {
+            Logger::warn("Post-process pass '{}' skipped, shader failed to load",
+                         passSettings.name);
+            continue;
+        }
+
+        pass.resolutionLoc = m_backend->getShaderLocation(pass.shader, "resolution");
+        pass.timeLoc       = m_backend->getShaderLocation(pass.shader, "time");
+        pass.qualityLoc    = m_backend->getShaderLocation(pass.shader, "quality");
+        applyQuality(pass);
+
+        m_passes.push_back(std::move(pass));
+    }
+
+    Logger::info("Post-process chain: {} of {} passes loaded, {}% internal resolution",
+                 m_passes.size(), settings.passes.size(),
+                 static_cast<int32>(m_settings.resolutionScale * 100.0f));
+    return true;
+}
+
+void
+PostProcessChain::shutdown()
+{
+    releaseTargets();
+
+    if (m_backend)
+    {
+        for (const auto& pass : m_passes)
+        {
+            m_backend->unloadShader(pass.shader);
+        }
+    }
+    m_passes.clear();
+    m_sceneBound = false;
+}
+
+bool
+PostProcessChain::isActive() const
+{
+    return m_settings.enabled && m_backend && m_backend->supportsRenderTargets();
+}
+
+void
+PostProcessChain::setEnabled(bool enabled)
+{
+    m_settings.enabled = enabled;
+}
+
+void
+PostProcessChain::setPassEnabled(const String& name, bool enabled)
+{
+    for (auto& pass : m_passes)
+    {
+        if (pass.settings.name == name)
+        {
+            pass.settings.enabled = enabled;
+        }
+    }
+}
+
+void
+PostProcessChain::setEffectQuality(EffectQuality quality)
+{
+    m_effectQuality = quality;
+    for (auto& pass : m_passes)
+    {
+        applyQuality(pass);
+    }
+}
+
+void
+PostProcessChain::setResolutionScale(float32 scale)
+{
+    m_settings.resolutionScale = std::clamp(scale, MIN_RESOLUTION_SCALE, MAX_RESOLUTION_SCALE);
+}
+
+float32
+PostProcessChain::getResolutionScale() const
+{
+    return m_settings.resolutionScale;
+}
+
+void
+PostProcessChain::getInternalSize(int32& width, int32& height) const
+{
+    float32 scaledWidth  = static_cast<float32>(m_screenWidth) * m_settings.resolutionScale;
+    float32 scaledHeight = static_cast<float32>(m_screenHeight) * m_settings.resolutionScale;
+
+    width  = std::max(1, static_cast<int32>(std::lround(scaledWidth)));
+    height = std::max(1, static_cast<int32>(std::lround(scaledHeight)));
+}
+
+bool
+PostProcessChain::beginScene(int32 screenWidth, int32 screenHeight, Color clearColor)
+{
+    m_sceneBound = false;
+    if (!isActive() || screenWidth <= 0 || screenHeight <= 0)
+        return false;
+
+    if (!ensureTargets(screenWidth, screenHeight))
+    {
+        Logger::error("Post-process targets unavailable, drawing straight to the screen");
+        m_settings.enabled = false;
+        return false;
+    }
+
+    // Callers keep drawing in window coordinates, stretched over the smaller target
+    m_backend->beginRenderTarget(m_targets[0], static_cast<float32>(screenWidth),
+                                 static_cast<float32>(screenHeight));
+    m_backend->clearRenderTarget(clearColor);
+
+    m_sceneBound = true;
+    return true;
+}
+
+void
+PostProcessChain::endScene()
+{
+    if (!m_sceneBound)
+        return;
+
+    m_sceneBound = false;
+    m_backend->endRenderTarget();
+
+    float32 width      = static_cast<float32>(m_targets[0].texture.width);
+    float32 height     = static_cast<float32>(m_targets[0].texture.height);
+    Vector2 resolution = {width, height};
+    float32 time       = static_cast<float32>(GetTime());
+
+    // Passes and the upscale cover every pixel, nothing underneath to blend with
+    m_backend->setBlendMode(RenderBlend::Replace);
+
+    int32 source = 0;
+    for (const auto& pass : m_passes)
+    {
+        if (!pass.settings.enabled || m_effectQuality == EffectQuality::Minimal)
+            continue;
+
+        m_backend->setShaderValue(pass.shader, pass.resolutionLoc, &resolution,
+                                  SHADER_UNIFORM_VEC2, 1);
+        m_backend->setShaderValue(pass.shader, pass.timeLoc, &time, SHADER_UNIFORM_FLOAT, 1);
+
+        int32 dest = 1 - source;
+        m_backend->beginRenderTarget(m_targets[dest], width, height);
+        drawFullScreen(m_targets[source].texture, Rectangle{0.0f, 0.0f, width, height},
+                       pass.shader);
+        m_backend->endRenderTarget();
+
+        source = dest;
+    }
+
+    drawFullScreen(m_targets[source].texture,
+                   Rectangle{0.0f, 0.0f, static_cast<float32>(m_screenWidth),
+                             static_cast<float32>(m_screenHeight)},
+                   ::Shader{});
+
+    m_backend->setBlendMode(RenderBlend::Alpha);
+}
+
+bool
+PostProcessChain::ensureTargets(int32 screenWidth, int32 screenHeight)
+{
+    m_screenWidth  = screenWidth;
+    m_screenHeight = screenHeight;
+
+    int32 width  = 0;
+    int32 height = 0;
+    getInternalSize(width, height);
+
+    if (m_targets[0].id != 0 && m_targets[0].texture.width == width &&
+        m_targets[0].texture.height == height)
+        return true;
+
+    releaseTargets();
+
+    for (auto& target : m_targets)
+    {
+        // Passes sample texel centers 1:1, the filter only shows in the upscale
+        target = m_backend->loadRenderTarget(width, height, m_settings.bilinearUpscale);
+        if (target.id == 0)
+        {
+            releaseTargets();
+            return false;
+        }
+    }
+
+    Logger::debug("Post-process targets created: {}x{} for a {}x{} window", width, height,
+                  screenWidth, screenHeight);
+    return true;
+}
+
+void
+PostProcessChain::applyQuality(const Pass& pass)
+{
+    // Tiers above minimal line up with pass qualities: low, medium, high
+    int32 limit   = std::max(static_cast<int32>(m_effectQuality) - 1, 0);
+    int32 quality = std::min(static_cast<int32>(pass.settings.quality), limit);
+    m_backend->setShaderValue(pass.shader, pass.qualityLoc, &quality, SHADER_UNIFORM_INT, 1);
+}
+
+void
+PostProcessChain::releaseTargets()
+{
+    for (auto& target : m_targets)
+    {
+        if (m_backend)
+        {
+            m_backend->unloadRenderTarget(target);
+        }
+        target = RenderTexture2D{};
+    }
+}
+
+void
+PostProcessChain::drawFullScreen(const Texture2D& texture, const Rectangle& dest,
+                                 const ::Shader& shader)
+{
+    // Render textures are stored bottom-up
+    Rectangle source = {0.0f, 0.0f, static_cast<float32>(texture.width),
+                        -static_cast<float32>(texture.height)};
+    if (shader.id != 0)
+    {
+        m_backend->drawShadedTexture(texture, dest, source, shader);
+    }
+    else
+    {
+        m_backend->drawTexture(texture, dest, source, WHITE, RenderBlend::Replace);
+    }
+}
+
+}  // namespace deadcode
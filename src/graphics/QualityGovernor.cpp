@@ -0,0 +1,226 @@
+/**
+ * @file QualityGovernor.cpp
+ * @brief Implementation of QualityGovernor class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-25
+ */
+
+#include "deadcode/graphics/QualityGovernor.hpp"
+
+#include "deadcode/core/Logger.hpp"
+
+#include <algorithm>
+
+namespace deadcode
+{
+
+namespace
+{
+constexpr float32 SCALE_EPSILON      = 0.001f;
+constexpr uint32 MAX_UPGRADE_BACKOFF = 16;
+}  // namespace
+
+const char*
+toString(EffectQuality quality)
+{
+    switch (quality)
+    {
+        case EffectQuality::Minimal:
+            return "minimal";
+        case EffectQuality::Low:
+            return "low";
+        case EffectQuality::Medium:
+            return "medium";
+        case EffectQuality::High:
+            return "high";
+    }
+    return "unknown";
+}
+
+QualityGovernor::QualityGovernor()
+    : m_sampleCount(0),
+      m_sampleIndex(0),
+      m_level(0),
+      m_cooldown(0),
+      m_frame(0),
+      m_lastUpgradeFrame(0),
+      m_upgradeBlockedUntil(0),
+      m_upgradeBackoff(1)
+{
+    m_levels.push_back(QualityLevel{});
+}
+
+void
+QualityGovernor::initialize(const QualityGovernorSettings& settings)
+{
+    m_settings              = settings;
+    m_settings.sampleFrames = std::max(m_settings.sampleFrames, 1u);
+    m_settings.maxScale     = std::clamp(m_settings.maxScale, 0.25f, 1.0f);
+    m_settings.minScale     = std::clamp(m_settings.minScale, 0.25f, m_settings.maxScale);
+    m_settings.scaleStep    = std::max(m_settings.scaleStep, 0.01f);
+
+    m_frameTimes.assign(m_settings.sampleFrames, 0.0f);
+    m_workTimes.assign(m_settings.sampleFrames, 0.0f);
+    m_level               = 0;
+    m_cooldown            = 0;
+    m_frame               = 0;
+    m_lastUpgradeFrame    = 0;
+    m_upgradeBlockedUntil = 0;
+    m_upgradeBackoff      = 1;
+    resetSamples();
+    buildLevels();
+
+    if (m_settings.enabled)
+    {
+        Logger::info("Quality governor: {:.1f} ms budget, {} levels down to {}% scale",
+                     m_settings.targetFrameTime * 1000.0f, m_levels.size(),
+                     static_cast<int32>(m_levels.back().resolutionScale * 100.0f));
+    }
+}
+
+bool
+QualityGovernor::addFrame(float32 frameTime, float32 workTime)
+{
+    if (!m_settings.enabled || m_levels.size() < 2)
+        return false;
+
+    m_frame++;
+    m_frameTimes[m_sampleIndex] = frameTime;
+    m_workTimes[m_sampleIndex]  = workTime;
+    m_sampleIndex               = (m_sampleIndex + 1) % m_settings.sampleFrames;
+    m_sampleCount               = std::min(m_sampleCount + 1, m_settings.sampleFrames);
+
+    if (m_cooldown > 0)
+    {
+        m_cooldown--;
+        return false;
+    }
+    if (m_sampleCount < m_settings.sampleFrames)
+        return false;
+
+    float32 budget    = m_settings.targetFrameTime;
+    uint32 misses     = 0;
+    float32 worstTime = 0.0f;
+    float32 totalWork = 0.0f;
+    for (uint32 i = 0; i < m_sampleCount; ++i)
+    {
+        if (m_frameTimes[i] > budget * m_settings.downgradeAt)
+        {
+            misses++;
+        }
+        worstTime = std::max(worstTime, m_frameTimes[i]);
+        totalWork += m_workTimes[i];
+    }
+    float32 averageWork = totalWork / static_cast<float32>(m_sampleCount);
+
+    // A quarter of the window over budget is a trend, not a single hitch
+    if (misses * 4 > m_sampleCount && m_level + 1 < m_levels.size())
+    {
+        // Taking back a recent upgrade: that level cannot hold, wait longer before retrying
+        bool recentUpgrade = m_lastUpgradeFrame != 0 &&
+                             m_frame - m_lastUpgradeFrame <= 2 * m_settings.cooldownFrames;
+        if (recentUpgrade)
+        {
+            m_upgradeBackoff = std::min(m_upgradeBackoff * 2, MAX_UPGRADE_BACKOFF);
+        }
+        m_upgradeBlockedUntil = m_frame + uint64{m_settings.cooldownFrames} * m_upgradeBackoff;
+
+        changeLevel(m_level + 1, "over budget", worstTime);
+        return true;
+    }
+
+    if (misses == 0 && averageWork < budget * m_settings.upgradeAt && m_level > 0 &&
+        m_frame >= m_upgradeBlockedUntil)
+    {
+        m_lastUpgradeFrame = m_frame;
+        changeLevel(m_level - 1, "headroom", averageWork);
+        return true;
+    }
+
+    // An upgrade that held for a while earns back quick retries
+    if (m_lastUpgradeFrame != 0 && m_frame - m_lastUpgradeFrame > 4 * m_settings.cooldownFrames)
+    {
+        m_upgradeBackoff = 1;
+    }
+    return false;
+}
+
+void
+QualityGovernor::resetSamples()
+{
+    m_sampleCount = 0;
+    m_sampleIndex = 0;
+}
+
+const QualityLevel&
+QualityGovernor::getLevel() const
+{
+    return m_levels[m_level];
+}
+
+uint32
+QualityGovernor::getLevelIndex() const
+{
+    return m_level;
+}
+
+uint32
+QualityGovernor::getLevelCount() const
+{
+    return static_cast<uint32>(m_levels.size());
+}
+
+bool
+QualityGovernor::isEnabled() const
+{
+    return m_settings.enabled;
+}
+
+void
+QualityGovernor::buildLevels()
+{
+    m_levels.clear();
+
+    QualityLevel level{m_settings.maxScale, m_settings.maxQuality};
+    m_levels.push_back(level);
+
+    // Alternate so both per-pixel (scale) and per-glyph (effects) cost come down early
+    bool lowerEffects = true;
+    while (true)
+    {
+        bool canLowerEffects = level.effects != EffectQuality::Minimal;
+        bool canLowerScale   = level.resolutionScale > m_settings.minScale + SCALE_EPSILON;
+        if (!canLowerEffects && !canLowerScale)
+            break;
+
+        if ((lowerEffects && canLowerEffects) || !canLowerScale)
+        {
+            level.effects = static_cast<EffectQuality>(static_cast<int32>(level.effects) - 1);
+        }
+        else
+        {
+            level.resolutionScale = std::max(m_settings.minScale,
+                                             level.resolutionScale - m_settings.scaleStep);
+        }
+        lowerEffects = !lowerEffects;
+        m_levels.push_back(level);
+    }
+}
+
+void
+QualityGovernor::changeLevel(uint32 level, const char* reason, float32 measured)
+{
+    m_level    = level;
+    m_cooldown = m_settings.cooldownFrames;
+    resetSamples();
+
+    const QualityLevel& current = m_levels[m_level];
+    Logger::info("Quality governor: {} ({:.1f} ms vs {:.1f} ms budget), level {}/{}: "
+                 "{}% scale, {} effects",
+                 reason, measured * 1000.0f, m_settings.targetFrameTime * 1000.0f, m_level,
+                 m_levels.size() - 1, static_cast<int32>(current.resolutionScale * 100.0f),
+                 toString(current.effects));
+}
+
+}  // namespace deadcode
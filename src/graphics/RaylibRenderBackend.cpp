@@ -0,0 +1,388 @@
+/**
+ * @file RaylibRenderBackend.cpp
+ * @brief Implementation of RaylibRenderBackend class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-21
+ */
+
+#include "deadcode/graphics/RaylibRenderBackend.hpp"
+
+#include "deadcode/core/Logger.hpp"
+#include "deadcode/graphics/GlyphBatch.hpp"
+#include "deadcode/graphics/GlyphEffectBatch.hpp"
+#include "deadcode/graphics/Shader.hpp"
+
+#include <algorithm>
+
+#include <raylib.h>
+#include <rlgl.h>
+
+namespace deadcode
+{
+
+namespace
+{
+/// A shader location Raylib resolves by name when it loads a shader
+struct DefaultLocation
+{
+    int32 index;
+    const char* name;
+    bool attribute;  ///< Vertex attribute, otherwise a uniform
+};
+
+/// Same set as LoadShaderFromMemory()
+constexpr DefaultLocation DEFAULT_LOCATIONS[] = {
+    {SHADER_LOC_VERTEX_POSITION, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION, true},
+    {SHADER_LOC_VERTEX_TEXCOORD01, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD, true},
+    {SHADER_LOC_VERTEX_TEXCOORD02, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2, true},
+    {SHADER_LOC_VERTEX_NORMAL, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL, true},
+    {SHADER_LOC_VERTEX_TANGENT, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT, true},
+    {SHADER_LOC_VERTEX_COLOR, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR, true},
+    {SHADER_LOC_MATRIX_MVP, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP, false},
+    {SHADER_LOC_MATRIX_VIEW, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW, false},
+    {SHADER_LOC_MATRIX_PROJECTION, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION, false},
+    {SHADER_LOC_MATRIX_MODEL, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL, false},
+    {SHADER_LOC_MATRIX_NORMAL, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL, false},
+    {SHADER_LOC_COLOR_DIFFUSE, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR, false},
+    {SHADER_LOC_MAP_DIFFUSE, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0, false},
+    {SHADER_LOC_MAP_SPECULAR, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1, false},
+    {SHADER_LOC_MAP_NORMAL, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2, false},
+};
+
+/**
+ * @brief Wrap a linked program as a Raylib shader
+ *
+ * Resolves the default locations the way LoadShader() does, so Raylib's
+ * batch and UnloadShader() treat it like one of their own.
+ */
+::Shader
+adoptProgram(uint32 program)
+{
+    ::Shader shader{};
+    shader.id   = program;
+    shader.locs = static_cast<int*>(
+        MemAlloc(static_cast<unsigned int>(RL_MAX_SHADER_LOCATIONS * sizeof(int))));
+    std::fill_n(shader.locs, RL_MAX_SHADER_LOCATIONS, -1);
+
+    for (const DefaultLocation& location : DEFAULT_LOCATIONS)
+    {
+        shader.locs[location.index] = location.attribute
+                                          ? rlGetLocationAttrib(program, location.name)
+                                          : rlGetLocationUniform(program, location.name);
+    }
+    return shader;
+}
+}  // namespace
+
+RaylibRenderBackend::RaylibRenderBackend()
+    : m_glyphBatch(std::make_unique<GlyphBatch>()),
+      m_effectBatch(std::make_unique<GlyphEffectBatch>()),
+      m_blend(RenderBlend::Alpha)
+{
+}
+
+RaylibRenderBackend::~RaylibRenderBackend()
+{
+    m_glyphBatch->release();
+    m_effectBatch->release();
+}
+
+RenderBackendType
+RaylibRenderBackend::getType() const
+{
+    return RenderBackendType::Raylib;
+}
+
+bool
+RaylibRenderBackend::supportsRenderTargets() const
+{
+    return true;
+}
+
+Texture2D
+RaylibRenderBackend::loadTexture(const Image& image, bool bilinear)
+{
+    Texture2D texture = LoadTextureFromImage(image);
+    if (texture.id != 0 && bilinear)
+    {
+        SetTextureFilter(texture, TEXTURE_FILTER_BILINEAR);
+    }
+    return texture;
+}
+
+void
+RaylibRenderBackend::updateTexture(const Texture2D& texture, const Rectangle& region,
+                                   const void* pixels)
+{
+    UpdateTextureRec(texture, region, pixels);
+}
+
+void
+RaylibRenderBackend::unloadTexture(const Texture2D& texture)
+{
+    if (texture.id != 0)
+    {
+        UnloadTexture(texture);
+    }
+}
+
+RenderTexture2D
+RaylibRenderBackend::loadRenderTarget(int32 width, int32 height, bool bilinear)
+{
+    RenderTexture2D target = LoadRenderTexture(width, height);
+    if (target.id != 0)
+    {
+        SetTextureFilter(target.texture,
+                         bilinear ? TEXTURE_FILTER_BILINEAR : TEXTURE_FILTER_POINT);
+    }
+    return target;
+}
+
+void
+RaylibRenderBackend::unloadRenderTarget(const RenderTexture2D& target)
+{
+    if (target.id != 0)
+    {
+        UnloadRenderTexture(target);
+    }
+}
+
+::Shader
+RaylibRenderBackend::loadShader(const char* vertexPath, const char* fragmentPath)
+{
+    // Both stages from files: compile through the program binary cache
+    if (vertexPath && fragmentPath)
+    {
+        Shader program;
+        if (!program.loadFromFiles(vertexPath, fragmentPath))
+        {
+            Logger::error("Failed to load shader: {} / {}", vertexPath, fragmentPath);
+            return ::Shader{};
+        }
+        return adoptProgram(program.releaseProgram());
+    }
+
+    // Raylib supplies the missing stage, and hands back its default shader when compilation fails
+    ::Shader shader = LoadShader(vertexPath, fragmentPath);
+    if (!IsShaderValid(shader) || shader.id == rlGetShaderIdDefault())
+    {
+        Logger::error("Failed to load shader: {} / {}", vertexPath ? vertexPath : "default",
+                      fragmentPath ? fragmentPath : "default");
+        return ::Shader{};
+    }
+    return shader;
+}
+
+void
+RaylibRenderBackend::unloadShader(const ::Shader& shader)
+{
+    if (shader.id != 0 && shader.id != rlGetShaderIdDefault())
+    {
+        UnloadShader(shader);
+    }
+}
+
+void
+RaylibRenderBackend::beginFrame(Color clearColor)
+{
+    BeginDrawing();
+    ClearBackground(clearColor);
+}
+
+void
+RaylibRenderBackend::endFrame()
+{
+    flush();
+
+    if (!m_targets.empty())
+    {
+        Logger::warn("{} render target(s) still bound at the end of the frame", m_targets.size());
+        m_targets.clear();
+        EndTextureMode();
+    }
+
+    EndDrawing();
+}
+
+void
+RaylibRenderBackend::beginRenderTarget(const RenderTexture2D& target, float32 viewWidth,
+                                       float32 viewHeight)
+{
+    flush();
+    m_targets.push_back({target, viewWidth, viewHeight});
+    bindTarget(m_targets.back());
+}
+
+void
+RaylibRenderBackend::endRenderTarget()
+{
+    if (m_targets.empty())
+    {
+        Logger::warn("endRenderTarget() without a bound render target");
+        return;
+    }
+
+    flush();
+    m_targets.pop_back();
+
+    if (m_targets.empty())
+    {
+        EndTextureMode();
+    }
+    else
+    {
+        bindTarget(m_targets.back());
+    }
+}
+
+void
+RaylibRenderBackend::clearRenderTarget(Color color)
+{
+    flush();
+    ClearBackground(color);
+}
+
+void
+RaylibRenderBackend::setBlendMode(RenderBlend blend)
+{
+    flush();
+    m_blend = blend;
+    applyBlendMode(blend);
+}
+
+void
+RaylibRenderBackend::drawGlyph(const Texture2D& texture, const Rectangle& dest,
+                               const Rectangle& source, Color color, const ::Shader& shader,
+                               int32 codepoint)
+{
+    (void) codepoint;  // Only the headless recorder needs it
+
+    m_glyphBatch->addQuad(texture, dest, source, color, shader);
+}
+
+void
+RaylibRenderBackend::drawEffectGlyph(const Texture2D& texture, const Rectangle& dest,
+                                     const Rectangle& source, Color color, const ::Shader& shader,
+                                     const GlyphEffectAttributes& attributes, int32 codepoint)
+{
+    (void) codepoint;
+
+    m_effectBatch->addQuad(texture, dest, source, color, shader, attributes);
+}
+
+void
+RaylibRenderBackend::drawTexture(const Texture2D& texture, const Rectangle& dest,
+                                 const Rectangle& source, Color color, RenderBlend blend)
+{
+    // Queued glyphs were submitted under the current blend mode and stay under this quad
+    flush();
+
+    if (blend != m_blend)
+    {
+        applyBlendMode(blend);
+    }
+    DrawTexturePro(texture, source, dest, Vector2{0.0f, 0.0f}, 0.0f, color);
+    if (blend != m_blend)
+    {
+        applyBlendMode(m_blend);
+    }
+}
+
+void
+RaylibRenderBackend::drawShadedTexture(const Texture2D& texture, const Rectangle& dest,
+                                       const Rectangle& source, const ::Shader& shader)
+{
+    flush();
+
+    BeginShaderMode(shader);
+    DrawTexturePro(texture, source, dest, Vector2{0.0f, 0.0f}, 0.0f, WHITE);
+    EndShaderMode();
+}
+
+int32
+RaylibRenderBackend::getShaderLocation(const ::Shader& shader, const char* uniformName)
+{
+    return GetShaderLocation(shader, uniformName);
+}
+
+void
+RaylibRenderBackend::setShaderValue(const ::Shader& shader, int32 location, const void* value,
+                                    int32 uniformType, int32 count)
+{
+    if (location < 0)
+        return;
+
+    SetShaderValueV(shader, location, value, uniformType, count);
+}
+
+void
+RaylibRenderBackend::drawRectangle(const Rectangle& rect, Color color)
+{
+    DrawRectangleRec(rect, color);
+}
+
+void
+RaylibRenderBackend::bindTarget(const BoundTarget& bound)
+{
+    BeginTextureMode(bound.target);
+
+    // Raylib maps target pixels 1:1; stretch the view when it is sized differently
+    if (bound.viewWidth != static_cast<float32>(bound.target.texture.width) ||
+        bound.viewHeight != static_cast<float32>(bound.target.texture.height))
+    {
+        rlMatrixMode(RL_PROJECTION);
+        rlLoadIdentity();
+        rlOrtho(0.0, static_cast<double>(bound.viewWidth), static_cast<double>(bound.viewHeight),
+                0.0, 0.0, 1.0);
+        rlMatrixMode(RL_MODELVIEW);
+    }
+}
+
+void
+RaylibRenderBackend::applyBlendMode(RenderBlend blend)
+{
+    switch (blend)
+    {
+        case RenderBlend::Alpha:
+            BeginBlendMode(BLEND_ALPHA);
+            break;
+        case RenderBlend::Premultiplied:
+            BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+            break;
+        case RenderBlend::Premultiply:
+            // Color is premultiplied on the way in, alpha accumulates as coverage
+            rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE,
+                                      RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+            BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+            break;
+        case RenderBlend::Replace:
+            rlSetBlendFactors(RL_ONE, RL_ZERO, RL_FUNC_ADD);
+            BeginBlendMode(BLEND_CUSTOM);
+            break;
+    }
+}
+
+uint32
+RaylibRenderBackend::flush()
+{
+    uint32 drawCalls = 0;
+    if (!m_glyphBatch->isEmpty())
+    {
+        drawCalls += m_glyphBatch->flush().drawCalls;
+    }
+    if (!m_effectBatch->isEmpty())
+    {
+        drawCalls += m_effectBatch->flush().drawCalls;
+    }
+    return drawCalls;
+}
+
+uint32
+RaylibRenderBackend::flushAll()
+{
+    // Batches only ever hold quads for the bound target
+    return flush();
+}
+
+}  // namespace deadcode
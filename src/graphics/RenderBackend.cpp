@@ -0,0 +1,35 @@
+/**
+ * @file RenderBackend.cpp
+ * @brief Shared RenderBackend helpers
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-21
+ */
+
+#include "deadcode/graphics/RenderBackend.hpp"
+
+#include <algorithm>
+
+namespace deadcode
+{
+
+void
+RenderBackend::drawRectangleLines(const Rectangle& rect, float32 thickness, Color color)
+{
+    // Same layout as DrawRectangleLinesEx: full-width top/bottom, sides in between
+    thickness = std::min(thickness, std::min(rect.width, rect.height) / 2.0f);
+    if (thickness <= 0.0f)
+        return;
+
+    float32 sideHeight = rect.height - 2.0f * thickness;
+
+    drawRectangle(Rectangle{rect.x, rect.y, rect.width, thickness}, color);
+    drawRectangle(Rectangle{rect.x, rect.y + rect.height - thickness, rect.width, thickness},
+                  color);
+    drawRectangle(Rectangle{rect.x, rect.y + thickness, thickness, sideHeight}, color);
+    drawRectangle(Rectangle{rect.x + rect.width - thickness, rect.y + thickness, thickness,
+                            sideHeight},
+                  color);
+}
+
+}  // namespace deadcode
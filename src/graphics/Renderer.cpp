@@ -9,14 +9,30 @@
 #include "deadcode/graphics/Renderer.hpp"
 
 #include "deadcode/core/Logger.hpp"
+#include "deadcode/graphics/HeadlessRenderBackend.hpp"
+#include "deadcode/graphics/PostProcess.hpp"
+#include "deadcode/graphics/RaylibRenderBackend.hpp"
 #include "deadcode/graphics/Window.hpp"
 
+#include <algorithm>
+#include <chrono>
+
 #include <raylib.h>
 
 namespace deadcode
 {
 
-Renderer::Renderer() : m_window(nullptr), m_clearColor(0.0f, 0.0f, 0.0f), m_initialized(false) {}
+Renderer::Renderer()
+    : m_window(nullptr),
+      m_headlessWidth(0),
+      m_headlessHeight(0),
+      m_clearColor(0.0f, 0.0f, 0.0f),
+      m_lastPresentTime(0.0f),
+      m_initialized(false),
+      m_nextLayerId(INVALID_RENDER_LAYER + 1),
+      m_layerRedraws(0)
+{
+}
 
 Renderer::~Renderer()
 {
@@ -36,16 +52,45 @@ Renderer::initialize(Window* window)
 
     Logger::info("Initializing Renderer...");
 
-    // Initialize text renderer
+    m_backend = std::make_unique<RaylibRenderBackend>();
+    if (!initializeTextRenderer(window->getWidth(), window->getHeight()))
+        return false;
+
+    m_initialized = true;
+    Logger::info("Renderer initialized successfully");
+    return true;
+}
+
+bool
+Renderer::initializeHeadless(int32 width, int32 height)
+{
+    Logger::info("Initializing headless Renderer ({}x{})...", width, height);
+
+    m_window         = nullptr;
+    m_headlessWidth  = width;
+    m_headlessHeight = height;
+
+    m_backend = std::make_unique<HeadlessRenderBackend>();
+    if (!initializeTextRenderer(width, height))
+        return false;
+
+    m_initialized = true;
+    Logger::info("Headless Renderer initialized successfully");
+    return true;
+}
+
+bool
+Renderer::initializeTextRenderer(int32 width, int32 height)
+{
+    // Text goes through the command buffer like everything else drawn in a frame
+    m_commandBuffer = std::make_unique<DrawCommandBuffer>(m_backend.get());
+
     m_textRenderer = std::make_unique<TextRenderer>();
-    if (!m_textRenderer->initialize(window->getWidth(), window->getHeight()))
+    if (!m_textRenderer->initialize(width, height, m_commandBuffer.get()))
     {
         Logger::error("Failed to initialize TextRenderer");
         return false;
     }
-
-    m_initialized = true;
-    Logger::info("Renderer initialized successfully");
     return true;
 }
 
@@ -57,33 +102,132 @@ Renderer::shutdown()
 
     Logger::info("Shutting down Renderer...");
 
+    if (m_postProcess)
+    {
+        m_postProcess->shutdown();
+        m_postProcess.reset();
+    }
+
+    for (auto& layer : m_layers)
+    {
+        m_commandBuffer->unloadRenderTarget(layer.target);
+    }
+    m_layers.clear();
+
     if (m_textRenderer)
     {
         m_textRenderer->shutdown();
         m_textRenderer.reset();
     }
 
+    // Last, the text renderer hands its textures back to it
+    m_commandBuffer.reset();
+    m_backend.reset();
+
     m_initialized = false;
 }
 
 void
 Renderer::beginFrame()
 {
-    // Begin Raylib drawing
-    BeginDrawing();
+    if (!m_commandBuffer)
+        return;
 
-    // Clear screen with background color
+    // Begin drawing and clear screen with background color
     Color clearColor = {static_cast<uint8>(m_clearColor.r * 255.0f),
                         static_cast<uint8>(m_clearColor.g * 255.0f),
                         static_cast<uint8>(m_clearColor.b * 255.0f), 255};
-    ClearBackground(clearColor);
+    m_commandBuffer->beginFrame(clearColor);
+
+    // With post-processing on, the frame is drawn into the chain's scene target
+    if (m_postProcess)
+    {
+        int32 width  = 0;
+        int32 height = 0;
+        getScreenSize(width, height);
+        m_postProcess->beginScene(width, height, clearColor);
+    }
+
+    if (m_textRenderer)
+    {
+        m_textRenderer->beginFrame();
+    }
 }
 
 void
 Renderer::endFrame()
 {
-    // End Raylib drawing
-    EndDrawing();
+    // Execute the frame's commands, sorted by layer, texture and shader
+    if (m_textRenderer)
+    {
+        m_textRenderer->flush();
+    }
+
+    // Leaving the scene target executes its commands, then the passes run
+    if (m_postProcess)
+    {
+        m_postProcess->endScene();
+    }
+
+    if (m_commandBuffer)
+    {
+        // Submit first, so the timing below only covers presenting
+        m_commandBuffer->flush();
+
+        auto presentStart = std::chrono::steady_clock::now();
+        m_commandBuffer->endFrame();
+
+        std::chrono::duration<float32> presentTime = std::chrono::steady_clock::now() -
+                                                     presentStart;
+        m_lastPresentTime = presentTime.count();
+    }
+}
+
+void
+Renderer::setDrawLayer(int32 layer)
+{
+    if (m_commandBuffer)
+    {
+        m_commandBuffer->setDrawLayer(layer);
+    }
+}
+
+int32
+Renderer::getDrawLayer() const
+{
+    return m_commandBuffer ? m_commandBuffer->getDrawLayer() : DrawLayer::DEFAULT;
+}
+
+void
+Renderer::drawRectangle(const Rectangle& rect, Color color)
+{
+    if (m_commandBuffer)
+    {
+        m_commandBuffer->drawRectangle(rect, color);
+    }
+}
+
+void
+Renderer::drawTexture(const Texture2D& texture, const Rectangle& dest, const Rectangle& source,
+                      Color color)
+{
+    if (m_commandBuffer)
+    {
+        m_commandBuffer->drawTexture(texture, dest, source, color, RenderBlend::Alpha);
+    }
+}
+
+const DrawCommandStats&
+Renderer::getFrameStats() const
+{
+    static const DrawCommandStats EMPTY_STATS{};
+    return m_commandBuffer ? m_commandBuffer->getLastFrameStats() : EMPTY_STATS;
+}
+
+float32
+Renderer::getLastPresentTime() const
+{
+    return m_lastPresentTime;
 }
 
 void
@@ -92,10 +236,188 @@ Renderer::setClearColor(const glm::vec3& color)
     m_clearColor = color;
 }
 
+bool
+Renderer::configurePostProcess(const PostProcessSettings& settings)
+{
+    if (!m_commandBuffer)
+    {
+        Logger::error("Cannot configure post-processing before the renderer is initialized");
+        return false;
+    }
+
+    if (!m_postProcess)
+    {
+        m_postProcess = std::make_unique<PostProcessChain>();
+    }
+    return m_postProcess->initialize(m_commandBuffer.get(), settings);
+}
+
+PostProcessChain*
+Renderer::getPostProcess()
+{
+    return m_postProcess.get();
+}
+
+RenderLayerId
+Renderer::createLayer(const String& name)
+{
+    RenderLayer layer;
+    layer.id   = m_nextLayerId++;
+    layer.name = name;
+    m_layers.push_back(std::move(layer));
+
+    Logger::debug("Render layer '{}' created (id {})", name, m_layers.back().id);
+    return m_layers.back().id;
+}
+
+void
+Renderer::destroyLayer(RenderLayerId layer)
+{
+    auto it = std::find_if(m_layers.begin(), m_layers.end(),
+                           [layer](const RenderLayer& entry) { return entry.id == layer; });
+    if (it == m_layers.end())
+        return;
+
+    m_commandBuffer->unloadRenderTarget(it->target);
+    m_layers.erase(it);
+}
+
+void
+Renderer::invalidateLayer(RenderLayerId layer)
+{
+    if (RenderLayer* entry = findLayer(layer))
+    {
+        entry->valid = false;
+    }
+}
+
+void
+Renderer::invalidateLayers()
+{
+    for (auto& layer : m_layers)
+    {
+        layer.valid = false;
+    }
+}
+
+void
+Renderer::drawLayer(RenderLayerId layer, const std::function<void(TextRenderer*)>& draw)
+{
+    RenderLayer* entry = findLayer(layer);
+    if (!entry || !m_textRenderer)
+        return;
+
+    // Without render textures there is nothing to cache, draw straight through
+    if (!m_backend->supportsRenderTargets())
+    {
+        if (draw)
+        {
+            draw(m_textRenderer.get());
+        }
+        return;
+    }
+
+    int32 width  = 0;
+    int32 height = 0;
+    getScreenSize(width, height);
+    if (width <= 0 || height <= 0)
+        return;
+
+    // Layers are screen-sized so the draw function keeps using screen coordinates
+    if (entry->target.id == 0 || entry->target.texture.width != width ||
+        entry->target.texture.height != height)
+    {
+        m_commandBuffer->unloadRenderTarget(entry->target);
+        entry->target = m_commandBuffer->loadRenderTarget(width, height, false);
+        entry->valid  = false;
+    }
+
+    if (entry->fontGeneration != m_textRenderer->getFontGeneration())
+    {
+        entry->fontGeneration = m_textRenderer->getFontGeneration();
+        entry->valid          = false;
+    }
+
+    // Screen commands queued so far stay queued while the layer draws into its target
+    if (!entry->valid)
+    {
+        redrawLayer(*entry, draw);
+    }
+
+    // Render textures are stored bottom-up
+    auto targetWidth  = static_cast<float32>(entry->target.texture.width);
+    auto targetHeight = static_cast<float32>(entry->target.texture.height);
+    m_commandBuffer->drawTexture(entry->target.texture, {0.0f, 0.0f, targetWidth, targetHeight},
+                                 {0.0f, 0.0f, targetWidth, -targetHeight}, WHITE,
+                                 RenderBlend::Premultiplied);
+}
+
+uint64
+Renderer::getLayerRedrawCount() const
+{
+    return m_layerRedraws;
+}
+
+RenderBackend*
+Renderer::getBackend()
+{
+    return m_backend.get();
+}
+
 TextRenderer*
 Renderer::getTextRenderer()
 {
     return m_textRenderer.get();
 }
 
+void
+Renderer::getScreenSize(int32& width, int32& height) const
+{
+    if (m_window)
+    {
+        width  = m_window->getWidth();
+        height = m_window->getHeight();
+        return;
+    }
+
+    width  = m_headlessWidth;
+    height = m_headlessHeight;
+}
+
+Renderer::RenderLayer*
+Renderer::findLayer(RenderLayerId layer)
+{
+    for (auto& entry : m_layers)
+    {
+        if (entry.id == layer)
+            return &entry;
+    }
+    return nullptr;
+}
+
+void
+Renderer::redrawLayer(RenderLayer& layer, const std::function<void(TextRenderer*)>& draw)
+{
+    m_commandBuffer->beginRenderTarget(layer.target,
+                                       static_cast<float32>(layer.target.texture.width),
+                                       static_cast<float32>(layer.target.texture.height));
+    m_commandBuffer->clearRenderTarget(BLANK);
+
+    // Keep the target premultiplied so it composites like the screen would have blended
+    m_commandBuffer->setBlendMode(RenderBlend::Premultiply);
+
+    if (draw)
+    {
+        draw(m_textRenderer.get());
+    }
+    m_textRenderer->flush();
+
+    m_commandBuffer->setBlendMode(RenderBlend::Alpha);
+    m_commandBuffer->endRenderTarget();
+
+    layer.valid = true;
+    m_layerRedraws++;
+    Logger::debug("Render layer '{}' redrawn", layer.name);
+}
+
 }  // namespace deadcode
@@ -8,30 +8,377 @@
 
 #include "deadcode/graphics/Shader.hpp"
 
+#include "deadcode/core/Hash.hpp"
 #include "deadcode/core/Logger.hpp"
+#include "deadcode/core/MappedFile.hpp"
 
-#include <GL/glew.h>
-#include <glm/gtc/type_ptr.hpp>
-
+#include <cstring>
+#include <filesystem>
+#include <format>
 #include <fstream>
 #include <sstream>
+#include <vector>
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#include <glm/gtc/type_ptr.hpp>
+#include <raylib.h>
+#include <rlgl.h>
+
+#if defined(_WIN32)
+#define DEADCODE_GL_API __stdcall
+#else
+#define DEADCODE_GL_API
+#endif
 
 namespace deadcode
 {
 
-Shader::Shader() : m_programID(0) {}
+namespace
+{
+constexpr char FILE_MAGIC[4]         = {'D', 'C', 'S', 'P'};
+constexpr uint32 FORMAT_VERSION      = 1;
+constexpr const char* FILE_EXTENSION = ".glprogram";
+
+// GL enums used below (rlgl does not expose program binaries)
+constexpr uint32 GL_ENUM_VENDOR                     = 0x1F00;
+constexpr uint32 GL_ENUM_RENDERER                   = 0x1F01;
+constexpr uint32 GL_ENUM_VERSION                    = 0x1F02;
+constexpr uint32 GL_ENUM_LINK_STATUS                = 0x8B82;
+constexpr uint32 GL_ENUM_PROGRAM_BINARY_LENGTH      = 0x8741;
+constexpr uint32 GL_ENUM_NUM_PROGRAM_BINARY_FORMATS = 0x87FE;
+constexpr uint32 GL_ENUM_BINARY_RETRIEVABLE_HINT    = 0x8257;
+
+String s_cacheDirectory = "cache/shaders";  ///< See Shader::setBinaryCacheDirectory()
+
+struct FileHeader
+{
+    char magic[4];
+    uint32 version;
+    uint64 sourceHash;
+    uint64 driverHash;
+    uint32 binaryFormat;
+    uint32 binaryLength;
+};
+static_assert(sizeof(FileHeader) == 32, "FileHeader layout must not change silently");
 
-Shader::~Shader()
+/**
+ * @brief GL entry points for program binaries, fetched through GLFW
+ */
+struct ProgramBinaryApi
 {
-    if (m_programID != 0)
+    using GetStringFn        = const unsigned char*(DEADCODE_GL_API*)(uint32 name);
+    using GetIntegervFn      = void(DEADCODE_GL_API*)(uint32 name, int32* data);
+    using CreateProgramFn    = uint32(DEADCODE_GL_API*)();
+    using GetProgramivFn     = void(DEADCODE_GL_API*)(uint32 program, uint32 name, int32* params);
+    using GetProgramBinaryFn = void(DEADCODE_GL_API*)(uint32 program, int32 bufferSize,
+                                                      int32* length, uint32* format,
+                                                      void* binary);
+    using ProgramBinaryFn    = void(DEADCODE_GL_API*)(uint32 program, uint32 format,
+                                                      const void* binary, int32 length);
+    using UniformMatrix3fvFn = void(DEADCODE_GL_API*)(int32 location, int32 count,
+                                                      uint8 transpose, const float32* value);
+
+    // Relinking with the binary retrievable hint
+    using ProgramParameteriFn = void(DEADCODE_GL_API*)(uint32 program, uint32 name, int32 value);
+    using LinkProgramFn       = void(DEADCODE_GL_API*)(uint32 program);
+    using DetachShaderFn      = void(DEADCODE_GL_API*)(uint32 program, uint32 shader);
+    using DeleteShaderFn      = void(DEADCODE_GL_API*)(uint32 shader);
+
+    GetStringFn getString{nullptr};
+    GetIntegervFn getIntegerv{nullptr};
+    CreateProgramFn createProgram{nullptr};
+    GetProgramivFn getProgramiv{nullptr};
+    GetProgramBinaryFn getProgramBinary{nullptr};
+    ProgramBinaryFn programBinary{nullptr};
+    UniformMatrix3fvFn uniformMatrix3fv{nullptr};
+    ProgramParameteriFn programParameteri{nullptr};
+    LinkProgramFn linkProgram{nullptr};
+    DetachShaderFn detachShader{nullptr};
+    DeleteShaderFn deleteShader{nullptr};
+
+    bool binariesSupported{false};
+    uint64 driverHash{0};  ///< Vendor, renderer and version; binaries are only valid for one
+};
+
+template <typename Fn>
+Fn
+loadProc(const char* name)
+{
+    return reinterpret_cast<Fn>(glfwGetProcAddress(name));
+}
+
+/**
+ * @brief Fetch the entry points once (needs a current GL context)
+ */
+const ProgramBinaryApi&
+getApi()
+{
+    static ProgramBinaryApi api = []() {
+        ProgramBinaryApi result;
+        result.getString     = loadProc<ProgramBinaryApi::GetStringFn>("glGetString");
+        result.getIntegerv   = loadProc<ProgramBinaryApi::GetIntegervFn>("glGetIntegerv");
+        result.createProgram = loadProc<ProgramBinaryApi::CreateProgramFn>("glCreateProgram");
+        result.getProgramiv  = loadProc<ProgramBinaryApi::GetProgramivFn>("glGetProgramiv");
+        result.getProgramBinary =
+            loadProc<ProgramBinaryApi::GetProgramBinaryFn>("glGetProgramBinary");
+        result.programBinary = loadProc<ProgramBinaryApi::ProgramBinaryFn>("glProgramBinary");
+        result.uniformMatrix3fv =
+            loadProc<ProgramBinaryApi::UniformMatrix3fvFn>("glUniformMatrix3fv");
+        result.programParameteri =
+            loadProc<ProgramBinaryApi::ProgramParameteriFn>("glProgramParameteri");
+        result.linkProgram  = loadProc<ProgramBinaryApi::LinkProgramFn>("glLinkProgram");
+        result.detachShader = loadProc<ProgramBinaryApi::DetachShaderFn>("glDetachShader");
+        result.deleteShader = loadProc<ProgramBinaryApi::DeleteShaderFn>("glDeleteShader");
+
+        if (result.getString && result.getIntegerv && result.createProgram &&
+            result.getProgramiv && result.getProgramBinary && result.programBinary &&
+            result.programParameteri && result.linkProgram)
+        {
+            // GL 4.1 / ARB_get_program_binary may still offer zero formats (some drivers)
+            int32 formats = 0;
+            result.getIntegerv(GL_ENUM_NUM_PROGRAM_BINARY_FORMATS, &formats);
+            result.binariesSupported = formats > 0;
+
+            uint64 hash = Hash::FNV_OFFSET_BASIS;
+            for (uint32 name : {GL_ENUM_VENDOR, GL_ENUM_RENDERER, GL_ENUM_VERSION})
+            {
+                const unsigned char* value = result.getString(name);
+                if (value)
+                {
+                    hash = Hash::fnv1aText(reinterpret_cast<const char*>(value), hash);
+                }
+            }
+            result.driverHash = hash;
+        }
+
+        Logger::debug("Shader program binaries {}",
+                      result.binariesSupported ? "supported" : "unsupported");
+        return result;
+    }();
+    return api;
+}
+
+String
+getCachePath(uint64 sourceHash)
+{
+    std::filesystem::path path(s_cacheDirectory);
+    path /= std::format("{:016x}{}", sourceHash, FILE_EXTENSION);
+    return path.string();
+}
+
+/**
+ * @brief Create a program from a cached binary
+ *
+ * @return Program ID, or 0 if there is no valid binary (missing, stale or rejected)
+ */
+uint32
+loadCachedProgram(uint64 sourceHash)
+{
+    const ProgramBinaryApi& api = getApi();
+    if (!api.binariesSupported || s_cacheDirectory.empty())
+        return 0;
+
+    MappedFile file;
+    if (!file.open(getCachePath(sourceHash)) || file.getSize() < sizeof(FileHeader))
+        return 0;
+
+    FileHeader header;
+    std::memcpy(&header, file.getData(), sizeof(FileHeader));
+    if (std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 ||
+        header.version != FORMAT_VERSION || header.sourceHash != sourceHash ||
+        header.driverHash != api.driverHash ||
+        file.getSize() != sizeof(FileHeader) + header.binaryLength)
+    {
+        return 0;
+    }
+
+    uint32 program = api.createProgram();
+    api.programBinary(program, header.binaryFormat, file.getData() + sizeof(FileHeader),
+                      static_cast<int32>(header.binaryLength));
+
+    // Drivers reject binaries after updates even when the strings match
+    int32 linked = 0;
+    api.getProgramiv(program, GL_ENUM_LINK_STATUS, &linked);
+    if (!linked)
+    {
+        rlUnloadShaderProgram(program);
+        return 0;
+    }
+
+    return program;
+}
+
+/**
+ * @brief Store the binary of a linked program
+ */
+bool
+saveProgramBinary(uint32 program, uint64 sourceHash)
+{
+    const ProgramBinaryApi& api = getApi();
+    if (!api.binariesSupported || s_cacheDirectory.empty())
+        return false;
+
+    int32 length = 0;
+    api.getProgramiv(program, GL_ENUM_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+    {
+        // Drivers may decline even with the retrievable hint set, say so once
+        static bool logged = false;
+        if (!logged)
+        {
+            Logger::info("Driver returned no shader program binary, programs are not cached");
+            logged = true;
+        }
+        return false;
+    }
+
+    std::vector<uint8> binary(static_cast<size_t>(length));
+    FileHeader header{};
+    int32 written = 0;
+    api.getProgramBinary(program, length, &written, &header.binaryFormat, binary.data());
+    if (written <= 0)
+        return false;
+
+    std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.version      = FORMAT_VERSION;
+    header.sourceHash   = sourceHash;
+    header.driverHash   = api.driverHash;
+    header.binaryLength = static_cast<uint32>(written);
+
+    std::error_code error;
+    std::filesystem::create_directories(s_cacheDirectory, error);
+
+    String cachePath = getCachePath(sourceHash);
+    String tempPath  = cachePath + ".tmp";
+
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            Logger::warn("Cannot write shader program cache: {}", cachePath);
+            return false;
+        }
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(binary.data()), written);
+
+        if (!out)
+        {
+            Logger::warn("Failed writing shader program cache: {}", cachePath);
+            out.close();
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath, cachePath, error);
+    if (error)
+    {
+        Logger::warn("Failed to move shader program cache into place: {} ({})", cachePath,
+                     error.message());
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+
+    Logger::debug("Shader program cache written: {} ({} bytes)", cachePath, written);
+    return true;
+}
+
+/**
+ * @brief Link a program again with its binary marked retrievable
+ *
+ * The hint only takes effect at the next link, and rlgl links before a
+ * caller could set it, so without this the binary length may be 0.
+ *
+ * @return true if the program is still linked
+ */
+bool
+relinkRetrievable(uint32 program)
+{
+    const ProgramBinaryApi& api = getApi();
+    api.programParameteri(program, GL_ENUM_BINARY_RETRIEVABLE_HINT, 1);
+    api.linkProgram(program);
+
+    int32 linked = 0;
+    api.getProgramiv(program, GL_ENUM_LINK_STATUS, &linked);
+    return linked != 0;
+}
+
+/**
+ * @brief Compile and link a program through rlgl
+ *
+ * @return Program ID or 0 on failure
+ */
+uint32
+compileProgram(const String& vertexSource, const String& fragmentSource)
+{
+    const ProgramBinaryApi& api = getApi();
+
+    // rlLoadShaderCode() detaches the stages after linking, which rules out the relink below
+    uint32 vertexShader   = rlCompileShader(vertexSource.c_str(), RL_VERTEX_SHADER);
+    uint32 fragmentShader = rlCompileShader(fragmentSource.c_str(), RL_FRAGMENT_SHADER);
+
+    // Binds Raylib's attribute names and links, the stages stay attached
+    uint32 program = 0;
+    if (vertexShader != 0 && fragmentShader != 0)
+    {
+        program = rlLoadShaderProgram(vertexShader, fragmentShader);
+    }
+
+    if (program != 0 && api.binariesSupported && !s_cacheDirectory.empty() &&
+        !relinkRetrievable(program))
+    {
+        rlUnloadShaderProgram(program);
+        program = 0;
+    }
+
+    for (uint32 stage : {vertexShader, fragmentShader})
+    {
+        if (stage == 0 || !api.deleteShader)
+            continue;
+        if (program != 0 && api.detachShader)
+        {
+            api.detachShader(program, stage);
+        }
+        api.deleteShader(stage);
+    }
+
+    if (program == 0)
     {
-        glDeleteProgram(m_programID);
+        Logger::error("Shader program compilation failed (see the rlgl log for details)");
+        return 0;
     }
+
+    return program;
+}
+
+/**
+ * @brief Convert a glm matrix to Raylib's (both column-major)
+ */
+Matrix
+toRaylib(const glm::mat4& value)
+{
+    const float32* m = glm::value_ptr(value);
+    return Matrix{m[0], m[4], m[8],  m[12], m[1], m[5], m[9],  m[13],
+                  m[2], m[6], m[10], m[14], m[3], m[7], m[11], m[15]};
+}
+}  // namespace
+
+Shader::Shader() : m_programID(0), m_loadedFromCache(false) {}
+
+Shader::~Shader()
+{
+    release();
 }
 
-Shader::Shader(Shader&& other) noexcept : m_programID(other.m_programID)
+Shader::Shader(Shader&& other) noexcept
+    : m_programID(other.m_programID),
+      m_loadedFromCache(other.m_loadedFromCache),
+      m_uniformLocations(std::move(other.m_uniformLocations))
 {
     other.m_programID = 0;
+    other.m_uniformLocations.clear();
 }
 
 Shader&
@@ -39,12 +386,12 @@ Shader::operator=(Shader&& other) noexcept
 {
     if (this != &other)
     {
-        if (m_programID != 0)
-        {
-            glDeleteProgram(m_programID);
-        }
-        m_programID       = other.m_programID;
-        other.m_programID = 0;
+        release();
+        m_programID        = other.m_programID;
+        m_loadedFromCache  = other.m_loadedFromCache;
+        m_uniformLocations = std::move(other.m_uniformLocations);
+        other.m_programID  = 0;
+        other.m_uniformLocations.clear();
     }
     return *this;
 }
@@ -82,28 +429,28 @@ Shader::loadFromFiles(const String& vertexPath, const String& fragmentPath)
 bool
 Shader::loadFromSource(const String& vertexSource, const String& fragmentSource)
 {
-    // Compile shaders
-    uint32 vertexShader = compileShader(vertexSource, GL_VERTEX_SHADER);
-    if (vertexShader == 0)
-    {
-        return false;
-    }
+    release();
+
+    // Both stages are part of the key, a zero byte keeps "ab"+"c" apart from "a"+"bc"
+    uint64 sourceHash = Hash::fnv1aText(vertexSource);
+    sourceHash        = Hash::fnv1aMix(sourceHash, 0);
+    sourceHash        = Hash::fnv1aText(fragmentSource, sourceHash);
 
-    uint32 fragmentShader = compileShader(fragmentSource, GL_FRAGMENT_SHADER);
-    if (fragmentShader == 0)
+    m_programID = loadCachedProgram(sourceHash);
+    if (m_programID != 0)
     {
-        glDeleteShader(vertexShader);
-        return false;
+        m_loadedFromCache = true;
+        Logger::debug("Shader program {} loaded from binary cache ({:016x})", m_programID,
+                      sourceHash);
+        return true;
     }
 
-    // Link program
-    m_programID = linkProgram(vertexShader, fragmentShader);
-
-    // Clean up shaders (they're linked into the program now)
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+    m_programID = compileProgram(vertexSource, fragmentSource);
+    if (m_programID == 0)
+        return false;
 
-    return m_programID != 0;
+    saveProgramBinary(m_programID, sourceHash);
+    return true;
 }
 
 void
@@ -111,7 +458,7 @@ Shader::use() const
 {
     if (m_programID != 0)
     {
-        glUseProgram(m_programID);
+        rlEnableShader(m_programID);
     }
 }
 
@@ -127,99 +474,98 @@ Shader::isValid() const
     return m_programID != 0;
 }
 
-void
-Shader::setInt(const String& name, int32 value) const
+bool
+Shader::isLoadedFromCache() const
 {
-    glUniform1i(getUniformLocation(name), value);
+    return m_loadedFromCache;
 }
 
-void
-Shader::setFloat(const String& name, float32 value) const
+uint32
+Shader::releaseProgram()
+{
+    uint32 program = m_programID;
+    m_programID    = 0;
+    release();
+    return program;
+}
+
+int32
+Shader::getUniformLocation(UniformId uniform) const
 {
-    glUniform1f(getUniformLocation(name), value);
+    auto it = m_uniformLocations.find(uniform.getHash());
+    if (it != m_uniformLocations.end())
+        return it->second;
+
+    // Missing uniforms are cached too (-1), so they cost one GL query in total
+    int32 location = (m_programID != 0) ? rlGetLocationUniform(m_programID, uniform.getName())
+                                        : -1;
+    m_uniformLocations.emplace(uniform.getHash(), location);
+    return location;
 }
 
 void
-Shader::setVec2(const String& name, const glm::vec2& value) const
+Shader::setInt(UniformId uniform, int32 value) const
 {
-    glUniform2fv(getUniformLocation(name), 1, glm::value_ptr(value));
+    rlSetUniform(getUniformLocation(uniform), &value, RL_SHADER_UNIFORM_INT, 1);
 }
 
 void
-Shader::setVec3(const String& name, const glm::vec3& value) const
+Shader::setFloat(UniformId uniform, float32 value) const
 {
-    glUniform3fv(getUniformLocation(name), 1, glm::value_ptr(value));
+    rlSetUniform(getUniformLocation(uniform), &value, RL_SHADER_UNIFORM_FLOAT, 1);
 }
 
 void
-Shader::setVec4(const String& name, const glm::vec4& value) const
+Shader::setVec2(UniformId uniform, const glm::vec2& value) const
 {
-    glUniform4fv(getUniformLocation(name), 1, glm::value_ptr(value));
+    rlSetUniform(getUniformLocation(uniform), glm::value_ptr(value), RL_SHADER_UNIFORM_VEC2, 1);
 }
 
 void
-Shader::setMat3(const String& name, const glm::mat3& value) const
+Shader::setVec3(UniformId uniform, const glm::vec3& value) const
 {
-    glUniformMatrix3fv(getUniformLocation(name), 1, GL_FALSE, glm::value_ptr(value));
+    rlSetUniform(getUniformLocation(uniform), glm::value_ptr(value), RL_SHADER_UNIFORM_VEC3, 1);
 }
 
 void
-Shader::setMat4(const String& name, const glm::mat4& value) const
+Shader::setVec4(UniformId uniform, const glm::vec4& value) const
 {
-    glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, glm::value_ptr(value));
+    rlSetUniform(getUniformLocation(uniform), glm::value_ptr(value), RL_SHADER_UNIFORM_VEC4, 1);
 }
 
-uint32
-Shader::compileShader(const String& source, uint32 type)
-{
-    uint32 shader   = glCreateShader(type);
-    const char* src = source.c_str();
-    glShaderSource(shader, 1, &src, nullptr);
-    glCompileShader(shader);
-
-    // Check compilation status
-    int32 success;
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        char infoLog[512];
-        glGetShaderInfoLog(shader, 512, nullptr, infoLog);
-        const char* shaderType = (type == GL_VERTEX_SHADER) ? "VERTEX" : "FRAGMENT";
-        Logger::error("Shader compilation failed ({}): {}", shaderType, infoLog);
-        glDeleteShader(shader);
-        return 0;
+void
+Shader::setMat3(UniformId uniform, const glm::mat3& value) const
+{
+    // rlgl only has 4x4 matrix uniforms
+    const ProgramBinaryApi& api = getApi();
+    if (api.uniformMatrix3fv)
+    {
+        api.uniformMatrix3fv(getUniformLocation(uniform), 1, 0, glm::value_ptr(value));
     }
-
-    return shader;
 }
 
-uint32
-Shader::linkProgram(uint32 vertexShader, uint32 fragmentShader)
-{
-    uint32 program = glCreateProgram();
-    glAttachShader(program, vertexShader);
-    glAttachShader(program, fragmentShader);
-    glLinkProgram(program);
-
-    // Check linking status
-    int32 success;
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
-    if (!success)
-    {
-        char infoLog[512];
-        glGetProgramInfoLog(program, 512, nullptr, infoLog);
-        Logger::error("Shader program linking failed: {}", infoLog);
-        glDeleteProgram(program);
-        return 0;
-    }
+void
+Shader::setMat4(UniformId uniform, const glm::mat4& value) const
+{
+    rlSetUniformMatrix(getUniformLocation(uniform), toRaylib(value));
+}
 
-    return program;
+void
+Shader::setBinaryCacheDirectory(const String& directory)
+{
+    s_cacheDirectory = directory;
 }
 
-int32
-Shader::getUniformLocation(const String& name) const
+void
+Shader::release()
 {
-    return glGetUniformLocation(m_programID, name.c_str());
+    if (m_programID != 0)
+    {
+        rlUnloadShaderProgram(m_programID);
+        m_programID = 0;
+    }
+    m_loadedFromCache = false;
+    m_uniformLocations.clear();
 }
 
 }  // namespace deadcode
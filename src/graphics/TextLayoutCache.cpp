@@ -0,0 +1,113 @@
+/**
+ * @file TextLayoutCache.cpp
+ * @brief Implementation of TextLayoutCache class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-15
+ */
+
+#include "deadcode/graphics/TextLayoutCache.hpp"
+
+#include "deadcode/core/Hash.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace deadcode
+{
+
+TextLayoutCache::TextLayoutCache(uint32 capacity) : m_capacity(std::max(1u, capacity)) {}
+
+const TextLayout*
+TextLayoutCache::find(const String& text, float32 scale, uint32 fontGeneration)
+{
+    uint64 key = hashKey(text, scale, fontGeneration);
+    auto it    = m_index.find(key);
+
+    if (it == m_index.end())
+    {
+        m_stats.misses++;
+        return nullptr;
+    }
+
+    const TextLayout& layout = it->second->second;
+    if (layout.scale != scale || layout.fontGeneration != fontGeneration || layout.text != text)
+    {
+        // Hash collision, treat as a miss and let insert() replace the entry
+        m_stats.misses++;
+        return nullptr;
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    m_stats.hits++;
+    return &layout;
+}
+
+const TextLayout&
+TextLayoutCache::insert(TextLayout&& layout)
+{
+    uint64 key = hashKey(layout.text, layout.scale, layout.fontGeneration);
+
+    auto it = m_index.find(key);
+    if (it != m_index.end())
+    {
+        it->second->second = std::move(layout);
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return it->second->second;
+    }
+
+    m_entries.emplace_front(key, std::move(layout));
+    m_index[key] = m_entries.begin();
+    trim();
+
+    return m_entries.front().second;
+}
+
+void
+TextLayoutCache::clear()
+{
+    m_entries.clear();
+    m_index.clear();
+}
+
+void
+TextLayoutCache::setCapacity(uint32 capacity)
+{
+    m_capacity = std::max(1u, capacity);
+    trim();
+}
+
+uint32
+TextLayoutCache::getSize() const
+{
+    return static_cast<uint32>(m_entries.size());
+}
+
+const TextLayoutCacheStats&
+TextLayoutCache::getStats() const
+{
+    return m_stats;
+}
+
+uint64
+TextLayoutCache::hashKey(const String& text, float32 scale, uint32 fontGeneration)
+{
+    // FNV-1a over the text bytes, then the scale bits and font generation
+    uint64 hash = Hash::fnv1a(text.data(), text.size());
+    hash        = Hash::fnv1aMix(hash, std::bit_cast<uint32>(scale));
+    hash        = Hash::fnv1aMix(hash, fontGeneration);
+    return hash;
+}
+
+void
+TextLayoutCache::trim()
+{
+    while (m_entries.size() > m_capacity)
+    {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+        m_stats.evictions++;
+    }
+}
+
+}  // namespace deadcode
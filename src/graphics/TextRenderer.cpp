@@ -9,15 +9,64 @@
 #include "deadcode/graphics/TextRenderer.hpp"
 
 #include "deadcode/core/Logger.hpp"
+#include "deadcode/core/Utf8.hpp"
+#include "deadcode/graphics/GlitchEffect.hpp"
+#include "deadcode/graphics/GlyphAtlas.hpp"
+#include "deadcode/graphics/RenderBackend.hpp"
+
+#include <algorithm>
+#include <cmath>
 
 #include <raylib.h>
 
 namespace deadcode
 {
 
+namespace
+{
+constexpr float32 GLYPH_SPACING = 1.0f;  ///< Extra advance between glyphs (matches DrawTextEx)
+constexpr float32 LINE_SPACING  = 2.0f;  ///< Extra spacing on '\n' (Raylib's default)
+
+constexpr size_t BMP_SIZE = 0x10000;
+constexpr uint16 NO_GLYPH = 0xFFFF;
+
+/// Glyph index of codepoints served by the dynamic atlas instead of the baked one
+constexpr int32 DYNAMIC_GLYPH = -1;
+
+constexpr const char* SDF_SHADER_PATH             = "assets/shaders/text_sdf.frag";
+constexpr const char* GLITCH_VERTEX_SHADER_PATH   = "assets/shaders/text_glitch.vert";
+constexpr const char* GLITCH_FRAGMENT_SHADER_PATH = "assets/shaders/text_glitch.frag";
+
+const ::Shader DEFAULT_SHADER{};  ///< Id 0 selects the backend's default shader
+}  // namespace
+
 TextRenderer::TextRenderer()
-    : m_fontSize(0.0f), m_screenWidth(0), m_screenHeight(0), m_initialized(false), m_fontLoaded(false)
+    : m_fontSize(0.0f),
+      m_screenWidth(0),
+      m_screenHeight(0),
+      m_initialized(false),
+      m_fontLoaded(false),
+      m_fontGeneration(0),
+      m_atlasMode(FontAtlasMode::Bitmap),
+      m_backend(nullptr),
+      m_sdfShader{},
+      m_sdfShaderLoaded(false),
+      m_glitchShader{},
+      m_glitchShaderLoaded(false),
+      m_glitchShaderFailed(false),
+      m_fallbackGlyph(0),
+      m_charWidth(0.0f),
+      m_glyphAtlas(std::make_unique<GlyphAtlas>()),
+      m_batchingEnabled(true)
 {
+    // Queued quads must reach the backend before a page they sample is overwritten, also
+    // those queued for the screen while a layer or grid target is bound
+    m_glyphAtlas->setEvictionCallback([this]() {
+        if (m_backend)
+        {
+            m_frameStats.drawCalls += m_backend->flushAll();
+        }
+    });
 }
 
 TextRenderer::~TextRenderer()
@@ -26,10 +75,19 @@ TextRenderer::~TextRenderer()
 }
 
 bool
-TextRenderer::initialize(int32 screenWidth, int32 screenHeight)
+TextRenderer::initialize(int32 screenWidth, int32 screenHeight, RenderBackend* backend)
 {
     Logger::info("Initializing TextRenderer...");
 
+    if (!backend)
+    {
+        Logger::error("Cannot initialize TextRenderer without a render backend");
+        return false;
+    }
+
+    m_backend = backend;
+    m_glyphAtlas->setBackend(backend);
+
     m_screenWidth  = screenWidth;
     m_screenHeight = screenHeight;
 
@@ -46,30 +104,65 @@ TextRenderer::shutdown()
 
     Logger::info("Shutting down TextRenderer...");
 
+    flush();
+    m_glyphAtlas->release();
+
     if (m_fontLoaded)
     {
-        UnloadFont(m_font);
+        FontAtlasCache::unloadFont(m_font, *m_backend);
         m_fontLoaded = false;
     }
 
+    if (m_sdfShaderLoaded)
+    {
+        m_backend->unloadShader(m_sdfShader);
+        m_sdfShaderLoaded = false;
+    }
+
+    if (m_glitchShaderLoaded)
+    {
+        m_backend->unloadShader(m_glitchShader);
+        m_glitchShaderLoaded = false;
+    }
+    m_glitchShaderFailed = false;
+
     m_initialized = false;
 }
 
 bool
-TextRenderer::loadFont(const String& fontPath, uint32 fontSize)
+TextRenderer::loadFont(const String& fontPath, uint32 fontSize, FontAtlasMode mode)
 {
-    Logger::info("Loading font: {} (size: {})", fontPath, fontSize);
+    Logger::info("Loading font: {} (size: {}, atlas: {})", fontPath, fontSize,
+                 mode == FontAtlasMode::SDF ? "sdf" : "bitmap");
 
-    // Unload previous font if any
+    if (!m_initialized)
+    {
+        Logger::error("Cannot load font before TextRenderer is initialized");
+        return false;
+    }
+
+    // Unload previous font if any (queued glyphs still reference its atlas)
     if (m_fontLoaded)
     {
-        UnloadFont(m_font);
+        flush();
+        FontAtlasCache::unloadFont(m_font, *m_backend);
         m_fontLoaded = false;
     }
 
-    // Load font with Raylib
-    m_font     = LoadFontEx(fontPath.c_str(), static_cast<int>(fontSize), nullptr, 0);
-    m_fontSize = static_cast<float32>(fontSize);
+    // Cached layouts hold glyph indices and advances of the old font
+    m_fontGeneration++;
+    m_layoutCache.clear();
+
+    if (mode == FontAtlasMode::SDF && !ensureSdfShader())
+    {
+        Logger::warn("SDF shader unavailable, falling back to bitmap atlas");
+        mode = FontAtlasMode::Bitmap;
+    }
+
+    // Load font from its baked atlas, rasterizing and baking it if stale
+    m_font      = FontAtlasCache::loadFont(fontPath, fontSize, mode, *m_backend);
+    m_fontSize  = static_cast<float32>(fontSize);
+    m_atlasMode = mode;
 
     // Check if font loaded successfully
     if (m_font.texture.id == 0)
@@ -78,11 +171,22 @@ TextRenderer::loadFont(const String& fontPath, uint32 fontSize)
         return false;
     }
 
+    buildGlyphTable();
+
+    // Codepoints outside the baked set are rasterized on demand at the same size
+    m_glyphAtlas->configure(fontPath, fontSize, m_font.glyphPadding, mode);
+
     m_fontLoaded = true;
     Logger::info("Font loaded successfully: {}", fontPath);
     return true;
 }
 
+FontAtlasMode
+TextRenderer::getAtlasMode() const
+{
+    return m_atlasMode;
+}
+
 void
 TextRenderer::renderText(const String& text, float32 x, float32 y, float32 scale,
                          const glm::vec3& color)
@@ -92,9 +196,17 @@ TextRenderer::renderText(const String& text, float32 x, float32 y, float32 scale
 
     Color raylibColor = toRaylib(color);
     float32 fontSize  = m_fontSize * scale;
-    Vector2 position  = {x, y};
+    m_frameStats.textRuns++;
 
-    DrawTextEx(m_font, text.c_str(), position, fontSize, 1.0f, raylibColor);
+    const TextLayout& layout = getLayout(text, scale);
+    for (const ShapedGlyph& glyph : layout.glyphs)
+    {
+        if (glyph.codepoint == ' ' || glyph.codepoint == '\t' || glyph.codepoint == '\n')
+            continue;
+
+        drawGlyph(glyph.glyphIndex, glyph.codepoint, x + glyph.offsetX, y + glyph.offsetY,
+                  fontSize, raylibColor);
+    }
 }
 
 void
@@ -105,18 +217,22 @@ TextRenderer::renderTextWithCallback(
     if (!m_initialized || !m_fontLoaded)
         return;
 
-    uint32 charCount = static_cast<uint32>(text.length());
+    const char* data = text.data();
+    size_t length    = text.length();
+    uint32 charCount = Utf8::countCodepoints(text);
     uint32 charIndex = 0;
     float32 fontSize = m_fontSize * scale;
+    m_frameStats.textRuns++;
 
     float32 currentX = x;
 
-    // Iterate through all characters
-    for (char c : text)
+    // Iterate through all codepoints
+    for (size_t pos = 0; pos < length;)
     {
         // Get character metrics
-        int codepoint      = static_cast<int>(c);
-        GlyphInfo glyphInfo = GetGlyphInfo(m_font, codepoint);
+        int32 codepoint = Utf8::decodeNext(data, length, pos);
+        float32 advance = 0.0f;
+        int32 index     = resolveGlyph(codepoint, advance);
 
         float32 charX = currentX;
         float32 charY = y;
@@ -130,28 +246,286 @@ TextRenderer::renderTextWithCallback(
             charCallback(charIndex, charCount, charX, charY, charColor, visible);
         }
 
-        if (visible)
+        if (visible && codepoint != ' ' && codepoint != '\t')
         {
-            Color raylibColor = toRaylib(charColor);
-            Vector2 position  = {charX, charY};
-
-            // Render single character
-            DrawTextCodepoint(m_font, codepoint, position, fontSize, raylibColor);
+            // Position and color are per glyph, so batching keeps the effect intact
+            drawGlyph(index, codepoint, charX, charY, fontSize, toRaylib(charColor));
         }
 
         // Advance position for next character
         // Scale factor accounts for the base font size
-        float32 advance = static_cast<float32>(glyphInfo.advanceX);
-        if (advance == 0.0f)
-        {
-            advance = static_cast<float32>(glyphInfo.image.width);
-        }
         currentX += advance * scale;
 
         charIndex++;
     }
 }
 
+void
+TextRenderer::renderTextGlitched(const String& text, float32 x, float32 y, float32 scale,
+                                 const glm::vec3& color, const GlitchEffect& effect)
+{
+    if (!m_initialized || !m_fontLoaded)
+        return;
+
+    if (!ensureGlitchShader())
+    {
+        renderText(text, x, y, scale, color);
+        return;
+    }
+
+    GlitchShaderParams params = effect.getShaderParams();
+
+    Color raylibColor = toRaylib(color);
+    float32 fontSize  = m_fontSize * scale;
+    m_frameStats.textRuns++;
+
+    const TextLayout& layout = getLayout(text, scale);
+    float32 glyphCount       = static_cast<float32>(layout.glyphs.size());
+    float32 blockSize        = std::max(1.0f, std::floor(glyphCount * params.blockSize));
+
+    GlyphEffectAttributes attributes;
+    attributes.intensity = params.intensity;
+    attributes.time      = params.time;
+    attributes.seed      = params.seed;
+
+    // The configuration rides along with every glyph, queued strings keep their own
+    attributes.jitterX          = params.jitter.x;
+    attributes.jitterY          = params.jitter.y;
+    attributes.sliceZone        = params.slice.x;
+    attributes.sliceOffset      = params.slice.y;
+    attributes.duplicateChance  = params.duplicate.x;
+    attributes.duplicateX       = params.duplicate.y;
+    attributes.duplicateY       = params.duplicate.z;
+    attributes.blockOffset      = params.blockOffset;
+    attributes.glitchR          = params.glitchColor.r;
+    attributes.glitchG          = params.glitchColor.g;
+    attributes.glitchB          = params.glitchColor.b;
+    attributes.corruptionChance = params.corruptionChance;
+    attributes.aberration       = params.tint.x;
+    attributes.separation       = params.tint.y;
+    attributes.channelSplit     = params.channelSplit;
+    attributes.sdf              = (m_atlasMode == FontAtlasMode::SDF) ? 1.0f : 0.0f;
+
+    // Attributes are the same for every frame of a glitch except time and intensity
+    for (size_t i = 0; i < layout.glyphs.size(); ++i)
+    {
+        const ShapedGlyph& glyph = layout.glyphs[i];
+        if (glyph.codepoint == ' ' || glyph.codepoint == '\t' || glyph.codepoint == '\n')
+            continue;
+
+        float32 index         = static_cast<float32>(i);
+        attributes.glyphIndex = index;
+        attributes.slice      = index / glyphCount;
+        attributes.blockId    = std::floor(index / blockSize);
+
+        float32 glyphX = x + glyph.offsetX;
+        float32 glyphY = y + glyph.offsetY;
+
+        attributes.copy = 0.0f;
+        drawGlyph(glyph.glyphIndex, glyph.codepoint, glyphX, glyphY, fontSize, raylibColor,
+                  &attributes);
+
+        // The ghost quad stays collapsed unless the shader decides the glyph duplicates
+        attributes.copy = 1.0f;
+        drawGlyph(glyph.glyphIndex, glyph.codepoint, glyphX, glyphY, fontSize, raylibColor,
+                  &attributes);
+    }
+}
+
+void
+TextRenderer::renderCodepoint(int32 codepoint, float32 x, float32 y, float32 scale, Color color)
+{
+    if (!m_initialized || !m_fontLoaded)
+        return;
+
+    float32 advance = 0.0f;
+    int32 index     = resolveGlyph(codepoint, advance);
+    drawGlyph(index, codepoint, x, y, m_fontSize * scale, color);
+}
+
+void
+TextRenderer::renderGlyphs(const GlyphSpan& glyphs)
+{
+    if (!m_initialized || !m_fontLoaded)
+        return;
+
+    m_frameStats.textRuns++;
+
+    for (size_t i = 0; i < glyphs.count; ++i)
+    {
+        int32 codepoint = glyphs.codepoints[i];
+        if (codepoint == ' ' || codepoint == '\t' || codepoint == '\n' || glyphs.colors[i].a == 0)
+            continue;
+
+        float32 advance = 0.0f;
+        int32 index     = resolveGlyph(codepoint, advance);
+        drawGlyph(index, codepoint, glyphs.x[i], glyphs.y[i], m_fontSize * glyphs.scales[i],
+                  glyphs.colors[i]);
+    }
+}
+
+uint32
+TextRenderer::getFontGeneration() const
+{
+    return m_fontGeneration;
+}
+
+void
+TextRenderer::beginFrame()
+{
+    m_frameStats = TextRenderStats{};
+    m_glyphAtlas->beginFrame();
+}
+
+void
+TextRenderer::flush()
+{
+    if (!m_backend)
+        return;
+
+    m_frameStats.drawCalls += m_backend->flush();
+}
+
+void
+TextRenderer::setBatchingEnabled(bool enabled)
+{
+    if (!enabled)
+    {
+        flush();
+    }
+    m_batchingEnabled = enabled;
+    Logger::debug("TextRenderer batching {}", enabled ? "enabled" : "disabled");
+}
+
+bool
+TextRenderer::isBatchingEnabled() const
+{
+    return m_batchingEnabled;
+}
+
+const TextRenderStats&
+TextRenderer::getFrameStats() const
+{
+    return m_frameStats;
+}
+
+const TextLayoutCache&
+TextRenderer::getLayoutCache() const
+{
+    return m_layoutCache;
+}
+
+void
+TextRenderer::setLayoutCacheCapacity(uint32 capacity)
+{
+    m_layoutCache.setCapacity(capacity);
+}
+
+const TextLayout&
+TextRenderer::getLayout(const String& text, float32 scale) const
+{
+    if (const TextLayout* cached = m_layoutCache.find(text, scale, m_fontGeneration))
+        return *cached;
+
+    // Same pen walk as DrawTextEx, recorded once per string and scale
+    TextLayout layout;
+    layout.text           = text;
+    layout.scale          = scale;
+    layout.fontGeneration = m_fontGeneration;
+    layout.glyphs.reserve(text.length());
+
+    float32 fontSize    = m_fontSize * scale;
+    float32 scaleFactor = fontSize / static_cast<float32>(m_font.baseSize);
+    float32 offsetX     = 0.0f;
+    float32 offsetY     = 0.0f;
+    const char* data    = text.data();
+    size_t length       = text.length();
+
+    for (size_t pos = 0; pos < length;)
+    {
+        int32 codepoint = Utf8::decodeNext(data, length, pos);
+
+        if (codepoint == '\n')
+        {
+            layout.width = std::max(layout.width, offsetX - GLYPH_SPACING);
+            layout.glyphs.push_back({codepoint, m_fallbackGlyph, offsetX, offsetY, 0.0f});
+            offsetY += fontSize + LINE_SPACING;
+            offsetX = 0.0f;
+            continue;
+        }
+
+        float32 advance = 0.0f;
+        int32 index     = resolveGlyph(codepoint, advance);
+        advance         = advance * scaleFactor + GLYPH_SPACING;
+
+        layout.glyphs.push_back({codepoint, index, offsetX, offsetY, advance});
+        offsetX += advance;
+    }
+
+    layout.width = std::max(layout.width, offsetX - GLYPH_SPACING);
+    return m_layoutCache.insert(std::move(layout));
+}
+
+void
+TextRenderer::drawGlyph(int32 glyphIndex, int32 codepoint, float32 x, float32 y, float32 fontSize,
+                        Color color, const GlyphEffectAttributes* effect)
+{
+    const Texture2D* texture = &m_font.texture;
+    Rectangle rec;
+    float32 glyphOffsetX;
+    float32 glyphOffsetY;
+
+    if (glyphIndex == DYNAMIC_GLYPH)
+    {
+        const AtlasGlyph* glyph = m_glyphAtlas->acquire(codepoint);
+        if (glyph == nullptr || glyph->rec.width <= 0.0f)
+            return;
+
+        texture      = &m_glyphAtlas->getPageTexture(glyph->page);
+        rec          = glyph->rec;
+        glyphOffsetX = glyph->offsetX;
+        glyphOffsetY = glyph->offsetY;
+    }
+    else
+    {
+        const GlyphInfo& info = m_font.glyphs[glyphIndex];
+        rec                   = m_font.recs[glyphIndex];
+        glyphOffsetX          = static_cast<float32>(info.offsetX);
+        glyphOffsetY          = static_cast<float32>(info.offsetY);
+    }
+
+    m_frameStats.glyphs++;
+
+    // Quad placement mirrors DrawTextCodepoint (atlas pages use the same padding)
+    float32 scaleFactor = fontSize / static_cast<float32>(m_font.baseSize);
+    float32 padding     = static_cast<float32>(m_font.glyphPadding);
+
+    Rectangle dest = {x + (glyphOffsetX - padding) * scaleFactor,
+                      y + (glyphOffsetY - padding) * scaleFactor,
+                      (rec.width + 2.0f * padding) * scaleFactor,
+                      (rec.height + 2.0f * padding) * scaleFactor};
+    Rectangle source = {rec.x - padding, rec.y - padding, rec.width + 2.0f * padding,
+                        rec.height + 2.0f * padding};
+
+    if (effect)
+    {
+        m_backend->drawEffectGlyph(*texture, dest, source, color, m_glitchShader, *effect,
+                                   codepoint);
+    }
+    else
+    {
+        const ::Shader& shader = (m_atlasMode == FontAtlasMode::SDF) ? m_sdfShader
+                                                                     : DEFAULT_SHADER;
+        m_backend->drawGlyph(*texture, dest, source, color, shader, codepoint);
+    }
+
+    // Unbatched mode submits every glyph on its own (one draw call each)
+    if (!m_batchingEnabled)
+    {
+        flush();
+    }
+}
+
 void
 TextRenderer::updateScreenSize(int32 width, int32 height)
 {
@@ -164,12 +538,10 @@ TextRenderer::updateScreenSize(int32 width, int32 height)
 float32
 TextRenderer::getTextWidth(const String& text, float32 scale) const
 {
-    if (!m_fontLoaded)
+    if (!m_fontLoaded || text.empty())
         return 0.0f;
 
-    float32 fontSize = m_fontSize * scale;
-    Vector2 measured = MeasureTextEx(m_font, text.c_str(), fontSize, 1.0f);
-    return measured.x;
+    return getLayout(text, scale).width;
 }
 
 float32
@@ -178,17 +550,8 @@ TextRenderer::getCharWidth(float32 scale) const
     if (!m_fontLoaded)
         return 0.0f;
 
-    // Use 'M' as reference for character width (widest common character)
-    int codepoint      = static_cast<int>('M');
-    GlyphInfo glyphInfo = GetGlyphInfo(m_font, codepoint);
-
-    float32 width = static_cast<float32>(glyphInfo.advanceX);
-    if (width == 0.0f)
-    {
-        width = static_cast<float32>(glyphInfo.image.width);
-    }
-
-    return width * scale;
+    // Precomputed from 'M' at load time (widest common character)
+    return m_charWidth * scale;
 }
 
 float32
@@ -201,4 +564,153 @@ TextRenderer::getLineHeight(float32 scale) const
     return m_fontSize * scale * 1.2f;
 }
 
+bool
+TextRenderer::ensureSdfShader()
+{
+    if (m_sdfShaderLoaded)
+        return true;
+
+    // Raylib's default vertex shader feeds fragTexCoord/fragColor, only the fragment stage differs
+    m_sdfShader = m_backend->loadShader(nullptr, SDF_SHADER_PATH);
+    if (m_sdfShader.id == 0)
+    {
+        Logger::error("Failed to load SDF text shader: {}", SDF_SHADER_PATH);
+        return false;
+    }
+
+    m_sdfShaderLoaded = true;
+    Logger::debug("SDF text shader loaded (id: {})", m_sdfShader.id);
+    return true;
+}
+
+bool
+TextRenderer::ensureGlitchShader()
+{
+    if (m_glitchShaderLoaded)
+        return true;
+    if (m_glitchShaderFailed)
+        return false;
+
+    m_glitchShader = m_backend->loadShader(GLITCH_VERTEX_SHADER_PATH, GLITCH_FRAGMENT_SHADER_PATH);
+    if (m_glitchShader.id == 0)
+    {
+        Logger::error("Failed to load glitch text shader: {} / {}", GLITCH_VERTEX_SHADER_PATH,
+                      GLITCH_FRAGMENT_SHADER_PATH);
+        m_glitchShaderFailed = true;
+        return false;
+    }
+
+    m_glitchShaderLoaded = true;
+    Logger::debug("Glitch text shader loaded (id: {})", m_glitchShader.id);
+    return true;
+}
+
+bool
+TextRenderer::hasGlyph(int32 codepoint) const
+{
+    if (!m_fontLoaded)
+        return false;
+
+    return findGlyphIndex(codepoint) >= 0 || m_glyphAtlas->covers(codepoint);
+}
+
+bool
+TextRenderer::addFallbackFont(const String& fontPath)
+{
+    if (!m_glyphAtlas->addFallbackFont(fontPath))
+        return false;
+
+    // Layouts may hold '?' for codepoints the new font provides
+    m_fontGeneration++;
+    m_layoutCache.clear();
+
+    Logger::info("Fallback font added: {}", fontPath);
+    return true;
+}
+
+GlyphAtlasStats
+TextRenderer::getGlyphAtlasStats() const
+{
+    return m_glyphAtlas->getStats();
+}
+
+RenderBackend*
+TextRenderer::getBackend() const
+{
+    return m_backend;
+}
+
+void
+TextRenderer::buildGlyphTable()
+{
+    size_t glyphCount = static_cast<size_t>(std::max(0, m_font.glyphCount));
+
+    m_bmpGlyphIndex.assign(BMP_SIZE, NO_GLYPH);
+    m_extGlyphIndex.clear();
+    m_glyphAdvance.assign(glyphCount, 0.0f);
+
+    for (size_t i = 0; i < glyphCount; ++i)
+    {
+        int32 codepoint = m_font.glyphs[i].value;
+        if (codepoint >= 0 && static_cast<size_t>(codepoint) < BMP_SIZE && i < NO_GLYPH)
+        {
+            // First glyph wins, matching GetGlyphIndex's linear search
+            uint16& slot = m_bmpGlyphIndex[static_cast<size_t>(codepoint)];
+            if (slot == NO_GLYPH)
+            {
+                slot = static_cast<uint16>(i);
+            }
+        }
+        else
+        {
+            m_extGlyphIndex.try_emplace(codepoint, static_cast<int32>(i));
+        }
+
+        float32 advance = static_cast<float32>(m_font.glyphs[i].advanceX);
+        if (advance == 0.0f)
+        {
+            advance = m_font.recs[i].width;
+        }
+        m_glyphAdvance[i] = advance;
+    }
+
+    // Same fallback as Raylib: '?' if present, otherwise the first glyph
+    m_fallbackGlyph = std::max(0, findGlyphIndex('?'));
+
+    int32 reference = findGlyphIndex('M');
+    m_charWidth = (reference >= 0) ? m_glyphAdvance[static_cast<size_t>(reference)] : 0.0f;
+
+    Logger::debug("Glyph table built: {} glyphs, {} beyond BMP", glyphCount,
+                  m_extGlyphIndex.size());
+}
+
+int32
+TextRenderer::findGlyphIndex(int32 codepoint) const
+{
+    if (codepoint >= 0 && static_cast<size_t>(codepoint) < m_bmpGlyphIndex.size())
+    {
+        uint16 index = m_bmpGlyphIndex[static_cast<size_t>(codepoint)];
+        return (index == NO_GLYPH) ? -1 : static_cast<int32>(index);
+    }
+
+    auto it = m_extGlyphIndex.find(codepoint);
+    return (it != m_extGlyphIndex.end()) ? it->second : -1;
+}
+
+int32
+TextRenderer::resolveGlyph(int32 codepoint, float32& advance) const
+{
+    int32 index = findGlyphIndex(codepoint);
+    if (index < 0)
+    {
+        // Measured from the font metrics, drawGlyph() rasterizes on first draw
+        if (m_glyphAtlas->measure(codepoint, advance))
+            return DYNAMIC_GLYPH;
+        index = m_fallbackGlyph;
+    }
+
+    advance = m_glyphAdvance[static_cast<size_t>(index)];
+    return index;
+}
+
 }  // namespace deadcode
@@ -0,0 +1,664 @@
+/**
+ * @file Timeline.cpp
+ * @brief Implementation of Timeline class
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-05
+ */
+
+#include "deadcode/graphics/Timeline.hpp"
+
+#include "deadcode/core/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace deadcode
+{
+
+namespace
+{
+constexpr float64 MICROSECONDS_PER_SECOND = 1.0e6;
+}  // namespace
+
+Timeline::Timeline()
+    : m_cursor(0),
+      m_lastStart(0),
+      m_duration(0),
+      m_lastClip(NO_CLIP),
+      m_repeats(1),
+      m_yoyo(false),
+      m_prepared(true),
+      m_position(0),
+      m_remainder(0.0),
+      m_timeScale(1.0f),
+      m_moveCount(0),
+      m_playing(false),
+      m_rendered(false),
+      m_atStart(true)
+{
+}
+
+// ============================================================================
+// BUILDING
+// ============================================================================
+
+Timeline&
+Timeline::then(AnimationTarget target, float32 from, float32 to, float32 duration,
+               EasingType easing)
+{
+    return addClip(target, ValueKind::Float, glm::vec4(from, 0.0f, 0.0f, 0.0f),
+                   glm::vec4(to, 0.0f, 0.0f, 0.0f), duration, easing, false);
+}
+
+Timeline&
+Timeline::then(AnimationTarget target, const glm::vec2& from, const glm::vec2& to,
+               float32 duration, EasingType easing)
+{
+    return addClip(target, ValueKind::Vec2, glm::vec4(from, 0.0f, 0.0f),
+                   glm::vec4(to, 0.0f, 0.0f), duration, easing, false);
+}
+
+Timeline&
+Timeline::then(AnimationTarget target, const glm::vec3& from, const glm::vec3& to,
+               float32 duration, EasingType easing)
+{
+    return addClip(target, ValueKind::Vec3, glm::vec4(from, 0.0f), glm::vec4(to, 0.0f),
+                   duration, easing, false);
+}
+
+Timeline&
+Timeline::then(AnimationTarget target, const glm::vec4& from, const glm::vec4& to,
+               float32 duration, EasingType easing)
+{
+    return addClip(target, ValueKind::Vec4, from, to, duration, easing, false);
+}
+
+Timeline&
+Timeline::with(AnimationTarget target, float32 from, float32 to, float32 duration,
+               EasingType easing)
+{
+    return addClip(target, ValueKind::Float, glm::vec4(from, 0.0f, 0.0f, 0.0f),
+                   glm::vec4(to, 0.0f, 0.0f, 0.0f), duration, easing, true);
+}
+
+Timeline&
+Timeline::with(AnimationTarget target, const glm::vec2& from, const glm::vec2& to,
+               float32 duration, EasingType easing)
+{
+    return addClip(target, ValueKind::Vec2, glm::vec4(from, 0.0f, 0.0f),
+                   glm::vec4(to, 0.0f, 0.0f), duration, easing, true);
+}
+
+Timeline&
+Timeline::with(AnimationTarget target, const glm::vec3& from, const glm::vec3& to,
+               float32 duration, EasingType easing)
+{
+    return addClip(target, ValueKind::Vec3, glm::vec4(from, 0.0f), glm::vec4(to, 0.0f),
+                   duration, easing, true);
+}
+
+Timeline&
+Timeline::with(AnimationTarget target, const glm::vec4& from, const glm::vec4& to,
+               float32 duration, EasingType easing)
+{
+    return addClip(target, ValueKind::Vec4, from, to, duration, easing, true);
+}
+
+Timeline&
+Timeline::then(const Timeline& child)
+{
+    return addChild(child, false);
+}
+
+Timeline&
+Timeline::with(const Timeline& child)
+{
+    return addChild(child, true);
+}
+
+Timeline&
+Timeline::delay(float32 seconds)
+{
+    m_cursor += std::max<int64>(toMicroseconds(seconds), 0);
+    m_duration = std::max(m_duration, m_cursor);
+    return *this;
+}
+
+Timeline&
+Timeline::repeat(int32 count, bool yoyo)
+{
+    if (m_lastClip == NO_CLIP)
+    {
+        Logger::warn("Timeline::repeat() needs a tween step before it");
+        return *this;
+    }
+
+    Clip& clip   = m_clips[m_lastClip];
+    clip.repeats = std::max(count, 1);
+    clip.yoyo    = yoyo;
+    clip.end     = clip.start + clip.duration * clip.repeats;
+
+    m_cursor   = std::max(m_cursor, clip.end);
+    m_duration = std::max(m_duration, clip.end);
+    return *this;
+}
+
+Timeline&
+Timeline::label(const String& name)
+{
+    m_labels.insert_or_assign(name, m_cursor);
+    return *this;
+}
+
+Timeline&
+Timeline::cue(const String& name, std::function<void()> callback)
+{
+    m_labels.insert_or_assign(name, m_cursor);
+    m_cues.push_back({m_cursor, std::move(callback)});
+    m_duration = std::max(m_duration, m_cursor);
+    m_prepared = false;
+    return *this;
+}
+
+void
+Timeline::setRepeat(int32 count, bool yoyo)
+{
+    m_repeats = count == REPEAT_FOREVER ? REPEAT_FOREVER : std::max(count, 1);
+    m_yoyo    = yoyo;
+}
+
+void
+Timeline::setOnComplete(std::function<void()> onComplete)
+{
+    m_onComplete = std::move(onComplete);
+}
+
+void
+Timeline::clear()
+{
+    m_clips.clear();
+    m_maxEnd.clear();
+    m_cues.clear();
+    m_labels.clear();
+
+    m_cursor    = 0;
+    m_lastStart = 0;
+    m_duration  = 0;
+    m_lastClip  = NO_CLIP;
+    m_prepared  = true;
+
+    m_position  = 0;
+    m_remainder = 0.0;
+    m_playing   = false;
+    m_rendered  = false;
+    m_atStart   = true;
+    m_moveCount++;
+}
+
+// ============================================================================
+// PLAYBACK
+// ============================================================================
+
+void
+Timeline::play()
+{
+    if (isFinished())
+    {
+        seekPosition(0);
+    }
+    m_playing = true;
+}
+
+void
+Timeline::pause()
+{
+    m_playing = false;
+}
+
+void
+Timeline::advance(float32 deltaTime)
+{
+    if (!m_playing)
+        return;
+
+    prepare();
+
+    // Whole microseconds move the playhead, the fraction waits for the next frame
+    m_remainder += static_cast<float64>(deltaTime * m_timeScale) * MICROSECONDS_PER_SECOND;
+    auto step = static_cast<int64>(std::floor(m_remainder));
+    m_remainder -= static_cast<float64>(step);
+    if (step <= 0 && m_rendered)
+        return;
+
+    int64 total    = getTotalLength();
+    int64 position = total - m_position > step ? m_position + step : total;
+    bool completed = m_repeats != REPEAT_FOREVER && position >= total;
+
+    if (!moveTo(position, true))
+        return;
+
+    if (completed)
+    {
+        m_playing = false;
+        if (m_onComplete)
+        {
+            m_onComplete();
+        }
+    }
+}
+
+void
+Timeline::seek(float64 seconds)
+{
+    prepare();
+    seekPosition(std::clamp<int64>(toMicroseconds(seconds), 0, getTotalLength()));
+}
+
+bool
+Timeline::seek(const String& name)
+{
+    auto it = m_labels.find(name);
+    if (it == m_labels.end())
+    {
+        Logger::warn("Timeline has no label '{}'", name);
+        return false;
+    }
+
+    prepare();
+    seekPosition(it->second);
+    return true;
+}
+
+void
+Timeline::setTimeScale(float32 timeScale)
+{
+    m_timeScale = std::max(timeScale, 0.0f);
+}
+
+bool
+Timeline::isPlaying() const
+{
+    return m_playing;
+}
+
+bool
+Timeline::isFinished() const
+{
+    return m_repeats != REPEAT_FOREVER && m_position >= getTotalLength();
+}
+
+float64
+Timeline::getTime() const
+{
+    return static_cast<float64>(m_position) / MICROSECONDS_PER_SECOND;
+}
+
+float64
+Timeline::getDuration() const
+{
+    return static_cast<float64>(m_duration) / MICROSECONDS_PER_SECOND;
+}
+
+float64
+Timeline::getTotalDuration() const
+{
+    if (m_repeats == REPEAT_FOREVER)
+        return -1.0;
+    return static_cast<float64>(getTotalLength()) / MICROSECONDS_PER_SECOND;
+}
+
+uint32
+Timeline::getClipCount() const
+{
+    return static_cast<uint32>(m_clips.size());
+}
+
+// ============================================================================
+// INTERNALS
+// ============================================================================
+
+Timeline&
+Timeline::addClip(AnimationTarget target, ValueKind kind, const glm::vec4& from,
+                  const glm::vec4& to, float32 duration, EasingType easing, bool parallel)
+{
+    Clip clip;
+    clip.start    = parallel ? m_lastStart : m_cursor;
+    clip.duration = std::max<int64>(toMicroseconds(duration), 0);
+    clip.end      = clip.start + clip.duration;
+    clip.easing   = easing;
+    clip.kind     = kind;
+    clip.target   = target;
+    clip.from     = from;
+    clip.to       = to;
+
+    m_lastStart = clip.start;
+    m_cursor    = std::max(m_cursor, clip.end);
+    m_duration  = std::max(m_duration, clip.end);
+    m_lastClip  = static_cast<uint32>(m_clips.size());
+    m_prepared  = false;
+
+    m_clips.push_back(clip);
+    return *this;
+}
+
+Timeline&
+Timeline::addChild(const Timeline& child, bool parallel)
+{
+    int32 iterations = child.m_repeats;
+    if (iterations == REPEAT_FOREVER)
+    {
+        Logger::warn("Nested timeline repeats forever, copying one iteration");
+        iterations = 1;
+    }
+
+    int64 start  = parallel ? m_lastStart : m_cursor;
+    int64 length = child.m_duration;
+    for (int32 iteration = 0; iteration < iterations; ++iteration)
+    {
+        int64 offset  = start + length * iteration;
+        bool reversed = child.m_yoyo && iteration % 2 == 1;
+
+        // A backwards iteration mirrors every clip and cue inside it
+        for (Clip clip : child.m_clips)
+        {
+            int64 clipStart = reversed ? length - clip.end : clip.start;
+            clip.end        = offset + clipStart + (clip.end - clip.start);
+            clip.start      = offset + clipStart;
+            clip.reversed   = clip.reversed != reversed;
+            m_clips.push_back(clip);
+        }
+        for (const Cue& cue : child.m_cues)
+        {
+            m_cues.push_back({offset + (reversed ? length - cue.time : cue.time), cue.callback});
+        }
+    }
+
+    for (const auto& [name, time] : child.m_labels)
+    {
+        m_labels.try_emplace(name, start + time);
+    }
+
+    int64 end   = start + length * iterations;
+    m_lastStart = start;
+    m_cursor    = std::max(m_cursor, end);
+    m_duration  = std::max(m_duration, end);
+    m_lastClip  = NO_CLIP;
+    m_prepared  = false;
+    return *this;
+}
+
+void
+Timeline::prepare()
+{
+    if (m_prepared)
+        return;
+
+    // Stable, so of two clips starting together the one added later still wins
+    std::stable_sort(m_clips.begin(), m_clips.end(),
+                     [](const Clip& a, const Clip& b) { return a.start < b.start; });
+    std::stable_sort(m_cues.begin(), m_cues.end(),
+                     [](const Cue& a, const Cue& b) { return a.time < b.time; });
+
+    m_maxEnd.resize(m_clips.size());
+    buildMaxEnd(0, m_clips.size());
+
+    m_lastClip = NO_CLIP;
+    m_prepared = true;
+}
+
+bool
+Timeline::moveTo(int64 position, bool fireCues)
+{
+    uint32 move       = ++m_moveCount;
+    int64 from        = m_position;
+    bool includeStart = m_atStart;
+    m_position        = position;
+    m_atStart         = false;
+
+    // Nothing written yet: every clip first takes its value at the old position
+    if (!m_rendered)
+    {
+        renderSpan(0, m_duration, getLocalTime(from));
+        m_rendered = true;
+    }
+
+    int64 fromIteration = getIteration(from);
+    int64 toIteration   = getIteration(position);
+    if (fromIteration == toIteration)
+        return moveLocal(getLocalTime(from), getLocalTime(position), fireCues, includeStart,
+                         move);
+
+    // Finish the current iteration at its edge, then enter the last one from its edge
+    bool forward  = toIteration > fromIteration;
+    int64 exitAt  = forward != isIterationReversed(fromIteration) ? m_duration : 0;
+    int64 enterAt = forward != isIterationReversed(toIteration) ? 0 : m_duration;
+
+    if (!moveLocal(getLocalTime(from), exitAt, fireCues, includeStart, move))
+        return false;
+
+    if (enterAt != exitAt)
+    {
+        renderSpan(0, m_duration, enterAt);
+    }
+
+    return moveLocal(enterAt, getLocalTime(position), fireCues, true, move);
+}
+
+bool
+Timeline::moveLocal(int64 from, int64 to, bool fireCues, bool includeStart, uint32 move)
+{
+    if (from == to && !includeStart)
+        return true;
+
+    renderSpan(std::min(from, to), std::max(from, to), to);
+    if (!fireCues || m_cues.empty())
+        return true;
+
+    auto byTime = [](const Cue& cue, int64 time) { return cue.time < time; };
+    if (from <= to)
+    {
+        // (from, to], or [from, to] when starting out
+        auto first = includeStart
+                         ? std::lower_bound(m_cues.begin(), m_cues.end(), from, byTime)
+                         : std::upper_bound(m_cues.begin(), m_cues.end(), from,
+                                            [](int64 time, const Cue& cue)
+                                            { return time < cue.time; });
+        for (size_t i = static_cast<size_t>(first - m_cues.begin());
+             i < m_cues.size() && m_cues[i].time <= to; ++i)
+        {
+            if (m_cues[i].callback)
+            {
+                m_cues[i].callback();
+                if (m_moveCount != move)
+                    return false;
+            }
+        }
+    }
+    else
+    {
+        // [to, from), or [to, from] when starting out, crossed back to front
+        auto last = includeStart
+                        ? std::upper_bound(m_cues.begin(), m_cues.end(), from,
+                                           [](int64 time, const Cue& cue)
+                                           { return time < cue.time; })
+                        : std::lower_bound(m_cues.begin(), m_cues.end(), from, byTime);
+        for (size_t i = static_cast<size_t>(last - m_cues.begin());
+             i-- > 0 && m_cues[i].time >= to;)
+        {
+            if (m_cues[i].callback)
+            {
+                m_cues[i].callback();
+                if (m_moveCount != move)
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+void
+Timeline::renderSpan(int64 low, int64 high, int64 time)
+{
+    if (m_clips.empty())
+        return;
+
+    m_touched.clear();
+    collectOverlaps(0, m_clips.size(), low, high);
+
+    // Clips not yet started are written first, the latest first, so the clips that
+    // have started overwrite them; those go in start order, so the latest one wins
+    for (auto it = m_touched.rbegin(); it != m_touched.rend(); ++it)
+    {
+        if (m_clips[*it].start > time)
+        {
+            renderClip(m_clips[*it], time);
+        }
+    }
+    for (uint32 index : m_touched)
+    {
+        if (m_clips[index].start <= time)
+        {
+            renderClip(m_clips[index], time);
+        }
+    }
+}
+
+int64
+Timeline::buildMaxEnd(size_t first, size_t last)
+{
+    if (first >= last)
+        return std::numeric_limits<int64>::min();
+
+    size_t middle    = first + (last - first) / 2;
+    int64 maxEnd     = std::max({m_clips[middle].end, buildMaxEnd(first, middle),
+                                 buildMaxEnd(middle + 1, last)});
+    m_maxEnd[middle] = maxEnd;
+    return maxEnd;
+}
+
+void
+Timeline::collectOverlaps(size_t first, size_t last, int64 low, int64 high)
+{
+    if (first >= last)
+        return;
+
+    // A subtree whose clips all end before the span has nothing to write
+    size_t middle = first + (last - first) / 2;
+    if (m_maxEnd[middle] < low)
+        return;
+
+    collectOverlaps(first, middle, low, high);
+
+    // Clips are sorted by start, so past the span nothing on the right touches it
+    const Clip& clip = m_clips[middle];
+    if (clip.start > high)
+        return;
+    if (clip.end >= low)
+    {
+        m_touched.push_back(static_cast<uint32>(middle));
+    }
+
+    collectOverlaps(middle + 1, last, low, high);
+}
+
+void
+Timeline::renderClip(const Clip& clip, int64 time) const
+{
+    float32 progress = 0.0f;
+    if (clip.duration == 0)
+    {
+        progress = (time >= clip.start) != clip.reversed ? 1.0f : 0.0f;
+    }
+    else
+    {
+        int64 span  = clip.end - clip.start;
+        int64 local = std::clamp<int64>(time - clip.start, 0, span);
+        if (clip.reversed)
+        {
+            local = span - local;
+        }
+
+        int64 iteration = std::min<int64>(local / clip.duration, clip.repeats - 1);
+        int64 within    = local - iteration * clip.duration;
+        progress = static_cast<float32>(static_cast<float64>(within) /
+                                        static_cast<float64>(clip.duration));
+        if (clip.yoyo && iteration % 2 == 1)
+        {
+            progress = 1.0f - progress;
+        }
+    }
+
+    float32 eased   = Easing::evaluate(clip.easing, progress);
+    glm::vec4 value = clip.from + (clip.to - clip.from) * eased;
+
+    AnimationSystem& animations = AnimationSystem::getInstance();
+    switch (clip.kind)
+    {
+        case ValueKind::Float:
+            animations.setTargetValue(clip.target, value.x);
+            break;
+        case ValueKind::Vec2:
+            animations.setTargetValue(clip.target, glm::vec2(value));
+            break;
+        case ValueKind::Vec3:
+            animations.setTargetValue(clip.target, glm::vec3(value));
+            break;
+        case ValueKind::Vec4:
+            animations.setTargetValue(clip.target, value);
+            break;
+    }
+}
+
+int64
+Timeline::getLocalTime(int64 position) const
+{
+    int64 iteration = getIteration(position);
+    int64 local     = position - iteration * m_duration;
+    return isIterationReversed(iteration) ? m_duration - local : local;
+}
+
+int64
+Timeline::getIteration(int64 position) const
+{
+    if (m_duration == 0)
+        return 0;
+
+    int64 iteration = position / m_duration;
+    if (m_repeats != REPEAT_FOREVER)
+    {
+        iteration = std::min<int64>(iteration, m_repeats - 1);
+    }
+    return iteration;
+}
+
+bool
+Timeline::isIterationReversed(int64 iteration) const
+{
+    return m_yoyo && iteration % 2 == 1;
+}
+
+int64
+Timeline::getTotalLength() const
+{
+    if (m_repeats == REPEAT_FOREVER)
+        return std::numeric_limits<int64>::max();
+    return m_duration * m_repeats;
+}
+
+void
+Timeline::seekPosition(int64 position)
+{
+    m_remainder = 0.0;
+    moveTo(position, false);
+    m_atStart = position == 0;
+}
+
+int64
+Timeline::toMicroseconds(float64 seconds)
+{
+    return std::llround(seconds * MICROSECONDS_PER_SECOND);
+}
+
+}  // namespace deadcode
@@ -10,6 +10,7 @@
 
 #include "deadcode/core/Logger.hpp"
 
+#include <GLFW/glfw3.h>
 #include <raylib.h>
 
 #include <stdexcept>
@@ -71,11 +72,7 @@ Window::create(const WindowConfig& config)
         m_config.fullscreen = true;
     }
 
-    // Enable vsync (Raylib handles this through SetTargetFPS and window flags)
-    if (!config.vsync)
-    {
-        SetWindowState(FLAG_VSYNC_HINT);
-    }
+    setVSync(config.vsync);
 
     Logger::info("Window created successfully");
     Logger::info("Screen dimensions: {}x{}", GetScreenWidth(), GetScreenHeight());
@@ -107,6 +104,16 @@ Window::swapBuffers()
     // Kept for API compatibility with old GLFW code
 }
 
+void
+Window::waitEvents(float64 timeoutSeconds)
+{
+    if (!m_isOpen || timeoutSeconds <= 0.0)
+        return;
+
+    // Raylib only offers an untimed wait (EnableEventWaiting), GLFW has both
+    glfwWaitEventsTimeout(timeoutSeconds);
+}
+
 int32
 Window::getWidth() const
 {
@@ -150,4 +157,31 @@ Window::setTitle(const String& title)
     }
 }
 
+void
+Window::setVSync(bool enabled)
+{
+    if (!m_isOpen)
+        return;
+
+    // On an open window Raylib applies the hint as the swap interval
+    if (enabled)
+    {
+        SetWindowState(FLAG_VSYNC_HINT);
+    }
+    else
+    {
+        ClearWindowState(FLAG_VSYNC_HINT);
+    }
+    m_config.vsync = enabled;
+}
+
+int32
+Window::getRefreshRate() const
+{
+    if (!m_isOpen)
+        return 0;
+
+    return GetMonitorRefreshRate(GetCurrentMonitor());
+}
+
 }  // namespace deadcode
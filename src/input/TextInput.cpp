@@ -1,5 +1,7 @@
 #include "deadcode/input/TextInput.hpp"
 
+#include "deadcode/graphics/RenderBackend.hpp"
+
 #include <raylib.h>
 
 namespace deadcode
@@ -27,13 +29,21 @@ TextInput::update(float deltaTime)
 }
 
 void
-TextInput::render(int32 posX, int32 posY)
+TextInput::render(RenderBackend* backend, int32 posX, int32 posY)
 {
-    DrawRectangleLines(posX, posY, m_width, m_height, Color(255, 255, 255, 255));
+    if (!backend)
+        return;
+
+    backend->drawRectangleLines(Rectangle{static_cast<float>(posX), static_cast<float>(posY),
+                                          static_cast<float>(m_width),
+                                          static_cast<float>(m_height)},
+                                1.0f, Color(255, 255, 255, 255));
     if (m_cursorVisible)
     {
-        DrawRectangle(posX + 20, posY + ((m_height / 2) / 2), 5, m_height * 0.6,
-                      Color(0, 0, 255, 255));
+        backend->drawRectangle(Rectangle{static_cast<float>(posX + 20),
+                                         static_cast<float>(posY + ((m_height / 2) / 2)), 5.0f,
+                                         static_cast<float>(m_height) * 0.6f},
+                               Color(0, 0, 255, 255));
     }
 }
 }  // namespace deadcode
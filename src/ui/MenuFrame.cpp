@@ -9,8 +9,12 @@
 #include "deadcode/ui/MenuFrame.hpp"
 
 #include "deadcode/core/Logger.hpp"
+#include "deadcode/core/Utf8.hpp"
+#include "deadcode/graphics/CellGrid.hpp"
 #include "deadcode/graphics/TextRenderer.hpp"
 
+#include <algorithm>
+
 namespace deadcode
 {
 
@@ -180,6 +184,55 @@ MenuFrame::renderLines(TextRenderer* textRenderer, const std::vector<String>& li
     }
 }
 
+void
+MenuFrame::render(CellGrid& grid, int32 column, int32 row) const
+{
+    if (m_width < 2 || m_height < 2)
+        return;
+
+    int32 bottom = row + m_height - 1;
+
+    putHorizontalLine(grid, column, row, m_topLeft, m_horizontal, m_topRight);
+
+    if (!m_title.empty())
+    {
+        putAlignedText(grid, column, row + 1, m_title, m_titleAlign, m_titleColor);
+        putHorizontalLine(grid, column, row + 2, m_teeRight, m_horizontal, m_teeLeft);
+    }
+
+    if (!m_footer.empty())
+    {
+        putHorizontalLine(grid, column, bottom - 2, m_teeRight, m_horizontal, m_teeLeft);
+        putAlignedText(grid, column, bottom - 1, m_footer, m_footerAlign, m_contentColor);
+    }
+
+    Cell border;
+    border.codepoint  = m_vertical;
+    border.foreground = toRaylib(m_borderColor);
+
+    // Title and footer rows also need side borders
+    for (int32 r = row + 1; r < bottom; ++r)
+    {
+        bool separator = (!m_title.empty() && r == row + 2) ||
+                         (!m_footer.empty() && r == bottom - 2);
+        if (separator)
+            continue;
+
+        grid.setCell(column, r, border);
+        grid.setCell(column + m_width - 1, r, border);
+    }
+
+    putHorizontalLine(grid, column, bottom, m_bottomLeft, m_horizontal, m_bottomRight);
+}
+
+void
+MenuFrame::renderText(CellGrid& grid, int32 column, int32 row, const String& text,
+                      int32 offsetY, FrameAlign align) const
+{
+    int32 contentTop = row + 1 + m_padding + (m_title.empty() ? 0 : 2);
+    putAlignedText(grid, column, contentTop + offsetY, text, align, m_contentColor);
+}
+
 void
 MenuFrame::getContentArea(TextRenderer* textRenderer, float32 scale, float32& outX, float32& outY,
                           int32& outWidth, int32& outHeight) const
@@ -208,6 +261,18 @@ MenuFrame::getContentArea(TextRenderer* textRenderer, float32 scale, float32& ou
     }
 }
 
+int32
+MenuFrame::getWidth() const
+{
+    return m_width;
+}
+
+int32
+MenuFrame::getHeight() const
+{
+    return m_height;
+}
+
 float32
 MenuFrame::getCharWidth(TextRenderer* textRenderer, float32 scale) const
 {
@@ -237,45 +302,46 @@ MenuFrame::getCharHeight(TextRenderer* textRenderer, float32 scale) const
 void
 MenuFrame::updateBorderChars()
 {
+    // Unicode box drawing codepoints (the CP437 set), served by the fallback font chain
     switch (m_style)
     {
         case FrameStyle::SINGLE:
-            m_topLeft     = '\xDA';  // ┌
-            m_topRight    = '\xBF';  // ┐
-            m_bottomLeft  = '\xC0';  // └
-            m_bottomRight = '\xD9';  // ┘
-            m_horizontal  = '\xC4';  // ─
-            m_vertical    = '\xB3';  // │
-            m_teeDown     = '\xC2';  // ┬
-            m_teeUp       = '\xC1';  // ┴
-            m_teeRight    = '\xC3';  // ├
-            m_teeLeft     = '\xB4';  // ┤
+            m_topLeft     = 0x250C;  // ┌
+            m_topRight    = 0x2510;  // ┐
+            m_bottomLeft  = 0x2514;  // └
+            m_bottomRight = 0x2518;  // ┘
+            m_horizontal  = 0x2500;  // ─
+            m_vertical    = 0x2502;  // │
+            m_teeDown     = 0x252C;  // ┬
+            m_teeUp       = 0x2534;  // ┴
+            m_teeRight    = 0x251C;  // ├
+            m_teeLeft     = 0x2524;  // ┤
             break;
 
         case FrameStyle::DOUBLE:
-            m_topLeft     = '\xC9';  // ╔
-            m_topRight    = '\xBB';  // ╗
-            m_bottomLeft  = '\xC8';  // ╚
-            m_bottomRight = '\xBC';  // ╝
-            m_horizontal  = '\xCD';  // ═
-            m_vertical    = '\xBA';  // ║
-            m_teeDown     = '\xCB';  // ╦
-            m_teeUp       = '\xCA';  // ╩
-            m_teeRight    = '\xCC';  // ╠
-            m_teeLeft     = '\xB9';  // ╣
+            m_topLeft     = 0x2554;  // ╔
+            m_topRight    = 0x2557;  // ╗
+            m_bottomLeft  = 0x255A;  // ╚
+            m_bottomRight = 0x255D;  // ╝
+            m_horizontal  = 0x2550;  // ═
+            m_vertical    = 0x2551;  // ║
+            m_teeDown     = 0x2566;  // ╦
+            m_teeUp       = 0x2569;  // ╩
+            m_teeRight    = 0x2560;  // ╠
+            m_teeLeft     = 0x2563;  // ╣
             break;
 
         case FrameStyle::HEAVY:
-            m_topLeft     = '\xDA';  // Use single as fallback
-            m_topRight    = '\xBF';
-            m_bottomLeft  = '\xC0';
-            m_bottomRight = '\xD9';
-            m_horizontal  = '\xCD';  // Heavy horizontal
-            m_vertical    = '\xBA';  // Heavy vertical
-            m_teeDown     = '\xC2';
-            m_teeUp       = '\xC1';
-            m_teeRight    = '\xC3';
-            m_teeLeft     = '\xB4';
+            m_topLeft     = 0x250C;  // Use single as fallback
+            m_topRight    = 0x2510;
+            m_bottomLeft  = 0x2514;
+            m_bottomRight = 0x2518;
+            m_horizontal  = 0x2550;  // Heavy horizontal
+            m_vertical    = 0x2551;  // Heavy vertical
+            m_teeDown     = 0x252C;
+            m_teeUp       = 0x2534;
+            m_teeRight    = 0x251C;
+            m_teeLeft     = 0x2524;
             break;
 
         case FrameStyle::ROUNDED:
@@ -294,30 +360,30 @@ MenuFrame::updateBorderChars()
 
         case FrameStyle::CYBER:
             // Aggressive cyberpunk style
-            m_topLeft     = '\xDA';
-            m_topRight    = '\xBF';
-            m_bottomLeft  = '\xC0';
-            m_bottomRight = '\xD9';
-            m_horizontal  = '\xC4';
-            m_vertical    = '\xB3';
-            m_teeDown     = '\xC2';
-            m_teeUp       = '\xC1';
-            m_teeRight    = '\xC3';
-            m_teeLeft     = '\xB4';
+            m_topLeft     = 0x250C;
+            m_topRight    = 0x2510;
+            m_bottomLeft  = 0x2514;
+            m_bottomRight = 0x2518;
+            m_horizontal  = 0x2500;
+            m_vertical    = 0x2502;
+            m_teeDown     = 0x252C;
+            m_teeUp       = 0x2534;
+            m_teeRight    = 0x251C;
+            m_teeLeft     = 0x2524;
             break;
 
         case FrameStyle::NEON:
             // Same as double for now, but with glow enabled
-            m_topLeft     = '\xC9';
-            m_topRight    = '\xBB';
-            m_bottomLeft  = '\xC8';
-            m_bottomRight = '\xBC';
-            m_horizontal  = '\xCD';
-            m_vertical    = '\xBA';
-            m_teeDown     = '\xCB';
-            m_teeUp       = '\xCA';
-            m_teeRight    = '\xCC';
-            m_teeLeft     = '\xB9';
+            m_topLeft     = 0x2554;
+            m_topRight    = 0x2557;
+            m_bottomLeft  = 0x255A;
+            m_bottomRight = 0x255D;
+            m_horizontal  = 0x2550;
+            m_vertical    = 0x2551;
+            m_teeDown     = 0x2566;
+            m_teeUp       = 0x2569;
+            m_teeRight    = 0x2560;
+            m_teeLeft     = 0x2563;
             m_glowEnabled = true;
             break;
     }
@@ -325,7 +391,7 @@ MenuFrame::updateBorderChars()
 
 void
 MenuFrame::renderHorizontalLine(TextRenderer* textRenderer, float32 x, float32 y, int32 width,
-                                char left, char middle, char right, float32 scale)
+                                int32 left, int32 middle, int32 right, float32 scale)
 {
     if (!textRenderer)
         return;
@@ -333,19 +399,81 @@ MenuFrame::renderHorizontalLine(TextRenderer* textRenderer, float32 x, float32 y
     float32 charWidth = getCharWidth(textRenderer, scale);
 
     // Render left corner
-    String leftStr(1, left);
+    String leftStr;
+    Utf8::appendCodepoint(left, leftStr);
     textRenderer->renderText(leftStr, x, y, scale, m_borderColor);
 
-    // Render middle section
-    String middleStr(width - 2, middle);
-    textRenderer->renderText(middleStr, x + charWidth, y, scale, m_borderColor);
+    // Render middle section one cell at a time, fallback glyphs may not share the font's advance
+    String middleStr;
+    Utf8::appendCodepoint(middle, middleStr);
+    for (int32 i = 1; i < width - 1; ++i)
+    {
+        textRenderer->renderText(middleStr, x + (charWidth * static_cast<float32>(i)), y, scale,
+                                 m_borderColor);
+    }
 
     // Render right corner
-    String rightStr(1, right);
+    String rightStr;
+    Utf8::appendCodepoint(right, rightStr);
     textRenderer->renderText(rightStr, x + (charWidth * static_cast<float32>(width - 1)), y, scale,
                              m_borderColor);
 }
 
+void
+MenuFrame::putHorizontalLine(CellGrid& grid, int32 column, int32 row, int32 left, int32 middle,
+                             int32 right) const
+{
+    Cell cell;
+    cell.foreground = toRaylib(m_borderColor);
+
+    for (int32 i = 0; i < m_width; ++i)
+    {
+        cell.codepoint = (i == 0) ? left : (i == m_width - 1) ? right : middle;
+        grid.setCell(column + i, row, cell);
+    }
+}
+
+void
+MenuFrame::putAlignedText(CellGrid& grid, int32 column, int32 row, const String& text,
+                          FrameAlign align, const glm::vec3& color) const
+{
+    int32 inner = m_width - 2 - (m_padding * 2);
+    if (inner <= 0)
+        return;
+
+    int32 textWidth = std::min(static_cast<int32>(Utf8::countCodepoints(text)), inner);
+
+    int32 left = column + 1 + m_padding;
+    int32 start;
+    switch (align)
+    {
+        case FrameAlign::CENTER:
+            start = left + (inner - textWidth) / 2;
+            break;
+        case FrameAlign::RIGHT:
+            start = left + inner - textWidth;
+            break;
+        case FrameAlign::LEFT:
+        default:
+            start = left;
+            break;
+    }
+
+    // Blank the rest of the inner row so shorter text does not leave stale cells. Only the
+    // cells around the text, rewriting unchanged text must not dirty the row.
+    Cell blank;
+    grid.fill(left, row, start - left, 1, blank);
+    grid.fill(start + textWidth, row, left + inner - start - textWidth, 1, blank);
+
+    String clipped;
+    size_t pos = 0;
+    for (int32 i = 0; i < textWidth; ++i)
+    {
+        Utf8::appendCodepoint(Utf8::decodeNext(text.data(), text.size(), pos), clipped);
+    }
+    grid.putText(start, row, clipped, toRaylib(color));
+}
+
 void
 MenuFrame::renderVerticalLines(TextRenderer* textRenderer, float32 scale)
 {
@@ -355,7 +483,8 @@ MenuFrame::renderVerticalLines(TextRenderer* textRenderer, float32 scale)
     float32 charWidth  = getCharWidth(textRenderer, scale);
     float32 charHeight = getCharHeight(textRenderer, scale);
 
-    String vertStr(1, m_vertical);
+    String vertStr;
+    Utf8::appendCodepoint(m_vertical, vertStr);
 
     int32 startLine = 1;
     int32 endLine   = m_height - 1;
@@ -10,14 +10,23 @@
 
 #include "deadcode/core/Logger.hpp"
 #include "deadcode/core/Version.hpp"
+#include "deadcode/graphics/CellGrid.hpp"
 #include "deadcode/graphics/GlitchEffect.hpp"
 #include "deadcode/graphics/TextRenderer.hpp"
 
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace deadcode
 {
 
+namespace
+{
+constexpr float32 BLINK_INTERVAL = 0.5f;  ///< Selection marker blink period (seconds)
+}  // namespace
+
 StartMenu::StartMenu()
 {
     // Simple text logo
@@ -55,6 +64,9 @@ StartMenu::initialize(int32 screenWidth, int32 screenHeight)
     float32 menuScale = m_mainFrame->calculateDynamicScale(screenWidth, screenHeight, 0.7f);
     m_mainFrame->setScale(menuScale);
 
+    // Only the blinking selection changes from frame to frame, the grid redraws just its row
+    m_optionsGrid = std::make_unique<CellGrid>(m_mainFrame->getWidth(), m_mainFrame->getHeight());
+
     // Initialize glitch effect with enhanced settings
     GlitchConfig glitchConfig;
     glitchConfig.enabled               = false;
@@ -83,13 +95,21 @@ StartMenu::initialize(int32 screenWidth, int32 screenHeight)
     glitchConfig.chromaticAberration = true;
     glitchConfig.chromaticIntensity  = 2.0f;
 
-    m_glitchEffect = std::make_unique<GlitchEffect>(glitchConfig);
-    if (!m_glitchEffect->initialize())
+    // One instance is simulated, the other draws its state with the render-side settings
+    m_glitchEffect  = std::make_unique<GlitchEffect>(glitchConfig);
+    m_glitchDisplay = std::make_unique<GlitchEffect>(glitchConfig);
+    if (!m_glitchEffect->initialize() || !m_glitchDisplay->initialize())
     {
         Logger::error("Failed to initialize glitch effect for start menu");
         return false;
     }
-    m_glitchEffect->setScreenSize(screenWidth, screenHeight);
+    m_glitchDisplay->setScreenSize(screenWidth, screenHeight);
+
+    m_rain = std::make_unique<DigitalRain>();
+    m_rain->setScreenSize(screenWidth, screenHeight);
+    setBackgroundRain(DigitalRainSettings{});
+
+    m_frame = captureFrame();
 
     Logger::info("Start menu initialized");
     return true;
@@ -98,12 +118,18 @@ StartMenu::initialize(int32 screenWidth, int32 screenHeight)
 void
 StartMenu::update(float deltaTime)
 {
-    if (!m_visible)
-        return;
+    // A selection change restarts the blink with the marker shown
+    uint32 restarts = m_blinkRestarts.load(std::memory_order_relaxed);
+    if (restarts != m_blinkRestartsSeen)
+    {
+        m_blinkRestartsSeen = restarts;
+        m_blinkTimer        = 0.0f;
+        m_blinkState        = true;
+    }
 
     // Update blink animation for selected item
     m_blinkTimer += deltaTime;
-    if (m_blinkTimer >= 0.5f)  // Blink every 0.5 seconds
+    if (m_blinkTimer >= BLINK_INTERVAL)
     {
         m_blinkState = !m_blinkState;
         m_blinkTimer = 0.0f;
@@ -115,6 +141,17 @@ StartMenu::update(float deltaTime)
         m_glitchEffect->update(deltaTime);
     }
 
+    // The rain only changes on its steps, which keeps the menu idle between them
+    if (m_rainInterval > 0.0f)
+    {
+        m_rainTimer += deltaTime;
+        while (m_rainTimer >= m_rainInterval)
+        {
+            m_rainTimer -= m_rainInterval;
+            m_rainStep++;
+        }
+    }
+
     // Legacy glitch timer for backwards compatibility
     m_glitchTimer += deltaTime;
     if (m_glitchTimer >= 3.0f)
@@ -123,20 +160,84 @@ StartMenu::update(float deltaTime)
     }
 }
 
+StartMenuFrame
+StartMenu::captureFrame() const
+{
+    StartMenuFrame frame;
+    frame.blinkState = m_blinkState;
+    if (m_glitchEffect)
+    {
+        frame.glitch = m_glitchEffect->getState();
+    }
+    frame.rainStep = m_rainStep;
+    return frame;
+}
+
 void
-StartMenu::render(TextRenderer* textRenderer)
+StartMenu::render(Renderer* renderer, const StartMenuFrame& frame)
 {
-    if (!m_visible || !textRenderer)
+    if (!m_visible || !renderer || !renderer->getTextRenderer())
         return;
 
-    // Render logo frame
-    renderLogo(textRenderer);
+    m_frame = frame;
+    if (m_glitchDisplay)
+    {
+        m_glitchDisplay->setState(frame.glitch);
+    }
+
+    TextRenderer* textRenderer = renderer->getTextRenderer();
+
+    // Behind everything, including the cached layers composited below
+    if (m_rain)
+    {
+        int32 drawLayer = renderer->getDrawLayer();
+        renderer->setDrawLayer(DrawLayer::BACKGROUND);
+        m_rain->render(textRenderer, frame.rainStep);
+        renderer->setDrawLayer(drawLayer);
+    }
+
+    if (m_layerRenderer != renderer)
+    {
+        // The old renderer would otherwise keep both screen-sized targets until shutdown
+        if (m_layerRenderer)
+        {
+            m_layerRenderer->destroyLayer(m_logoLayer);
+            m_layerRenderer->destroyLayer(m_chromeLayer);
+        }
+        m_layerRenderer = renderer;
+        m_logoLayer     = renderer->createLayer("start_menu.logo");
+        m_chromeLayer   = renderer->createLayer("start_menu.chrome");
+    }
+
+    // The glitched title changes every frame, so it bypasses its layer while glitching
+    if (m_glitchDisplay && m_glitchDisplay->isActive())
+    {
+        renderLogo(textRenderer);
+    }
+    else
+    {
+        renderer->drawLayer(m_logoLayer, [this](TextRenderer* tr) { renderLogo(tr); });
+    }
+
+    renderer->drawLayer(m_chromeLayer, [this](TextRenderer* tr) {
+        renderSubtitle(tr);
+        renderFooter(tr);
+    });
 
-    // Render main menu frame
+    // Options blink and follow the selection, draw them every frame
     renderOptions(textRenderer);
+}
+
+void
+StartMenu::getLogoLayout(float32& heightScale, float32& scale, float32& topY) const
+{
+    // Calculate responsive positioning and scaling
+    heightScale = static_cast<float32>(m_screenHeight) / 1080.0f;  // Relative to 1080p
+    heightScale = std::max(0.4f, std::min(heightScale, 2.0f));     // Clamp [0.4, 2.0]
 
-    // Render version/footer info
-    renderFooter(textRenderer);
+    // Position logo at 10% from top (responsive)
+    topY  = static_cast<float32>(m_screenHeight) * 0.20f;
+    scale = 1.25f * heightScale;  // Scale with screen height (halved for 96px font)
 }
 
 void
@@ -147,71 +248,42 @@ StartMenu::renderLogo(TextRenderer* textRenderer)
 
     float32 screenCenterX = static_cast<float32>(m_screenWidth) / 2.0f;
 
-    // Calculate responsive positioning and scaling
-    float32 heightScale = static_cast<float32>(m_screenHeight) / 1080.0f;  // Relative to 1080p
-    heightScale         = std::max(0.4f, std::min(heightScale, 2.0f));     // Clamp [0.4, 2.0]
-
-    // Position logo at 10% from top (responsive)
-    float32 topY = static_cast<float32>(m_screenHeight) * 0.20f;
+    float32 heightScale    = 0.0f;
+    float32 mainTitleScale = 0.0f;
+    float32 topY           = 0.0f;
+    getLogoLayout(heightScale, mainTitleScale, topY);
 
     // Render main title: 0xD3ADC0DE (large, bold)
-    const String& mainTitle = m_logoLines[0];
-    float32 mainTitleScale  = 1.25f *
-                             heightScale;  // Scale with screen height (halved for 96px font)
+    const String& mainTitle  = m_logoLines[0];
     glm::vec3 mainTitleColor = glm::vec3(0.0f, 1.0f, 1.0f);  // Cyan
 
     float32 mainTitleWidth = textRenderer->getTextWidth(mainTitle, mainTitleScale);
     float32 mainTitleX     = screenCenterX - mainTitleWidth / 2.0f;
 
-    // Render with glitch effect if available
-    if (m_glitchEffect && m_glitchEffect->isActive())
+    // Render with glitch effect if available (displacement and tint run in the shader)
+    if (m_glitchDisplay && m_glitchDisplay->isActive())
     {
-        auto glitchCallback = [this](uint32 charIndex, uint32 charCount, float32& x, float32& y,
-                                     glm::vec3& color, bool& visible) {
-            CharacterGlitchState glitchState = m_glitchEffect->getCharacterState(charIndex,
-                                                                                 charCount);
-            x += glitchState.offset.x;
-            y += glitchState.offset.y;
-            color   = color * glitchState.colorMod;
-            visible = glitchState.visible;
-
-            // Note: Duplication is handled separately after main rendering
-            // since renderTextWithCallback processes one character at a time
-        };
-
-        textRenderer->renderTextWithCallback(mainTitle, mainTitleX, topY, mainTitleScale,
-                                             mainTitleColor, glitchCallback);
-
-        // Render duplicated characters as a second pass
-        if (m_glitchEffect && m_glitchEffect->isActive())
-        {
-            float32 currentX = mainTitleX;
-            for (uint32 i = 0; i < mainTitle.length(); ++i)
-            {
-                CharacterGlitchState glitchState =
-                    m_glitchEffect->getCharacterState(i, mainTitle.length());
-
-                if (glitchState.duplicate)
-                {
-                    // Render the duplicated character with offset and reduced alpha
-                    String charStr(1, mainTitle[i]);
-                    float32 dupX = currentX + glitchState.offset.x + glitchState.duplicateOffset.x;
-                    float32 dupY = topY + glitchState.offset.y + glitchState.duplicateOffset.y;
-                    glm::vec3 dupColor = mainTitleColor * glitchState.colorMod *
-                                         0.6f;  // Dimmer duplicate
-
-                    textRenderer->renderText(charStr, dupX, dupY, mainTitleScale, dupColor);
-                }
-
-                // Advance position (approximate character width)
-                currentX += textRenderer->getCharWidth(mainTitleScale);
-            }
-        }
+        textRenderer->renderTextGlitched(mainTitle, mainTitleX, topY, mainTitleScale,
+                                         mainTitleColor, *m_glitchDisplay);
     }
     else
     {
         textRenderer->renderText(mainTitle, mainTitleX, topY, mainTitleScale, mainTitleColor);
     }
+}
+
+void
+StartMenu::renderSubtitle(TextRenderer* textRenderer)
+{
+    if (!textRenderer)
+        return;
+
+    float32 screenCenterX = static_cast<float32>(m_screenWidth) / 2.0f;
+
+    float32 heightScale    = 0.0f;
+    float32 mainTitleScale = 0.0f;
+    float32 topY           = 0.0f;
+    getLogoLayout(heightScale, mainTitleScale, topY);
 
     // Render subtitle: TEXT-BASED RPG (small)
     const String& subtitle = m_logoLines[1];
@@ -231,26 +303,13 @@ StartMenu::renderLogo(TextRenderer* textRenderer)
 void
 StartMenu::renderOptions(TextRenderer* textRenderer)
 {
-    if (!m_mainFrame || !textRenderer)
+    if (!m_mainFrame || !m_optionsGrid || !textRenderer)
         return;
 
     float32 scale = m_mainFrame->m_scale;
 
-    // Render frame
-    // m_mainFrame->render(textRenderer, scale);
-
-    float32 contentX, contentY;
-    int32 contentWidth, contentHeight;
-
-    m_mainFrame->getContentArea(textRenderer, scale, contentX, contentY, contentWidth,
-                                contentHeight);
-
-    glm::vec3 optionColor = glm::vec3(1.0f, 1.0f, 1.0f);
-
-    float32 lineHeight    = textRenderer->getLineHeight(scale);
-    float32 screenCenterX = static_cast<float32>(m_screenWidth) / 2.0f;
-
-    int32 lineOffset = 0;
+    // Rewriting unchanged cells leaves their rows clean
+    m_mainFrame->render(*m_optionsGrid, 0, 0);
 
     for (int32 i = 0; i < static_cast<int32>(StartMenuOption::COUNT); ++i)
     {
@@ -262,7 +321,7 @@ StartMenu::renderOptions(TextRenderer* textRenderer)
         bool isEnabled = isOptionEnabled(option);
 
         String prefix = "  ";
-        if (isSelected && m_blinkState)
+        if (isSelected && m_frame.blinkState)
         {
             prefix = "> ";
         }
@@ -276,16 +335,28 @@ StartMenu::renderOptions(TextRenderer* textRenderer)
             optionText = "[" + optionText + "]";
         }
 
-        String fullLine     = prefix + optionText;
-        float32 prefixWidth = textRenderer->getTextWidth(prefix, scale);
-        float32 lineWidth   = textRenderer->getTextWidth(fullLine, scale);
-        float32 centerX     = screenCenterX - ((lineWidth + prefixWidth) / 2.0f);
+        m_mainFrame->renderText(*m_optionsGrid, 0, 0, prefix + optionText, i,
+                                FrameAlign::CENTER);
+    }
+
+    float32 contentX, contentY;
+    int32 contentWidth, contentHeight;
+    m_mainFrame->getContentArea(textRenderer, scale, contentX, contentY, contentWidth,
+                                contentHeight);
+
+    // Same cell size as CellGrid::render()
+    float32 cellWidth  = std::ceil(textRenderer->getCharWidth(scale));
+    float32 cellHeight = std::ceil(textRenderer->getLineHeight(scale));
+    float32 gridWidth  = static_cast<float32>(m_optionsGrid->getColumns()) * cellWidth;
+    float32 gridHeight = static_cast<float32>(m_optionsGrid->getRows()) * cellHeight;
 
-        textRenderer->renderText(fullLine, centerX, contentY + (lineOffset * lineHeight * 1.2),
-                                 scale, optionColor);
+    // Centered, top border a row above where the options used to start, kept on screen.
+    // Whole pixels keep the cached grid from being resampled.
+    float32 gridX = std::floor((static_cast<float32>(m_screenWidth) - gridWidth) / 2.0f);
+    float32 gridY = std::floor(
+        std::min(contentY - cellHeight, static_cast<float32>(m_screenHeight) - gridHeight));
 
-        lineOffset++;
-    }
+    m_optionsGrid->render(textRenderer, gridX, gridY, scale);
 }
 
 void
@@ -409,8 +480,7 @@ StartMenu::moveSelectionUp()
     }
     while (!isOptionEnabled(m_selectedOption));
 
-    m_blinkTimer = 0.0f;
-    m_blinkState = true;
+    m_blinkRestarts.fetch_add(1, std::memory_order_relaxed);
 
     Logger::debug("Menu selection: {}", getOptionText(m_selectedOption));
 }
@@ -430,8 +500,7 @@ StartMenu::moveSelectionDown()
     }
     while (!isOptionEnabled(m_selectedOption));
 
-    m_blinkTimer = 0.0f;
-    m_blinkState = true;
+    m_blinkRestarts.fetch_add(1, std::memory_order_relaxed);
 
     Logger::debug("Menu selection: {}", getOptionText(m_selectedOption));
 }
@@ -450,6 +519,72 @@ StartMenu::executeSelection()
     }
 }
 
+float32
+StartMenu::getTimeUntilNextFrame() const
+{
+    float32 next = std::max(0.0f, BLINK_INTERVAL - m_blinkTimer);
+    if (m_glitchEffect)
+    {
+        float32 glitch = m_glitchEffect->getTimeUntilNextChange();
+        if (glitch >= 0.0f)
+        {
+            next = std::min(next, glitch);
+        }
+    }
+    if (m_rainInterval > 0.0f)
+    {
+        next = std::min(next, std::max(0.0f, m_rainInterval - m_rainTimer));
+    }
+    return next;
+}
+
+void
+StartMenu::setEffectQuality(EffectQuality quality)
+{
+    if (m_glitchDisplay)
+    {
+        m_glitchDisplay->setQuality(quality);
+    }
+    if (m_rain)
+    {
+        m_rain->setQuality(quality);
+    }
+}
+
+void
+StartMenu::setBackgroundRain(const DigitalRainSettings& settings)
+{
+    if (!m_rain)
+        return;
+
+    m_rain->configure(settings);
+    m_rainInterval = m_rain->getStepInterval();
+    m_rainTimer    = 0.0f;
+}
+
+void
+StartMenu::setRenderTimeOffset(float32 offset)
+{
+    if (m_glitchDisplay)
+    {
+        m_glitchDisplay->setRenderTimeOffset(offset);
+    }
+}
+
+void
+StartMenu::setRandomSeed(uint32 seed)
+{
+    // Both draw from the engine: the simulation picks glitches, the display jitters them
+    if (m_glitchEffect)
+    {
+        m_glitchEffect->setRandomSeed(seed);
+    }
+    if (m_glitchDisplay)
+    {
+        m_glitchDisplay->setRandomSeed(seed);
+    }
+}
+
 void
 StartMenu::onWindowResize(int32 screenWidth, int32 screenHeight)
 {
@@ -458,9 +593,20 @@ StartMenu::onWindowResize(int32 screenWidth, int32 screenHeight)
     m_screenWidth  = screenWidth;
     m_screenHeight = screenHeight;
 
-    if (m_glitchEffect)
+    if (m_glitchDisplay)
     {
-        m_glitchEffect->setScreenSize(screenWidth, screenHeight);
+        m_glitchDisplay->setScreenSize(screenWidth, screenHeight);
+    }
+    if (m_rain)
+    {
+        m_rain->setScreenSize(screenWidth, screenHeight);
+    }
+
+    // Layout depends on the screen size
+    if (m_layerRenderer)
+    {
+        m_layerRenderer->invalidateLayer(m_logoLayer);
+        m_layerRenderer->invalidateLayer(m_chromeLayer);
     }
 
     // Logo frame no longer needed
@@ -487,6 +633,11 @@ StartMenu::onWindowResize(int32 screenWidth, int32 screenHeight)
         m_mainFrame->setDimensions(static_cast<float32>(screenWidth) / 2.0f - 200.0f, menuY, 40,
                                    frameHeight);
 
+        if (m_optionsGrid && m_optionsGrid->getRows() != frameHeight)
+        {
+            m_optionsGrid->resize(m_mainFrame->getWidth(), m_mainFrame->getHeight());
+        }
+
         Logger::debug("Main frame scale: {}, height: {}, position: {}, available: {}px", menuScale,
                       frameHeight, static_cast<int32>(menuY), availablePixels);
     }
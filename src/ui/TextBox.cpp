@@ -10,6 +10,7 @@
 
 #include "deadcode/core/Logger.hpp"
 #include "deadcode/core/Types.hpp"
+#include "deadcode/graphics/RenderBackend.hpp"
 #include "deadcode/graphics/TextRenderer.hpp"
 
 #include <GLFW/glfw3.h>
@@ -30,9 +31,13 @@ TextBox::~TextBox() = default;
 void
 TextBox::update(float deltaTime)
 {
-    if (!m_visible)
+    // A selection change restarts the blink with the box shown
+    uint32 restarts = m_blinkRestarts.load(std::memory_order_relaxed);
+    if (restarts != m_blinkRestartsSeen)
     {
-        return;
+        m_blinkRestartsSeen = restarts;
+        m_blinkTimer        = 0.0F;
+        m_blinkState        = true;
     }
 
     if (m_blinkTimer >= 0.5F)
@@ -44,6 +49,21 @@ TextBox::update(float deltaTime)
     m_blinkTimer += deltaTime;
 }
 
+TextBoxFrame
+TextBox::captureFrame() const
+{
+    TextBoxFrame frame;
+    frame.blinkState = m_blinkState;
+    return frame;
+}
+
+float32
+TextBox::getTimeUntilNextFrame() const
+{
+    // update() toggles on the first call after the timer reaches 0.5
+    return std::max(0.0f, 0.5F - m_blinkTimer);
+}
+
 void
 TextBox::setTextTitle(String title)
 {
@@ -80,14 +100,15 @@ TextBox::initialize(int32 screenWidth, int32 screenHeight)
 }
 
 void
-TextBox::render(TextRenderer* textRenderer, float32 scale)
+TextBox::render(TextRenderer* textRenderer, const TextBoxFrame& frame, float32 scale)
 {
     if (!textRenderer || !m_visible)
     {
         return;
     }
 
-    DrawRectangleRec(m_boxRectangle, Color(0, 250, 0, 255));
+    RenderBackend* backend = textRenderer->getBackend();
+    backend->drawRectangle(m_boxRectangle, Color(0, 250, 0, 255));
     float32 textHeight     = textRenderer->getLineHeight(0.5F);
     float32 textNotWidth   = textRenderer->getTextWidth(m_buttonText[0], 0.5F);
     float32 textYesWidth   = textRenderer->getTextWidth(m_buttonText[1], 0.5F);
@@ -95,7 +116,7 @@ TextBox::render(TextRenderer* textRenderer, float32 scale)
 
     float32 positionY = m_boxRectangle.y + m_boxRectangle.height - textHeight - 20;
 
-    if (m_blinkState)
+    if (frame.blinkState)
     {
         if (m_selectedOption)
         {
@@ -111,7 +132,7 @@ TextBox::render(TextRenderer* textRenderer, float32 scale)
             m_boxSelection.x      = m_boxRectangle.x + m_boxRectangle.width - textNotWidth - 20 - 5;
             m_boxSelection.y      = positionY;
         }
-        DrawRectangleLinesEx(m_boxSelection, 2, Color(100, 100, 100, 150));
+        backend->drawRectangleLines(m_boxSelection, 2.0f, Color(100, 100, 100, 150));
     }
 
     textRenderer->renderText(m_buttonText[0],
@@ -182,17 +203,15 @@ TextBox::handleInput(int32 key, int32 action)
 void
 TextBox::moveSelectionLeft()
 {
-    m_selectedOption     = !m_selectedOption;
-    m_blinkState         = true;
-    m_blinkTimerSelected = 0.0F;
+    m_selectedOption = !m_selectedOption;
+    m_blinkRestarts.fetch_add(1, std::memory_order_relaxed);
 }
 
 void
 TextBox::moveSelectionRight()
 {
-    m_selectedOption     = !m_selectedOption;
-    m_blinkState         = true;
-    m_blinkTimerSelected = 0.0F;
+    m_selectedOption = !m_selectedOption;
+    m_blinkRestarts.fetch_add(1, std::memory_order_relaxed);
 }
 
 void
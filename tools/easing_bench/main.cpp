@@ -0,0 +1,171 @@
+/**
+ * @file main.cpp
+ * @brief Easing micro-benchmark
+ *
+ * Times every easing curve three ways over the same progress values: the
+ * scalar Easing::evaluate(), the table-backed Easing::sample() and the
+ * batch kernel Easing::evaluateBatch(), and reports the batch kernel's
+ * largest deviation from the scalar curve.
+ *
+ * Usage: deadcode_easing_bench [values] [repeats]
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-04
+ */
+
+#include "deadcode/graphics/Easing.hpp"
+#include "deadcode/graphics/EasingBatch.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+using deadcode::EasingType;
+using deadcode::float32;
+using deadcode::float64;
+using deadcode::uint32;
+
+/// A few hundred glyph tweens is the case the batch kernels are for
+constexpr uint32 DEFAULT_VALUES  = 4096;
+constexpr uint32 DEFAULT_REPEATS = 2000;
+
+/// Same order as EasingType
+constexpr const char* CURVE_NAMES[] = {
+    "Linear",
+    "InQuad",    "OutQuad",    "InOutQuad",
+    "InCubic",   "OutCubic",   "InOutCubic",
+    "InQuart",   "OutQuart",   "InOutQuart",
+    "InQuint",   "OutQuint",   "InOutQuint",
+    "InSine",    "OutSine",    "InOutSine",
+    "InExpo",    "OutExpo",    "InOutExpo",
+    "InCirc",    "OutCirc",    "InOutCirc",
+    "InElastic", "OutElastic", "InOutElastic",
+    "InBack",    "OutBack",    "InOutBack",
+    "OutBounce", "InBounce",   "InOutBounce",
+};
+
+static_assert(std::size(CURVE_NAMES) == static_cast<size_t>(EasingType::Count));
+
+/// Nanoseconds per value of the fastest of a few timed passes
+template <typename Pass>
+float64
+timePerValue(uint32 values, uint32 repeats, Pass pass)
+{
+    float64 best = 1.0e30;
+    for (uint32 round = 0; round < 3; ++round)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < repeats; ++i)
+        {
+            pass();
+        }
+        std::chrono::duration<float64, std::nano> elapsed = std::chrono::steady_clock::now() -
+                                                            start;
+        best = std::min(best, elapsed.count() / (static_cast<float64>(values) * repeats));
+    }
+    return best;
+}
+
+uint32
+parseCount(const char* text, uint32 fallback)
+{
+    unsigned long value = std::strtoul(text, nullptr, 10);
+    return value == 0 ? fallback : static_cast<uint32>(value);
+}
+}  // namespace
+
+int
+main(int argc, char** argv)
+{
+    uint32 values  = argc > 1 ? parseCount(argv[1], DEFAULT_VALUES) : DEFAULT_VALUES;
+    uint32 repeats = argc > 2 ? parseCount(argv[2], DEFAULT_REPEATS) : DEFAULT_REPEATS;
+
+    // Progress values in a shuffled-looking order, so the piecewise curves
+    // cannot lean on the branch predictor
+    std::vector<float32> progress(values);
+    for (uint32 i = 0; i < values; ++i)
+    {
+        uint32 scrambled = (i * 2654435761u) % values;
+        progress[i]      = static_cast<float32>(scrambled) / static_cast<float32>(values - 1);
+    }
+    std::vector<float32> scalarOut(values);
+    std::vector<float32> batchOut(values);
+
+    std::cout << "Easing benchmark: " << values << " values x " << repeats
+              << " repeats, batch backend " << deadcode::Easing::getBatchBackend() << "\n\n";
+    std::cout << std::left << std::setw(14) << "curve" << std::right << std::setw(12)
+              << "scalar ns" << std::setw(12) << "table ns" << std::setw(12) << "batch ns"
+              << std::setw(10) << "speedup" << std::setw(12) << "max error" << "\n";
+
+    float64 scalarTotal = 0.0;
+    float64 batchTotal  = 0.0;
+    for (uint32 curve = 0; curve < static_cast<uint32>(EasingType::Count); ++curve)
+    {
+        EasingType type = static_cast<EasingType>(curve);
+
+        float64 scalarNs = timePerValue(values, repeats,
+                                        [&]
+                                        {
+                                            for (uint32 i = 0; i < values; ++i)
+                                            {
+                                                scalarOut[i] = deadcode::Easing::evaluate(
+                                                    type, progress[i]);
+                                            }
+                                        });
+
+        float64 tableNs = 0.0;
+        if (deadcode::Easing::hasTable(type))
+        {
+            tableNs = timePerValue(values, repeats,
+                                   [&]
+                                   {
+                                       for (uint32 i = 0; i < values; ++i)
+                                       {
+                                           batchOut[i] = deadcode::Easing::sample(type,
+                                                                                  progress[i]);
+                                       }
+                                   });
+        }
+
+        float64 batchNs = timePerValue(values, repeats,
+                                       [&]
+                                       {
+                                           deadcode::Easing::evaluateBatch(
+                                               type, progress.data(), batchOut.data(), values);
+                                       });
+
+        float32 maxError = 0.0f;
+        for (uint32 i = 0; i < values; ++i)
+        {
+            maxError = std::max(maxError, std::fabs(batchOut[i] - scalarOut[i]));
+        }
+
+        scalarTotal += scalarNs;
+        batchTotal += batchNs;
+
+        std::cout << std::left << std::setw(14) << CURVE_NAMES[curve] << std::right
+                  << std::fixed << std::setprecision(3) << std::setw(12) << scalarNs;
+        if (tableNs > 0.0)
+        {
+            std::cout << std::setw(12) << tableNs;
+        }
+        else
+        {
+            std::cout << std::setw(12) << "-";
+        }
+        std::cout << std::setw(12) << batchNs << std::setprecision(1) << std::setw(9)
+                  << scalarNs / batchNs << "x" << std::scientific << std::setprecision(2)
+                  << std::setw(12) << maxError << "\n";
+    }
+
+    std::cout << "\nAll curves: " << std::fixed << std::setprecision(1)
+              << scalarTotal / batchTotal << "x faster in batch\n";
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file main.cpp
+ * @brief Offline font atlas baker
+ *
+ * Bakes a FontAtlasCache file for every font in a directory, for each
+ * requested size and both atlas modes, so the game never has to rasterize
+ * a TTF at startup. Fonts whose baked atlas is already up to date are
+ * skipped.
+ *
+ * Usage: deadcode_font_baker <fonts-dir> [size ...]
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-02-17
+ */
+
+#include "deadcode/core/Logger.hpp"
+#include "deadcode/graphics/FontAtlasCache.hpp"
+
+#include <raylib.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+/// Size the game loads its UI font at (Application::initializeRenderer)
+constexpr deadcode::uint32 DEFAULT_FONT_SIZE = 52;
+
+bool
+isFontFile(const std::filesystem::path& path)
+{
+    std::string extension = path.extension().string();
+    return extension == ".ttf" || extension == ".otf" || extension == ".TTF" ||
+           extension == ".OTF";
+}
+}  // namespace
+
+int
+main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <fonts-dir> [size ...]\n";
+        return EXIT_FAILURE;
+    }
+
+    if (!deadcode::Logger::initialize("font_baker.log", deadcode::LogLevel::INFO))
+    {
+        std::cerr << "Failed to initialize logging system\n";
+        return EXIT_FAILURE;
+    }
+
+    // Raylib's own per-glyph logging is noise here
+    SetTraceLogLevel(LOG_WARNING);
+
+    std::filesystem::path fontDir(argv[1]);
+    std::vector<deadcode::uint32> sizes;
+    for (int i = 2; i < argc; ++i)
+    {
+        unsigned long size = std::strtoul(argv[i], nullptr, 10);
+        if (size == 0)
+        {
+            deadcode::Logger::error("Invalid font size: {}", argv[i]);
+            deadcode::Logger::shutdown();
+            return EXIT_FAILURE;
+        }
+        sizes.push_back(static_cast<deadcode::uint32>(size));
+    }
+    if (sizes.empty())
+    {
+        sizes.push_back(DEFAULT_FONT_SIZE);
+    }
+
+    std::error_code error;
+    if (!std::filesystem::is_directory(fontDir, error))
+    {
+        deadcode::Logger::error("Not a directory: {}", fontDir.string());
+        deadcode::Logger::shutdown();
+        return EXIT_FAILURE;
+    }
+
+    int failures = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(fontDir))
+    {
+        if (!entry.is_regular_file() || !isFontFile(entry.path()))
+            continue;
+
+        for (deadcode::uint32 size : sizes)
+        {
+            for (auto mode : {deadcode::FontAtlasMode::Bitmap, deadcode::FontAtlasMode::SDF})
+            {
+                if (!deadcode::FontAtlasCache::bake(entry.path().string(), size, mode))
+                {
+                    failures++;
+                }
+            }
+        }
+    }
+
+    deadcode::Logger::shutdown();
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file main.cpp
+ * @brief Headless render driver
+ *
+ * Renders the start menu with the exit dialog over it for a number of
+ * fixed-step frames on the HeadlessRenderBackend, and prints the
+ * recording's checksum. Given a dump file it also writes the recording
+ * as text; given an expected checksum it fails when the frames differ,
+ * so a rendering change can be caught without a display or GPU.
+ *
+ * Run from the build's bin directory, it loads the game's fonts from
+ * assets/fonts like the game does.
+ *
+ * Usage: deadcode_headless_render [frames] [dump-file] [expected-checksum]
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-07
+ */
+
+#include "deadcode/core/Logger.hpp"
+#include "deadcode/graphics/DigitalRain.hpp"
+#include "deadcode/graphics/HeadlessRenderBackend.hpp"
+#include "deadcode/graphics/Renderer.hpp"
+#include "deadcode/graphics/TextRenderer.hpp"
+#include "deadcode/ui/StartMenu.hpp"
+#include "deadcode/ui/TextBox.hpp"
+
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <string>
+
+#include <raylib.h>
+
+namespace
+{
+using deadcode::float32;
+using deadcode::int32;
+using deadcode::uint32;
+using deadcode::uint64;
+
+constexpr int32 SCREEN_WIDTH    = 1280;
+constexpr int32 SCREEN_HEIGHT   = 720;
+constexpr uint32 DEFAULT_FRAMES = 120;
+constexpr float32 FRAME_STEP    = 1.0f / 60.0f;
+constexpr uint32 GLITCH_SEED    = 0xDEADC0DE;
+
+/// Same font and size as Application::initializeRenderer()
+constexpr const char* FONT_PATH        = "assets/fonts/PixelOperator-Bold.ttf";
+constexpr uint32 FONT_SIZE             = 52;
+constexpr const char* FALLBACK_FONTS[] = {
+    "assets/fonts/dos-vga-win.ttf",
+    "assets/fonts/JetBrainsMonoNerdFont-Regular.ttf",
+};
+
+uint32
+parseCount(const char* text, uint32 fallback)
+{
+    unsigned long value = std::strtoul(text, nullptr, 10);
+    return value == 0 ? fallback : static_cast<uint32>(value);
+}
+}  // namespace
+
+int
+main(int argc, char** argv)
+{
+    uint32 frames        = argc > 1 ? parseCount(argv[1], DEFAULT_FRAMES) : DEFAULT_FRAMES;
+    std::string dumpPath = argc > 2 ? argv[2] : "";
+
+    if (!deadcode::Logger::initialize("headless_render.log", deadcode::LogLevel::WARN))
+    {
+        std::cerr << "Failed to initialize logging system\n";
+        return EXIT_FAILURE;
+    }
+
+    // Raylib's own per-glyph logging is noise here
+    SetTraceLogLevel(LOG_WARNING);
+
+    deadcode::Renderer renderer;
+    if (!renderer.initializeHeadless(SCREEN_WIDTH, SCREEN_HEIGHT))
+    {
+        std::cerr << "Failed to initialize headless renderer\n";
+        return EXIT_FAILURE;
+    }
+
+    deadcode::TextRenderer* textRenderer = renderer.getTextRenderer();
+    if (!textRenderer->loadFont(FONT_PATH, FONT_SIZE, deadcode::FontAtlasMode::SDF))
+    {
+        std::cerr << "Failed to load " << FONT_PATH << " (run from the build's bin directory)\n";
+        return EXIT_FAILURE;
+    }
+    for (const char* fallbackFont : FALLBACK_FONTS)
+    {
+        textRenderer->addFallbackFont(fallbackFont);
+    }
+
+    deadcode::StartMenu menu;
+    deadcode::TextBox textBox;
+    if (!menu.initialize(SCREEN_WIDTH, SCREEN_HEIGHT) ||
+        !textBox.initialize(SCREEN_WIDTH, SCREEN_HEIGHT))
+    {
+        std::cerr << "Failed to initialize the start menu or text box\n";
+        return EXIT_FAILURE;
+    }
+
+    // The rain sizes itself to measured CPU time, which no two runs share
+    deadcode::DigitalRainSettings rain;
+    rain.enabled = false;
+    menu.setBackgroundRain(rain);
+    menu.setRandomSeed(GLITCH_SEED);
+    textBox.setVisible(true);
+
+    // Fixed steps, one update per frame, drawn the way Application::render() does
+    for (uint32 frame = 0; frame < frames; ++frame)
+    {
+        menu.update(FRAME_STEP);
+        textBox.update(FRAME_STEP);
+
+        renderer.beginFrame();
+        menu.render(&renderer, menu.captureFrame());
+        renderer.setDrawLayer(deadcode::DrawLayer::OVERLAY);
+        textBox.render(textRenderer, textBox.captureFrame());
+        renderer.setDrawLayer(deadcode::DrawLayer::DEFAULT);
+        renderer.endFrame();
+    }
+
+    auto* backend   = static_cast<deadcode::HeadlessRenderBackend*>(renderer.getBackend());
+    uint64 checksum = backend->getChecksum();
+    std::cout << std::format("Headless render: {} frames, {} commands, checksum {:016x}\n",
+                             backend->getFrameCount(), backend->getCommandCount(), checksum);
+
+    if (!dumpPath.empty() && !backend->dump(dumpPath))
+    {
+        std::cerr << "Failed to write " << dumpPath << "\n";
+        return EXIT_FAILURE;
+    }
+
+    int result = EXIT_SUCCESS;
+    if (argc > 3)
+    {
+        uint64 expected = std::strtoull(argv[3], nullptr, 16);
+        if (checksum != expected)
+        {
+            std::cerr << std::format("Checksum mismatch: expected {:016x}\n", expected);
+            result = EXIT_FAILURE;
+        }
+    }
+
+    renderer.shutdown();
+    deadcode::Logger::shutdown();
+    return result;
+}
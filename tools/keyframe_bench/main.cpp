@@ -0,0 +1,166 @@
+/**
+ * @file main.cpp
+ * @brief Keyframe track micro-benchmark
+ *
+ * Samples a 256-key track three ways for each interpolation: a forward
+ * sweep that keeps the cursor between samples (playback), the same sweep
+ * with the cursor reset every sample so each one binary-searches, and
+ * seeks to scattered times with the cursor kept. The sweep also checks
+ * that both forward paths return the same values.
+ *
+ * Usage: deadcode_keyframe_bench [keys] [samples] [repeats]
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-07
+ */
+
+#include "deadcode/graphics/KeyframeTrack.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+using deadcode::float32;
+using deadcode::float64;
+using deadcode::KeyInterpolation;
+using deadcode::uint32;
+
+constexpr uint32 DEFAULT_KEYS    = 256;
+constexpr uint32 DEFAULT_SAMPLES = 16384;
+constexpr uint32 DEFAULT_REPEATS = 200;
+
+/// Same order as KeyInterpolation
+constexpr const char* INTERPOLATION_NAMES[] = {"Step", "Linear", "Hermite", "Bezier"};
+
+/// Nanoseconds per sample of the fastest of a few timed passes
+template <typename Pass>
+float64
+timePerSample(uint32 samples, uint32 repeats, Pass pass)
+{
+    float64 best = 1.0e30;
+    for (uint32 round = 0; round < 3; ++round)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < repeats; ++i)
+        {
+            pass();
+        }
+        std::chrono::duration<float64, std::nano> elapsed = std::chrono::steady_clock::now() -
+                                                            start;
+        best = std::min(best, elapsed.count() / (static_cast<float64>(samples) * repeats));
+    }
+    return best;
+}
+
+uint32
+parseCount(const char* text, uint32 fallback)
+{
+    unsigned long value = std::strtoul(text, nullptr, 10);
+    return value == 0 ? fallback : static_cast<uint32>(value);
+}
+
+/// Keys a quarter second apart with uneven values, so no segment is trivial
+deadcode::KeyframeTrack<float32>
+makeTrack(uint32 keys, KeyInterpolation interpolation)
+{
+    deadcode::KeyframeTrack<float32> track;
+    for (uint32 i = 0; i < keys; ++i)
+    {
+        deadcode::Keyframe<float32> key;
+        key.value         = std::sin(static_cast<float32>(i) * 0.7f) * 100.0f;
+        key.bezier        = {0.25f, 0.1f, 0.25f, 1.0f};
+        key.interpolation = interpolation;
+        track.addKey(static_cast<float32>(i) * 0.25f, key);
+    }
+    track.computeTangents();
+    return track;
+}
+}  // namespace
+
+int
+main(int argc, char** argv)
+{
+    uint32 keys    = argc > 1 ? parseCount(argv[1], DEFAULT_KEYS) : DEFAULT_KEYS;
+    uint32 samples = argc > 2 ? parseCount(argv[2], DEFAULT_SAMPLES) : DEFAULT_SAMPLES;
+    uint32 repeats = argc > 3 ? parseCount(argv[3], DEFAULT_REPEATS) : DEFAULT_REPEATS;
+
+    float32 duration = static_cast<float32>(keys - 1) * 0.25f;
+
+    // Playback visits the track in order, a seek lands anywhere
+    std::vector<float32> sweep(samples);
+    std::vector<float32> seeks(samples);
+    for (uint32 i = 0; i < samples; ++i)
+    {
+        uint32 scrambled = (i * 2654435761u) % samples;
+        sweep[i]         = static_cast<float32>(i) / static_cast<float32>(samples - 1) * duration;
+        seeks[i]         = static_cast<float32>(scrambled) / static_cast<float32>(samples - 1) *
+                   duration;
+    }
+    std::vector<float32> cachedOut(samples);
+    std::vector<float32> searchOut(samples);
+    std::vector<float32> seekOut(samples);
+
+    std::cout << "Keyframe benchmark: " << keys << " keys, " << samples << " samples x "
+              << repeats << " repeats\n\n";
+    std::cout << std::left << std::setw(10) << "segments" << std::right << std::setw(12)
+              << "cursor ns" << std::setw(12) << "search ns" << std::setw(10) << "speedup"
+              << std::setw(12) << "seek ns" << "\n";
+
+    bool matched = true;
+    for (uint32 mode = 0; mode < std::size(INTERPOLATION_NAMES); ++mode)
+    {
+        auto track = makeTrack(keys, static_cast<KeyInterpolation>(mode));
+
+        float64 cachedNs = timePerSample(samples, repeats,
+                                         [&]
+                                         {
+                                             uint32 cursor = 0;
+                                             for (uint32 i = 0; i < samples; ++i)
+                                             {
+                                                 cachedOut[i] = track.sample(sweep[i], cursor);
+                                             }
+                                         });
+
+        float64 searchNs = timePerSample(samples, repeats,
+                                         [&]
+                                         {
+                                             for (uint32 i = 0; i < samples; ++i)
+                                             {
+                                                 uint32 cursor = 0;
+                                                 searchOut[i]  = track.sample(sweep[i], cursor);
+                                             }
+                                         });
+
+        float64 seekNs = timePerSample(samples, repeats,
+                                       [&]
+                                       {
+                                           uint32 cursor = 0;
+                                           for (uint32 i = 0; i < samples; ++i)
+                                           {
+                                               seekOut[i] = track.sample(seeks[i], cursor);
+                                           }
+                                       });
+
+        matched = matched && cachedOut == searchOut;
+
+        std::cout << std::left << std::setw(10) << INTERPOLATION_NAMES[mode] << std::right
+                  << std::fixed << std::setprecision(2) << std::setw(12) << cachedNs
+                  << std::setw(12) << searchNs << std::setprecision(1) << std::setw(9)
+                  << searchNs / cachedNs << "x" << std::setprecision(2) << std::setw(12)
+                  << seekNs << "\n";
+    }
+
+    if (!matched)
+    {
+        std::cerr << "\nCursor and search sweeps disagree\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
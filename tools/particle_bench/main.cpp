@@ -0,0 +1,123 @@
+/**
+ * @file main.cpp
+ * @brief Glyph particle micro-benchmark
+ *
+ * Fills a GlyphParticleSystem to capacity and times update() for
+ * particles flying free (a shatter) and for particles pulled back home
+ * (a reassembly). Lifetimes outlast the run, so every update moves the
+ * full set and removes nothing.
+ *
+ * Usage: deadcode_particle_bench [particles] [updates]
+ *
+ * @author 0xDEADC0DE Team
+ * @date 2026-03-07
+ */
+
+#include "deadcode/graphics/GlyphParticleSystem.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+
+namespace
+{
+using deadcode::float32;
+using deadcode::float64;
+using deadcode::int32;
+using deadcode::uint32;
+
+constexpr uint32 DEFAULT_PARTICLES = deadcode::GlyphParticleSystem::DEFAULT_CAPACITY;
+constexpr uint32 DEFAULT_UPDATES   = 1000;
+constexpr float32 FRAME_STEP       = 1.0f / 120.0f;
+
+uint32
+parseCount(const char* text, uint32 fallback)
+{
+    unsigned long value = std::strtoul(text, nullptr, 10);
+    return value == 0 ? fallback : static_cast<uint32>(value);
+}
+
+/// Fill the system with a grid of glyphs, as emitText() would for a screen of text
+void
+fill(deadcode::GlyphParticleSystem& particles, uint32 count, const deadcode::GlyphBurst& burst)
+{
+    particles.clear();
+    for (uint32 i = 0; i < count; ++i)
+    {
+        float32 x = static_cast<float32>(i % 240) * 8.0f;
+        float32 y = static_cast<float32>(i / 240) * 16.0f;
+        particles.emit('A' + static_cast<int32>(i % 26), x, y, 1.0f, Color{0, 255, 90, 255},
+                       burst);
+    }
+}
+
+/// Milliseconds per update() of the fastest of a few timed passes
+float64
+timePerUpdate(deadcode::GlyphParticleSystem& particles, uint32 updates)
+{
+    float64 best = 1.0e30;
+    for (uint32 round = 0; round < 3; ++round)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < updates; ++i)
+        {
+            particles.update(FRAME_STEP);
+        }
+        std::chrono::duration<float64, std::milli> elapsed = std::chrono::steady_clock::now() -
+                                                             start;
+        best = std::min(best, elapsed.count() / updates);
+    }
+    return best;
+}
+}  // namespace
+
+int
+main(int argc, char** argv)
+{
+    uint32 count   = argc > 1 ? parseCount(argv[1], DEFAULT_PARTICLES) : DEFAULT_PARTICLES;
+    uint32 updates = argc > 2 ? parseCount(argv[2], DEFAULT_UPDATES) : DEFAULT_UPDATES;
+
+    deadcode::GlyphParticleSystem particles(count);
+    particles.setGravity({0.0f, 200.0f});
+    particles.setDrag(0.5f);
+
+    // Nothing may die while timing, a shrinking set would flatter later rounds
+    float32 lifetime = static_cast<float32>(updates) * FRAME_STEP * 10.0f;
+
+    deadcode::GlyphBurst shatter;
+    shatter.lifetime = lifetime;
+
+    deadcode::GlyphBurst reassemble;
+    reassemble.scatter  = 120.0f;
+    reassemble.homePull = 40.0f;
+    reassemble.lifetime = lifetime;
+
+    std::cout << "Glyph particle benchmark: " << count << " particles x " << updates
+              << " updates\n\n";
+    std::cout << std::left << std::setw(14) << "burst" << std::right << std::setw(14)
+              << "ms/update" << std::setw(16) << "ns/particle" << "\n";
+
+    const std::pair<const char*, const deadcode::GlyphBurst*> cases[] = {
+        {"shatter", &shatter},
+        {"reassemble", &reassemble},
+    };
+    for (const auto& [name, burst] : cases)
+    {
+        fill(particles, count, *burst);
+        if (particles.getCount() != count)
+        {
+            std::cerr << "Only " << particles.getCount() << " of " << count
+                      << " particles spawned\n";
+            return EXIT_FAILURE;
+        }
+
+        float64 ms = timePerUpdate(particles, updates);
+        std::cout << std::left << std::setw(14) << name << std::right << std::fixed
+                  << std::setprecision(4) << std::setw(14) << ms << std::setprecision(3)
+                  << std::setw(16) << ms * 1.0e6 / count << "\n";
+    }
+    return EXIT_SUCCESS;
+}